@@ -136,11 +136,10 @@ class ReceiveOnMessagePort final
                                            {
                                                if (! ec)
                                                {
-                                                   std::string          receivedAsString{_data.data(), length};
                                                    nImO::IPv4Address    senderAddress{_senderEndpoint.address().to_v4().to_uint()};
                                                    nImO::IPv4Port       senderPort{_senderEndpoint.port()};
 
-                                                   lReceiveQueue.addRawBytesAsMessage(0, senderAddress, senderPort, receivedAsString);
+                                                   lReceiveQueue.addRawBytesAsMessage(0, senderAddress, senderPort, _data.data(), length);
                                                    receiveMessages();
                                                }
                                            });
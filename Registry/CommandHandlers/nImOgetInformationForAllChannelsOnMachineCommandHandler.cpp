@@ -75,6 +75,28 @@
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Convert the information for a channel into a Value.
+ @param[in] info The channel information.
+ @return The channel information as an Array. */
+static nImO::SpValue
+makeChannelInfoValue
+    (const nImO::ChannelInfo &  info)
+{
+    ODL_ENTER(); //####
+    ODL_P1(&info); //####
+    auto    infoArray{std::make_shared<nImO::Array>()};
+
+    infoArray->addValue(std::make_shared<nImO::Logical>(info._found));
+    infoArray->addValue(std::make_shared<nImO::String>(info._node));
+    infoArray->addValue(std::make_shared<nImO::String>(info._path));
+    infoArray->addValue(std::make_shared<nImO::Logical>(info._isOutput));
+    infoArray->addValue(std::make_shared<nImO::String>(info._dataType));
+    infoArray->addValue(std::make_shared<nImO::Integer>(StaticCast(int, info._modes)));
+    infoArray->addValue(std::make_shared<nImO::Logical>(info._inUse));
+    ODL_EXIT_P(infoArray.get()); //####
+    return infoArray;
+} // makeChannelInfoValue
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -125,23 +147,8 @@ nImO::GetInformationForAllChannelsOnMachineCommandHandler::doIt
 
             if (statusWithInfoVector.first.first)
             {
-                auto    channelArray{std::make_shared<Array>()};
-
-                for (auto & walker : statusWithInfoVector.second)
-                {
-                    auto    infoArray{std::make_shared<Array>()};
-
-                    infoArray->addValue(std::make_shared<Logical>(walker._found));
-                    infoArray->addValue(std::make_shared<String>(walker._node));
-                    infoArray->addValue(std::make_shared<String>(walker._path));
-                    infoArray->addValue(std::make_shared<Logical>(walker._isOutput));
-                    infoArray->addValue(std::make_shared<String>(walker._dataType));
-                    infoArray->addValue(std::make_shared<Integer>(StaticCast(int, walker._modes)));
-                    infoArray->addValue(std::make_shared<Logical>(walker._inUse));
-                    channelArray->addValue(infoArray);
-                }
-                okSoFar = sendComplexResponse(socket, kGetInformationForAllChannelsOnMachineResponse, "get information for all channels on machine"s,
-                                              channelArray, reason);
+                okSoFar = sendStreamedResponse(socket, kGetInformationForAllChannelsOnMachineResponse, "get information for all channels on machine"s,
+                                               statusWithInfoVector.second, makeChannelInfoValue, acceptsStreamedResponse(arguments, 2), reason);
                 ODL_B1(okSoFar); //####
             }
             else
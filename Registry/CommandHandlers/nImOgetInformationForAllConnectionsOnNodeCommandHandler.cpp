@@ -75,6 +75,28 @@
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Convert the information for a connection into a Value.
+ @param[in] info The connection information.
+ @return The connection information as an Array. */
+static nImO::SpValue
+makeConnectionInfoValue
+    (const nImO::ConnectionInfo &   info)
+{
+    ODL_ENTER(); //####
+    ODL_P1(&info); //####
+    auto    infoArray{std::make_shared<nImO::Array>()};
+
+    infoArray->addValue(std::make_shared<nImO::Logical>(info._found));
+    infoArray->addValue(std::make_shared<nImO::String>(info._fromNode));
+    infoArray->addValue(std::make_shared<nImO::String>(info._fromPath));
+    infoArray->addValue(std::make_shared<nImO::String>(info._toNode));
+    infoArray->addValue(std::make_shared<nImO::String>(info._toPath));
+    infoArray->addValue(std::make_shared<nImO::String>(info._dataType));
+    infoArray->addValue(std::make_shared<nImO::Integer>(StaticCast(int, info._mode)));
+    ODL_EXIT_P(infoArray.get()); //####
+    return infoArray;
+} // makeConnectionInfoValue
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -125,23 +147,8 @@ nImO::GetInformationForAllConnectionsOnNodeCommandHandler::doIt
 
             if (statusWithInfoVector.first.first)
             {
-                auto    connectionArray{std::make_shared<Array>()};
-
-                for (auto & walker : statusWithInfoVector.second)
-                {
-                    auto    infoArray{std::make_shared<Array>()};
-
-                    infoArray->addValue(std::make_shared<Logical>(walker._found));
-                    infoArray->addValue(std::make_shared<String>(walker._fromNode));
-                    infoArray->addValue(std::make_shared<String>(walker._fromPath));
-                    infoArray->addValue(std::make_shared<String>(walker._toNode));
-                    infoArray->addValue(std::make_shared<String>(walker._toPath));
-                    infoArray->addValue(std::make_shared<String>(walker._dataType));
-                    infoArray->addValue(std::make_shared<Integer>(StaticCast(int, walker._mode)));
-                    connectionArray->addValue(infoArray);
-                }
-                okSoFar = sendComplexResponse(socket, kGetInformationForAllConnectionsOnNodeResponse, "get information for all connections on node"s,
-                                              connectionArray, reason);
+                okSoFar = sendStreamedResponse(socket, kGetInformationForAllConnectionsOnNodeResponse, "get information for all connections on node"s,
+                                               statusWithInfoVector.second, makeConnectionInfoValue, acceptsStreamedResponse(arguments, 2), reason);
                 ODL_B1(okSoFar); //####
             }
             else
@@ -47,12 +47,19 @@
 #include <BasicTypes/nImOtime.h>
 #include <Containers/nImOarray.h>
 #include <Containers/nImObufferChunk.h>
+#include <Containers/nImOkeyDictionary.h>
 #include <Containers/nImOmap.h>
 #include <Containers/nImOmessage.h>
 #include <Containers/nImOset.h>
 #include <Containers/nImOstringBuffer.h>
 #include <Contexts/nImOtestContext.h>
+#include <nImOcompression.h>
+#include <nImOdatagramFragments.h>
 #include <nImOMIMESupport.h>
+#include <nImOreceiveQueue.h>
+#include <nImOregistryCommands.h>
+#include <nImOsharedMemoryRing.h>
+#include <ResponseHandlers/nImOgetInformationForAllChannelsResponseHandler.h>
 
 #include <string>
 
@@ -263,6 +270,130 @@ extractValueAndCheck
     return result;
 } // extractValueAndCheck
 
+/*! @brief Send a Value through a binary frame and verify what was received.
+ @param[in] aValue The Value to be framed.
+ @param[in] addChecksum @c true if the frame is to have a checksum.
+ @return Zero on success and non-zero on failure. */
+static int
+frameValueAndCheck
+    (SpValue    aValue,
+     const bool addChecksum)
+{
+    ODL_ENTER(); //####
+    ODL_P1(aValue.get()); //####
+    ODL_B1(addChecksum); //####
+    int     result{1};
+    Message outMessage;
+
+    outMessage.open(true);
+    outMessage.setValue(aValue);
+    outMessage.close();
+    auto    asString{outMessage.getString()};
+    auto    framed{PackageMessageAsFrame(asString, addChecksum)};
+    size_t  expectedLength{kFrameHeaderSize + (addChecksum ? kFrameChecksumSize : 0) + asString.length()};
+
+    if (expectedLength == framed->length())
+    {
+        CPtr(uint8_t)   body;
+        size_t          bodyLength;
+
+        if (UnpackageFrame(ReinterpretCast(CPtr(uint8_t), framed->data()), framed->length(), body, bodyLength))
+        {
+            if ((asString.length() == bodyLength) && (0 == memcmp(asString.data(), body, bodyLength)))
+            {
+                Message inMessage;
+
+                inMessage.open(false);
+                inMessage.appendBytes(body, bodyLength);
+                auto    extractedValue{inMessage.getValue()};
+
+                inMessage.close();
+                if (extractedValue && (nullptr == extractedValue->asFlaw()) && extractedValue->deeplyEqualTo(*aValue))
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (extractedValue && (nullptr == extractedValue->asFlaw()) && extractedValue->deeplyEqualTo(*aValue))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! ((asString.length() == bodyLength) && (0 == memcmp(asString.data(), body, bodyLength)))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (UnpackageFrame(ReinterpretCast(CPtr(uint8_t), framed->data()), framed->length(), body, bodyLength))"); //####
+        }
+    }
+    else
+    {
+        ODL_LOG("! (expectedLength == framed->length())"); //####
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // frameValueAndCheck
+
+/*! @brief Compress some bytes and verify that they are restored exactly.
+ @param[in] data The bytes to be compressed.
+ @param[in] mustCompress @c true if the bytes are expected to be made smaller.
+ @return Zero on success and non-zero on failure. */
+static int
+compressBytesAndCheck
+    (const std::string &    data,
+     const bool             mustCompress)
+{
+    ODL_ENTER(); //####
+    ODL_B1(mustCompress); //####
+    int         result{1};
+    std::string compressed{};
+    ByteVector  expanded{};
+
+    if (CompressMessageBytes(ReinterpretCast(CPtr(uint8_t), data.data()), data.length(), compressed))
+    {
+        if (ExpandMessageBytes(ReinterpretCast(CPtr(uint8_t), compressed.data()), compressed.length(), expanded) &&
+            (data.length() == expanded.size()) && (0 == memcmp(data.data(), expanded.data(), data.length())))
+        {
+            result = 0;
+        }
+        else
+        {
+            ODL_LOG("! (ExpandMessageBytes(ReinterpretCast(CPtr(uint8_t), compressed.data()), compressed.length(), expanded) && " //####
+                    "(data.length() == expanded.size()) && (0 == memcmp(data.data(), expanded.data(), data.length())))"); //####
+        }
+    }
+    else
+    {
+        ODL_LOG("! (CompressMessageBytes(ReinterpretCast(CPtr(uint8_t), data.data()), data.length(), compressed))"); //####
+        result = (mustCompress ? 1 : 0);
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // compressBytesAndCheck
+
+/*! @brief Put a compressed Message header in front of an LZ4 block.
+ @param[in] expandedLength The number of bytes that the block is to expand to.
+ @param[in] block The LZ4 block.
+ @return The compressed Message. */
+static std::string
+makeCompressedMessage
+    (const size_t           expandedLength,
+     const std::string &    block)
+{
+    ODL_ENTER(); //####
+    ODL_I1(expandedLength); //####
+    std::string result(1, StaticCast(char, kCompressedMessageMarker));
+
+    for (int shift = 24; 0 <= shift; shift -= 8)
+    {
+        result.push_back(StaticCast(char, (expandedLength >> shift) & 0x00FF));
+    }
+    result += block;
+    ODL_EXIT(); //####
+    return result;
+} // makeCompressedMessage
+
 #if defined(__APPLE__)
 # pragma mark *** Test Case 001 ***
 #endif // defined(__APPLE__)
@@ -692,6 +823,155 @@ doTestMIMEBytesMod3Is2Packaged
     return result;
 } // doTestMIMEBytesMod3Is2Packaged
 
+#if defined(__APPLE__)
+# pragma mark *** Test Case 007 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestMIMELineLayout
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        StdStringVector inOutValue;
+        ByteVector      inValue;
+        ByteVector      outValue;
+
+        for (int ii = 0; ii < 1000; ++ii)
+        {
+            inValue.push_back(StaticCast(uint8_t, ii));
+        }
+        EncodeBytesAsMIME(inOutValue, inValue.data(), inValue.size());
+        // 1000 bytes need 1336 characters, which is 18 full lines and a line of 40 characters.
+        if ((19 == inOutValue.size()) && ("AAECAwQFBgcICQoLDA0ODxAREhMUFRYXGBkaGxwdHh8gISIjJCUmJygpKissLS4vMDEyMzQ1"s == inOutValue[0]) &&
+            ("zM3Oz9DR0tPU1dbX2Nna29zd3t/g4eLj5OXm5w=="s == inOutValue[18]))
+        {
+            result = 0;
+            for (size_t ii = 0; ii < 18; ++ii)
+            {
+                if (72 != inOutValue[ii].length())
+                {
+                    ODL_LOG("(72 != inOutValue[ii].length())"); //####
+                    result = 1;
+                    break;
+
+                }
+            }
+            std::string joined{inOutValue[0]};
+
+            for (size_t ii = 1; ii < inOutValue.size(); ++ii)
+            {
+                joined += "\n"s + inOutValue[ii];
+            }
+            if ((0 == result) && DecodeMIMEToBytes(joined, outValue))
+            {
+                if (inValue != outValue)
+                {
+                    ODL_LOG("(inValue != outValue)"); //####
+                    result = 1;
+                }
+            }
+            else
+            {
+                ODL_LOG("! ((0 == result) && DecodeMIMEToBytes(joined, outValue))"); //####
+                result = 1;
+            }
+        }
+        else
+        {
+            ODL_LOG("! ((19 == inOutValue.size()) && (expected first line == inOutValue[0]) && (expected last line == inOutValue[18]))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestMIMELineLayout
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 008 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestMIMEBadCharacterInLine
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        StdStringVector inOutValue;
+        ByteVector      inValue;
+        ByteVector      outValue;
+
+        for (int ii = 0; ii < 200; ++ii)
+        {
+            inValue.push_back(StaticCast(uint8_t, ii));
+        }
+        EncodeBytesAsMIME(inOutValue, inValue.data(), inValue.size());
+        // Characters with the high bit set, or that are just outside the MIME ranges, must be rejected anywhere in a line.
+        result = 0;
+        for (char badChar : {'\x80', '\xFF', '@', '[', '`', '{', ':', '*', '.', ' '})
+        {
+            for (size_t ii = 0; ii < inOutValue[1].length(); ii += 5)
+            {
+                StdStringVector badValue{inOutValue};
+
+                badValue[1][ii] = badChar;
+                if (DecodeMIMEToBytes(badValue, outValue))
+                {
+                    ODL_LOG("(DecodeMIMEToBytes(badValue, outValue))"); //####
+                    result = 1;
+                    break;
+
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestMIMEBadCharacterInLine
+
 #if defined(__APPLE__)
 # pragma mark *** Test Case 100 ***
 #endif // defined(__APPLE__)
@@ -7258,59 +7538,1960 @@ doTestMIMExtractWithBadCharacters
 } // doTestMIMExtractWithBadCharacters
 
 #if defined(__APPLE__)
-# pragma mark Global functions
+# pragma mark *** Test Case 800 ***
 #endif // defined(__APPLE__)
 
-/*! @brief The entry point for unit tests of the %nImO common classes.
-
- The first argument is the test number, the second argument is the name of the channel to be used
- with the test, the optional third argument is the machine to connect to and the optional fourth
- argument is the port number to be used. Output depends on the test being run.
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
  @param[in] argc The number of arguments in 'argv'.
- @param[in] argv The arguments to be used with the unit tests.
- @return @c 0 on a successful test and @c 1 on failure. */
-int
-main
-    (int            argc,
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestFrameRoundTrip
+    (CPtr(char)     launchPath,
+     const int      argc,
      Ptr(Ptr(char)) argv)
 {
-    std::string progName{*argv};
-    int         result{1};
-
-    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
-             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
-             kODLoggingOptionWriteToStderr); //####
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
     ODL_ENTER(); //####
-    nImO::Initialize();
-    nImO::ReportVersions();
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
     try
     {
-        nImO::TestContext   ourContext{};
+        auto    stuff{std::make_shared<Array>()};
+        auto    aMap{std::make_shared<Map>()};
 
-        if (0 < --argc)
+        aMap->addValue(std::make_shared<String>("alpha"s), std::make_shared<Integer>(-12345));
+        aMap->addValue(std::make_shared<String>("beta"s), std::make_shared<Double>(1234.5));
+        stuff->addValue(std::make_shared<Logical>(true));
+        stuff->addValue(std::make_shared<String>("abcdefghijklmnopqrstuvwxyz"s));
+        stuff->addValue(aMap);
+        for (int64_t ii = 1; ii < 100000000000000000; ii *= 10)
         {
-            int64_t selector;
+            stuff->addValue(std::make_shared<Integer>(ii));
+        }
+        result = frameValueAndCheck(stuff, false);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
 
-            if (ConvertToInt64(argv[1], selector) && (0 < selector))
-            {
-                SetSignalHandlers(catchSignal);
-                switch (selector)
-                {
-                    case 1 :
-                        result = doTestMIMEBytesMod3Is0(*argv, argc - 1, argv + 2);
-                        break;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestFrameRoundTrip
 
-                    case 2 :
-                        result = doTestMIMEBytesMod3Is1(*argv, argc - 1, argv + 2);
-                        break;
+#if defined(__APPLE__)
+# pragma mark *** Test Case 801 ***
+#endif // defined(__APPLE__)
 
-                    case 3 :
-                        result = doTestMIMEBytesMod3Is2(*argv, argc - 1, argv + 2);
-                        break;
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestFrameRoundTripWithChecksum
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
 
-                    case 4 :
-                        result = doTestMIMEBytesMod3Is0Packaged(*argv, argc - 1, argv + 2);
-                        break;
+    try
+    {
+        auto    stuff{std::make_shared<Array>()};
+        auto    aMap{std::make_shared<Map>()};
+        uint8_t knownData[]{'W', 'i', 'k', 'i', 'p', 'e', 'd', 'i', 'a'};
+
+        aMap->addValue(std::make_shared<String>("alpha"s), std::make_shared<Integer>(-12345));
+        aMap->addValue(std::make_shared<String>("beta"s), std::make_shared<Double>(1234.5));
+        stuff->addValue(std::make_shared<Logical>(true));
+        stuff->addValue(std::make_shared<String>("abcdefghijklmnopqrstuvwxyz"s));
+        stuff->addValue(aMap);
+        for (int64_t ii = 1; ii < 100000000000000000; ii *= 10)
+        {
+            stuff->addValue(std::make_shared<Integer>(ii));
+        }
+        // The checksum is Adler-32, so a well-known value can be used to check it.
+        if (0x11E60398 == ComputeFrameChecksum(knownData, sizeof(knownData)))
+        {
+            result = frameValueAndCheck(stuff, true);
+        }
+        else
+        {
+            ODL_LOG("! (0x11E60398 == ComputeFrameChecksum(knownData, sizeof(knownData)))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestFrameRoundTripWithChecksum
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 802 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestFrameWithBadChecksum
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto            framed{PackageMessageAsFrame("some message bytes"s, true)};
+        CPtr(uint8_t)   body;
+        size_t          bodyLength;
+
+        // Change a byte of the body, which should be caught by the checksum.
+        (*framed)[kFrameHeaderSize + kFrameChecksumSize + 2] ^= 0x10;
+        if (UnpackageFrame(ReinterpretCast(CPtr(uint8_t), framed->data()), framed->length(), body, bodyLength))
+        {
+            ODL_LOG("(UnpackageFrame(ReinterpretCast(CPtr(uint8_t), framed->data()), framed->length(), body, bodyLength))"); //####
+        }
+        else
+        {
+            result = 0;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestFrameWithBadChecksum
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 803 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestFrameWithBadHeader
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto            framed{PackageMessageAsFrame("some message bytes"s, false)};
+        CPtr(uint8_t)   frameStart{ReinterpretCast(CPtr(uint8_t), framed->data())};
+        CPtr(uint8_t)   body;
+        size_t          bodyLength;
+        size_t          remainingLength;
+
+        // A truncated frame, a bad marker, unknown flags and an excessive length must all be rejected.
+        if (UnpackageFrame(frameStart, framed->length() - 1, body, bodyLength))
+        {
+            ODL_LOG("(UnpackageFrame(frameStart, framed->length() - 1, body, bodyLength))"); //####
+        }
+        else
+        {
+            std::string badHeader{framed->substr(0, kFrameHeaderSize)};
+
+            badHeader[0] = '\0';
+            if (UnpackageFrameHeader(ReinterpretCast(CPtr(uint8_t), badHeader.data()), remainingLength))
+            {
+                ODL_LOG("(UnpackageFrameHeader(ReinterpretCast(CPtr(uint8_t), badHeader.data()), remainingLength))"); //####
+            }
+            else
+            {
+                badHeader[0] = StaticCast(char, kFrameMarker);
+                badHeader[1] = '\x80';
+                if (UnpackageFrameHeader(ReinterpretCast(CPtr(uint8_t), badHeader.data()), remainingLength))
+                {
+                    ODL_LOG("(UnpackageFrameHeader(ReinterpretCast(CPtr(uint8_t), badHeader.data()), remainingLength))"); //####
+                }
+                else
+                {
+                    badHeader[1] = '\0';
+                    badHeader[2] = '\x7F';
+                    if (UnpackageFrameHeader(ReinterpretCast(CPtr(uint8_t), badHeader.data()), remainingLength))
+                    {
+                        ODL_LOG("(UnpackageFrameHeader(ReinterpretCast(CPtr(uint8_t), badHeader.data()), remainingLength))"); //####
+                    }
+                    else
+                    {
+                        result = 0;
+                    }
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestFrameWithBadHeader
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 804 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestMessageSeparatorMatching
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        boost::asio::streambuf  buffer;
+        std::ostream            bufferStream{&buffer};
+        StdStringVector         firstLines{"QUJD"s, "REVG"s};
+        StdStringVector         secondLines{"R0hJ"s};
+        auto                    firstMessage{PackageMessage(firstLines)};
+        auto                    secondMessage{PackageMessage(secondLines)};
+
+        // Only part of the sentinel is present at first, then two Messages follow.
+        bufferStream << firstMessage->substr(0, firstMessage->length() - 1);
+        auto    begin{buffers_begin(buffer.data())};
+        auto    partial{MatchMessageSeparator(begin, buffers_end(buffer.data()))};
+        auto    expectedResume{StaticCast(std::ptrdiff_t, firstMessage->length() - kMessageSentinel.length())};
+
+        if ((! partial.second) && (expectedResume == (partial.first - begin)))
+        {
+            bufferStream << firstMessage->substr(firstMessage->length() - 1) << *secondMessage;
+            begin = buffers_begin(buffer.data());
+            auto    complete{MatchMessageSeparator(begin + expectedResume, buffers_end(buffer.data()))};
+
+            if (complete.second && (StaticCast(std::ptrdiff_t, firstMessage->length()) == (complete.first - begin)))
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! (complete.second && (StaticCast(std::ptrdiff_t, firstMessage->length()) == (complete.first - begin)))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! ((! partial.second) && (expectedResume == (partial.first - begin)))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestMessageSeparatorMatching
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 805 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestMessageBurstInOneRead
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        boost::asio::io_context     service;
+        BTCP::acceptor              acceptor{service, BTCP::endpoint{BAIP::address_v4::loopback(), 0}};
+        BTCP::socket                sender{service};
+        BTCP::socket                receiver{service};
+        boost::asio::streambuf      receiveBuffer;
+        std::string                 burst;
+        std::vector<ByteVector>     sentBytes;
+
+        sender.connect(acceptor.local_endpoint());
+        acceptor.accept(receiver);
+        // Several Messages are written at once, as when a burst arrives in one TCP segment.
+        for (int ii = 0; ii < 5; ++ii)
+        {
+            ByteVector      someBytes;
+            StdStringVector outVec;
+
+            for (int jj = 0; jj < (ii * 37) + 1; ++jj)
+            {
+                someBytes.push_back(StaticCast(uint8_t, nImO::RandomUnsigned()));
+            }
+            EncodeBytesAsMIME(outVec, someBytes.data(), someBytes.size());
+            burst += *PackageMessage(outVec);
+            sentBytes.push_back(someBytes);
+        }
+        boost::asio::write(sender, boost::asio::buffer(burst));
+        result = 0;
+        for (auto & expected : sentBytes)
+        {
+            auto        size{boost::asio::read_until(receiver, receiveBuffer, MatchMessageSeparator)};
+            auto        received{buffers_begin(receiveBuffer.data())};
+            std::string receivedAsString{received, received + size};
+            ByteVector  outBytes;
+
+            receiveBuffer.consume(size);
+            if ((! DecodeMIMEToBytes(UnpackageMessage(receivedAsString), outBytes)) || (expected != outBytes))
+            {
+                ODL_LOG("((! DecodeMIMEToBytes(UnpackageMessage(receivedAsString), outBytes)) || (expected != outBytes))"); //####
+                result = 1;
+                break;
+
+            }
+        }
+        if ((0 == result) && (0 != receiveBuffer.size()))
+        {
+            ODL_LOG("((0 == result) && (0 != receiveBuffer.size()))"); //####
+            result = 1;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestMessageBurstInOneRead
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 806 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestSinglePassPackaging
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{0};
+
+    try
+    {
+        // Cover empty input, partial final groups and lines that end exactly on a line boundary.
+        for (size_t length = 0; (0 == result) && (length < 300); ++length)
+        {
+            std::string     messageBytes{};
+            StdStringVector outVec{};
+            std::string     joined{};
+
+            for (size_t ii = 0; ii < length; ++ii)
+            {
+                messageBytes.push_back(StaticCast(char, (ii * 37) + length));
+            }
+            EncodeBytesAsMIME(outVec, messageBytes);
+            for (size_t ii = 0; ii < outVec.size(); ++ii)
+            {
+                if (0 < ii)
+                {
+                    joined += "\n"s;
+                }
+                joined += outVec[ii];
+            }
+            auto    withSentinel{PackageMessage(messageBytes)};
+            auto    withoutSentinel{PackageMessage(messageBytes, false)};
+
+            if (joined.length() != MIMEEncodedLength(length))
+            {
+                ODL_LOG("(joined.length() != MIMEEncodedLength(length))"); //####
+                result = 1;
+            }
+            else
+            {
+                if (*withSentinel != *PackageMessage(outVec))
+                {
+                    ODL_LOG("(*withSentinel != *PackageMessage(outVec))"); //####
+                    result = 1;
+                }
+                else
+                {
+                    if (*withoutSentinel != joined)
+                    {
+                        ODL_LOG("(*withoutSentinel != joined)"); //####
+                        result = 1;
+                    }
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestSinglePassPackaging
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 807 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestTransmissionBufferReuse
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto                firstBuffer{GetTransmissionBuffer(1000)};
+        CPtr(std::string)   firstAddress{firstBuffer.get()};
+
+        firstBuffer->assign(500, 'x');
+        firstBuffer.reset();
+        auto    secondBuffer{GetTransmissionBuffer(100)};
+
+        // A released buffer is handed out again, emptied but with its storage kept.
+        if ((firstAddress == secondBuffer.get()) && secondBuffer->empty() && (1000 <= secondBuffer->capacity()))
+        {
+            auto                largeBuffer{GetTransmissionBuffer(kTransmissionBufferMaximumCapacity + 1)};
+            CPtr(std::string)   largeAddress{largeBuffer.get()};
+
+            largeBuffer.reset();
+            auto    thirdBuffer{GetTransmissionBuffer(100)};
+
+            // A buffer that has grown too large is not kept.
+            if ((largeAddress != thirdBuffer.get()) || (kTransmissionBufferMaximumCapacity >= thirdBuffer->capacity()))
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! ((largeAddress != thirdBuffer.get()) || (kTransmissionBufferMaximumCapacity >= thirdBuffer->capacity()))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! ((firstAddress == secondBuffer.get()) && secondBuffer->empty() && (1000 <= secondBuffer->capacity()))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestTransmissionBufferReuse
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 808 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestUnpackageFromReceiveBuffer
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        std::string             firstBytes(200, 'a');
+        std::string             secondBytes{"xyz"s};
+        auto                    firstMessage{PackageMessage(firstBytes)};
+        auto                    secondMessage{PackageMessage(secondBytes)};
+        boost::asio::streambuf  buffer;
+        std::ostream            bufferStream{&buffer};
+        ByteVector              decoded{};
+
+        // The second Message is still in the buffer when the first is decoded.
+        bufferStream << *firstMessage << *secondMessage;
+        auto    received{StaticCast(CPtr(char), buffer.data().data())};
+
+        if (UnpackageMessage(received, firstMessage->length(), decoded) &&
+            (std::string(decoded.begin(), decoded.end()) == firstBytes))
+        {
+            CPtr(uint8_t)   firstStorage{decoded.data()};
+
+            buffer.consume(firstMessage->length());
+            received = StaticCast(CPtr(char), buffer.data().data());
+            // The storage from the first Message is reused for the smaller second Message.
+            if (UnpackageMessage(received, secondMessage->length(), decoded) &&
+                (std::string(decoded.begin(), decoded.end()) == secondBytes) && (firstStorage == decoded.data()))
+            {
+                if (UnpackageMessage(received, kMessageSentinel.length(), decoded))
+                {
+                    ODL_LOG("(UnpackageMessage(received, kMessageSentinel.length(), decoded))"); //####
+                }
+                else
+                {
+                    result = 0;
+                }
+            }
+            else
+            {
+                ODL_LOG("! (UnpackageMessage(received, secondMessage->length(), decoded) && " //####
+                        "(std::string(decoded.begin(), decoded.end()) == secondBytes) && " //####
+                        "(firstStorage == decoded.data()))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (UnpackageMessage(received, firstMessage->length(), decoded) && " //####
+                    "(std::string(decoded.begin(), decoded.end()) == firstBytes))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestUnpackageFromReceiveBuffer
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 809 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestCompressionRoundTrip
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{0};
+
+    try
+    {
+        std::string cloud{};
+
+        // A grid of points, as in a point cloud, repeats most of its bytes from point to point.
+        for (int xx = 0; xx < 40; ++xx)
+        {
+            for (int yy = 0; yy < 40; ++yy)
+            {
+                float   point[3]{0.25F * xx, 0.25F * yy, 1.5F};
+
+                cloud.append(ReinterpretCast(CPtr(char), point), sizeof(point));
+            }
+        }
+        result = compressBytesAndCheck(std::string(5000, '\0'), true);
+        if (0 == result)
+        {
+            result = compressBytesAndCheck(cloud, true);
+        }
+        // Short inputs, and inputs that end in the middle of a match, are not always made smaller.
+        for (size_t length = 0; (0 == result) && (length < 100); ++length)
+        {
+            std::string data{};
+
+            for (size_t ii = 0; ii < length; ++ii)
+            {
+                data.push_back(StaticCast(char, 'a' + ((ii * ii) % 5)));
+            }
+            result = compressBytesAndCheck(data, false);
+        }
+        if (0 == result)
+        {
+            auto            blobValue{std::make_shared<Blob>(ReinterpretCast(CPtr(uint8_t), cloud.data()), cloud.length())};
+            Message         outMessage;
+            std::string     compressed{};
+
+            outMessage.open(true);
+            outMessage.setValue(blobValue);
+            outMessage.close();
+            auto    asString{outMessage.getString()};
+
+            result = 1;
+            if (CompressMessageBytes(ReinterpretCast(CPtr(uint8_t), asString.data()), asString.length(), compressed) &&
+                IsCompressedMessage(ReinterpretCast(CPtr(uint8_t), compressed.data()), compressed.length()))
+            {
+                ByteVector  expanded{};
+
+                if (ExpandMessageBytes(ReinterpretCast(CPtr(uint8_t), compressed.data()), compressed.length(), expanded))
+                {
+                    Message inMessage;
+
+                    inMessage.open(false);
+                    inMessage.appendBytes(expanded.data(), expanded.size());
+                    auto    extractedValue{inMessage.getValue()};
+
+                    inMessage.close();
+                    if (extractedValue && (nullptr == extractedValue->asFlaw()) && extractedValue->deeplyEqualTo(*blobValue))
+                    {
+                        result = 0;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (extractedValue && (nullptr == extractedValue->asFlaw()) && " //####
+                                "extractedValue->deeplyEqualTo(*blobValue))"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (ExpandMessageBytes(ReinterpretCast(CPtr(uint8_t), compressed.data()), compressed.length(), expanded))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (CompressMessageBytes(ReinterpretCast(CPtr(uint8_t), asString.data()), asString.length(), compressed) && " //####
+                        "IsCompressedMessage(ReinterpretCast(CPtr(uint8_t), compressed.data()), compressed.length()))"); //####
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestCompressionRoundTrip
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 810 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestCompressionOfIncompressibleData
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        std::string data{};
+        std::string compressed{};
+        uint32_t    seed{12345};
+
+        for (size_t ii = 0; ii < 4000; ++ii)
+        {
+            seed = (seed * 1103515245) + 12345;
+            data.push_back(StaticCast(char, seed >> 16));
+        }
+        if (CompressMessageBytes(ReinterpretCast(CPtr(uint8_t), data.data()), data.length(), compressed))
+        {
+            ODL_LOG("(CompressMessageBytes(ReinterpretCast(CPtr(uint8_t), data.data()), data.length(), compressed))"); //####
+        }
+        else
+        {
+            result = 0;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestCompressionOfIncompressibleData
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 811 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestCompressedMessageWithBadData
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        std::string data{};
+        std::string compressed{};
+        ByteVector  expanded{};
+
+        for (size_t ii = 0; ii < 1000; ++ii)
+        {
+            data.push_back(StaticCast(char, 'a' + (ii % 7)));
+        }
+        if (CompressMessageBytes(ReinterpretCast(CPtr(uint8_t), data.data()), data.length(), compressed))
+        {
+            std::string truncated{compressed.substr(0, compressed.length() - 1)};
+            std::string wrongLength{compressed};
+            std::string badOffset{compressed};
+
+            ++wrongLength[kCompressedMessageHeaderSize - 1];
+            // The first sequence has seven literals, so its match can not reach back further than that.
+            badOffset[kCompressedMessageHeaderSize + 1 + 7] = 100;
+            bool    anyExpanded{ExpandMessageBytes(ReinterpretCast(CPtr(uint8_t), truncated.data()), truncated.length(), expanded) ||
+                                ExpandMessageBytes(ReinterpretCast(CPtr(uint8_t), wrongLength.data()), wrongLength.length(), expanded) ||
+                                ExpandMessageBytes(ReinterpretCast(CPtr(uint8_t), badOffset.data()), badOffset.length(), expanded) ||
+                                ExpandMessageBytes(ReinterpretCast(CPtr(uint8_t), compressed.data()), 3, expanded)};
+
+            if (anyExpanded)
+            {
+                ODL_LOG("(anyExpanded)"); //####
+            }
+            else
+            {
+                result = 0;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (CompressMessageBytes(ReinterpretCast(CPtr(uint8_t), data.data()), data.length(), compressed))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestCompressedMessageWithBadData
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 812 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestStreamedResponseBatches
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        GetInformationForAllChannelsResponseHandler handler{};
+        size_t                                      numChannels{(2 * kStreamedResponseBatchSize) + 3};
+        size_t                                      sent{0};
+        bool                                        okSoFar{handler.acceptsStreamedResponse()};
+
+        // Deliver the channels the way that a streamed response arrives, one batch at a time.
+        for ( ; okSoFar && (sent < numChannels); )
+        {
+            auto    batchArray{std::make_shared<Array>()};
+            auto    responseArray{std::make_shared<Array>()};
+
+            for (size_t ii = 0; (ii < kStreamedResponseBatchSize) && (sent < numChannels); ++ii, ++sent)
+            {
+                auto    infoArray{std::make_shared<Array>()};
+
+                infoArray->addValue(std::make_shared<Logical>(true));
+                infoArray->addValue(std::make_shared<String>("node"s));
+                infoArray->addValue(std::make_shared<String>("/channel/"s + std::to_string(sent)));
+                infoArray->addValue(std::make_shared<Logical>(0 == (sent % 2)));
+                infoArray->addValue(std::make_shared<String>("i+"s));
+                infoArray->addValue(std::make_shared<Integer>(1));
+                infoArray->addValue(std::make_shared<Logical>(false));
+                batchArray->addValue(infoArray);
+            }
+            responseArray->addValue(std::make_shared<String>(kGetInformationForAllChannelsResponse));
+            responseArray->addValue(batchArray);
+            responseArray->addValue(std::make_shared<Logical>(sent < numChannels));
+            okSoFar = handler.doIt(*responseArray);
+        }
+        if (okSoFar)
+        {
+            auto &  channels{handler.result()};
+
+            if (numChannels == channels.size())
+            {
+                result = 0;
+                for (size_t ii = 0; (0 == result) && (ii < numChannels); ++ii)
+                {
+                    if (("/channel/"s + std::to_string(ii)) != channels[ii]._path)
+                    {
+                        ODL_LOG("((\"/channel/\"s + std::to_string(ii)) != channels[ii]._path)"); //####
+                        result = 1;
+                    }
+                }
+            }
+            else
+            {
+                ODL_LOG("! (numChannels == channels.size())"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (okSoFar)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestStreamedResponseBatches
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 813 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestSharedMemoryRingRoundTrip
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        SharedMemoryRing    reader{SharedMemoryRing::MakeName(), true};
+        SharedMemoryRing    writer{reader.getName(), false};
+
+        if (reader.isOpen() && writer.isOpen())
+        {
+            ByteVector  received;
+            size_t      totalBytes{0};
+
+            result = 0;
+            // Enough is sent that the positions wrap around the ring more than once.
+            for (size_t ii = 0; (0 == result) && (totalBytes < (2 * kSharedMemoryRingCapacity)); ++ii)
+            {
+                ByteVector  sent(((ii * 7919) % 65536) + 1);
+
+                for (size_t jj = 0; jj < sent.size(); ++jj)
+                {
+                    sent[jj] = StaticCast(uint8_t, ii + jj);
+                }
+                if (writer.writeMessage(sent.data(), sent.size()) && reader.readMessage(received))
+                {
+                    if (sent != received)
+                    {
+                        ODL_LOG("(sent != received)"); //####
+                        result = 1;
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (writer.writeMessage(sent.data(), sent.size()) && reader.readMessage(received))"); //####
+                    result = 1;
+                }
+                totalBytes += sent.size();
+            }
+        }
+        else
+        {
+            ODL_LOG("! (reader.isOpen() && writer.isOpen())"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestSharedMemoryRingRoundTrip
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 814 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestSharedMemoryRingLargeMessage
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        SharedMemoryRing    reader{SharedMemoryRing::MakeName(), true};
+        SharedMemoryRing    writer{reader.getName(), false};
+
+        if (reader.isOpen() && writer.isOpen())
+        {
+            ByteVector  sent((3 * kSharedMemoryRingCapacity) + 17);
+            ByteVector  received;
+            bool        readOK{false};
+
+            for (size_t ii = 0; ii < sent.size(); ++ii)
+            {
+                sent[ii] = StaticCast(uint8_t, (ii * 31) + (ii >> 12));
+            }
+            // The Message does not fit in the ring, so it can only pass through while it is being read.
+            boost::thread   readerThread{[&reader, &received, &readOK]
+                                         (void)
+                                         {
+                                            readOK = reader.readMessage(received);
+                                         }};
+
+            if (writer.writeMessage(sent.data(), sent.size()))
+            {
+                readerThread.join();
+                if (readOK && (sent == received))
+                {
+                    // A Message longer than the protocol allows must be refused without closing the ring.
+                    sent.resize(kFrameMaximumLength + 1);
+                    if (writer.writeMessage(sent.data(), sent.size()))
+                    {
+                        ODL_LOG("(writer.writeMessage(sent.data(), sent.size()))"); //####
+                    }
+                    else
+                    {
+                        if (writer.writeMessage(sent.data(), 1) && reader.readMessage(received) && (1 == received.size()))
+                        {
+                            result = 0;
+                        }
+                        else
+                        {
+                            ODL_LOG("! (writer.writeMessage(sent.data(), 1) && reader.readMessage(received) && (1 == received.size()))"); //####
+                        }
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (readOK && (sent == received))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (writer.writeMessage(sent.data(), sent.size()))"); //####
+                reader.close();
+                readerThread.join();
+            }
+        }
+        else
+        {
+            ODL_LOG("! (reader.isOpen() && writer.isOpen())"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestSharedMemoryRingLargeMessage
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 815 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestSharedMemoryRingClosed
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        SharedMemoryRing    reader{SharedMemoryRing::MakeName(), true};
+        SharedMemoryRing    writer{reader.getName(), false};
+        SharedMemoryRing    secondWriter{reader.getName(), false};
+
+        // The name is removed once a writer has attached, so nothing else can attach to the ring.
+        if (reader.isOpen() && writer.isOpen() && (! secondWriter.isOpen()))
+        {
+            ByteVector  sent(kSharedMemoryRingCapacity / 2);
+            ByteVector  received;
+
+            // A Message written before the ring is closed can still be read, but nothing more is passed and neither side waits.
+            if (writer.writeMessage(sent.data(), sent.size()))
+            {
+                writer.close();
+                if (reader.readMessage(received) && (sent == received) && (! reader.readMessage(received)) &&
+                    (! writer.writeMessage(sent.data(), sent.size())))
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (reader.readMessage(received) && (sent == received) && (! reader.readMessage(received)) && " //####
+                            "(! writer.writeMessage(sent.data(), sent.size())))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (writer.writeMessage(sent.data(), sent.size()))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (reader.isOpen() && writer.isOpen() && (! secondWriter.isOpen()))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestSharedMemoryRingClosed
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 816 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestDatagramFragmentsRoundTrip
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        std::string                 sent((20 * kFragmentMaximumLength) + 17, ' ');
+        std::vector<SpStdString>    fragments;
+
+        for (size_t ii = 0; ii < sent.length(); ++ii)
+        {
+            sent[ii] = StaticCast(char, (ii * 31) + (ii >> 10));
+        }
+        if (SplitDatagram(sent, 42, fragments) && (1 < fragments.size()))
+        {
+            DatagramReassembler reassembler;
+            ByteVector          received;
+            size_t              completions{0};
+
+            result = 0;
+            // The fragments arrive in reverse order and the second one to arrive, the next-to-last fragment, arrives twice.
+            for (size_t ii = fragments.size(); (0 == result) && (0 < ii); --ii)
+            {
+                auto    fragment{fragments[ii - 1]};
+
+                if (kFragmentMaximumLength < fragment->length())
+                {
+                    ODL_LOG("(kFragmentMaximumLength < fragment->length())"); //####
+                    result = 1;
+                }
+                else
+                {
+                    if (reassembler.addFragment(0x7F000001, 1234, ReinterpretCast(CPtr(uint8_t), fragment->data()), fragment->length(),
+                                                received))
+                    {
+                        ++completions;
+                    }
+                    if ((fragments.size() - 1) == ii)
+                    {
+                        if (reassembler.addFragment(0x7F000001, 1234, ReinterpretCast(CPtr(uint8_t), fragment->data()),
+                                                    fragment->length(), received))
+                        {
+                            ++completions;
+                        }
+                    }
+                }
+            }
+            if ((0 == result) && (1 == completions) && (0 == reassembler.getPendingCount()) &&
+                (std::string(received.begin(), received.end()) == sent))
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! ((0 == result) && (1 == completions) && (0 == reassembler.getPendingCount()) && " //####
+                        "(std::string(received.begin(), received.end()) == sent))"); //####
+                result = 1;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (SplitDatagram(sent, 42, fragments) && (1 < fragments.size()))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestDatagramFragmentsRoundTrip
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 817 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestDatagramReassemblyTableLimit
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        std::string                 sent(3 * kFragmentMaximumLength, 'x');
+        std::vector<SpStdString>    first;
+        std::vector<SpStdString>    second;
+        std::vector<SpStdString>    third;
+
+        if (SplitDatagram(sent, 1, first) && SplitDatagram(sent, 2, second) && SplitDatagram(sent, 3, third))
+        {
+            DatagramReassembler reassembler{2};
+            ByteVector          received;
+            bool                okSoFar{true};
+
+            // Only two partial datagrams are kept, so the first one is dropped when the third one starts.
+            okSoFar &= (! reassembler.addFragment(0x7F000001, 1234, ReinterpretCast(CPtr(uint8_t), first[0]->data()),
+                                                  first[0]->length(), received));
+            okSoFar &= (! reassembler.addFragment(0x7F000001, 1234, ReinterpretCast(CPtr(uint8_t), second[0]->data()),
+                                                  second[0]->length(), received));
+            okSoFar &= (! reassembler.addFragment(0x7F000001, 1234, ReinterpretCast(CPtr(uint8_t), third[0]->data()),
+                                                  third[0]->length(), received));
+            okSoFar &= (2 == reassembler.getPendingCount());
+            for (size_t ii = 1; okSoFar && (ii < third.size()); ++ii)
+            {
+                bool    isLast{(third.size() - 1) == ii};
+
+                okSoFar = (isLast == reassembler.addFragment(0x7F000001, 1234, ReinterpretCast(CPtr(uint8_t), third[ii]->data()),
+                                                             third[ii]->length(), received));
+            }
+            okSoFar &= (std::string(received.begin(), received.end()) == sent);
+            // The remaining fragments of the first datagram start a new partial datagram that can never be completed.
+            for (size_t ii = 1; okSoFar && (ii < first.size()); ++ii)
+            {
+                okSoFar = (! reassembler.addFragment(0x7F000001, 1234, ReinterpretCast(CPtr(uint8_t), first[ii]->data()),
+                                                     first[ii]->length(), received));
+            }
+            // The same datagram identifier from a different sender is a different datagram.
+            okSoFar &= (! reassembler.addFragment(0x7F000002, 1234, ReinterpretCast(CPtr(uint8_t), second[1]->data()),
+                                                  second[1]->length(), received));
+            okSoFar &= (2 == reassembler.getPendingCount());
+            if (okSoFar)
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! (okSoFar)"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (SplitDatagram(sent, 1, first) && SplitDatagram(sent, 2, second) && SplitDatagram(sent, 3, third))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestDatagramReassemblyTableLimit
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 818 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestDatagramReassemblyTimeoutAndBadFragments
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        std::string                 sent(2 * kFragmentMaximumLength, 'y');
+        std::string                 tooLarge(kFragmentedDatagramMaximumLength + 1, 'z');
+        std::vector<SpStdString>    fragments;
+        std::vector<SpStdString>    unused;
+
+        if (SplitDatagram(sent, 7, fragments) && (! SplitDatagram(tooLarge, 8, unused)) && unused.empty())
+        {
+            DatagramReassembler reassembler{kFragmentReassemblyTableSize, 1};
+            ByteVector          received;
+            std::string         shortened{*fragments[0], 0, fragments[0]->length() - 1};
+            bool                okSoFar{true};
+
+            // Only the last fragment can be shorter than the others.
+            okSoFar &= (! reassembler.addFragment(0x7F000001, 1234, ReinterpretCast(CPtr(uint8_t), shortened.data()),
+                                                  shortened.length(), received));
+            okSoFar &= (0 == reassembler.getPendingCount());
+            // A partial datagram that waits too long for the rest of its fragments is dropped.
+            okSoFar &= (! reassembler.addFragment(0x7F000001, 1234, ReinterpretCast(CPtr(uint8_t), fragments[0]->data()),
+                                                  fragments[0]->length(), received));
+            boost::this_thread::sleep_for(boost::chrono::milliseconds(20));
+            for (size_t ii = 1; okSoFar && (ii < fragments.size()); ++ii)
+            {
+                okSoFar = (! reassembler.addFragment(0x7F000001, 1234, ReinterpretCast(CPtr(uint8_t), fragments[ii]->data()),
+                                                     fragments[ii]->length(), received));
+            }
+            okSoFar &= (1 == reassembler.getPendingCount());
+            if (okSoFar)
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! (okSoFar)"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (SplitDatagram(sent, 7, fragments) && (! SplitDatagram(tooLarge, 8, unused)) && unused.empty())"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestDatagramReassemblyTimeoutAndBadFragments
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 819 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestFrameWithMaximumLength
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        std::string largest(kFrameMaximumLength, 'x');
+        auto        framed{PackageMessageAsFrame(largest, true)};
+
+        // The largest Message that the receiver accepts must be framed, but one more byte must be refused.
+        if (nullptr == framed)
+        {
+            ODL_LOG("(nullptr == framed)"); //####
+        }
+        else
+        {
+            CPtr(uint8_t)   body;
+            size_t          bodyLength;
+
+            if (UnpackageFrame(ReinterpretCast(CPtr(uint8_t), framed->data()), framed->length(), body, bodyLength) &&
+                (largest.length() == bodyLength))
+            {
+                largest.push_back('x');
+                if (nullptr == PackageMessageAsFrame(largest, false))
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (nullptr == PackageMessageAsFrame(largest, false))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (UnpackageFrame(ReinterpretCast(CPtr(uint8_t), framed->data()), framed->length(), body, bodyLength) && " //####
+                        "(largest.length() == bodyLength))"); //####
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestFrameWithMaximumLength
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 820 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestFrameFilledInPlace
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        Message outMessage;
+        auto    shortBuffer{GetTransmissionBuffer(kFrameHeaderSize)};
+
+        // The Value is large enough that the Message bytes are spread over several chunks.
+        outMessage.open(true);
+        outMessage.setValue(std::make_shared<String>(std::string(3 * BufferChunk::kBufferSize, 'q')));
+        outMessage.close();
+        auto    asString{outMessage.getString()};
+        int     numMatched{0};
+
+        for (int ii = 0; 2 > ii; ++ii)
+        {
+            bool    addChecksum{0 != ii};
+            auto    expected{PackageMessageAsFrame(asString, addChecksum)};
+            auto    framed{GetTransmissionBuffer(FrameHeaderLength(addChecksum) + asString.length())};
+
+            framed->resize(FrameHeaderLength(addChecksum));
+            if (outMessage.copyBytesTo(*framed) && FillInFrameHeader(*framed, addChecksum) && (*expected == *framed))
+            {
+                ++numMatched;
+            }
+            else
+            {
+                ODL_LOG("! (outMessage.copyBytesTo(*framed) && FillInFrameHeader(*framed, addChecksum) && (*expected == *framed))"); //####
+            }
+        }
+        if (2 == numMatched)
+        {
+            // A buffer without room for the header cannot be framed.
+            shortBuffer->resize(kFrameHeaderSize - 1);
+            if (FillInFrameHeader(*shortBuffer, false))
+            {
+                ODL_LOG("(FillInFrameHeader(*shortBuffer, false))"); //####
+            }
+            else
+            {
+                result = 0;
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestFrameFilledInPlace
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 821 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestCompressionWithMaximumLength
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        std::string largest(kCompressedMessageMaximumLength, 'x');
+
+        // The largest Message that the receiver can expand must be compressed, but one more byte must be refused.
+        if (0 == compressBytesAndCheck(largest, true))
+        {
+            std::string compressed{};
+
+            largest.push_back('x');
+            if (CompressMessageBytes(ReinterpretCast(CPtr(uint8_t), largest.data()), largest.length(), compressed))
+            {
+                ODL_LOG("(CompressMessageBytes(ReinterpretCast(CPtr(uint8_t), largest.data()), largest.length(), compressed))"); //####
+            }
+            else
+            {
+                result = 0;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (0 == compressBytesAndCheck(largest, true))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestCompressionWithMaximumLength
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 822 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestCompressedMessageWithDamagedBlocks
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        std::string data{};
+        std::string compressed{};
+        ByteVector  expanded{};
+        bool        okSoFar{true};
+
+        for (size_t ii = 0; ii < 4000; ++ii)
+        {
+            data.push_back(StaticCast(char, 'a' + ((ii * ii) % 11)));
+        }
+        if (CompressMessageBytes(ReinterpretCast(CPtr(uint8_t), data.data()), data.length(), compressed))
+        {
+            CPtr(uint8_t)   compressedStart{ReinterpretCast(CPtr(uint8_t), compressed.data())};
+
+            // Every shorter piece of the compressed Message must be rejected.
+            for (size_t ii = 0; okSoFar && (ii < compressed.length()); ++ii)
+            {
+                if (ExpandMessageBytes(compressedStart, ii, expanded))
+                {
+                    ODL_LOG("(ExpandMessageBytes(compressedStart, ii, expanded))"); //####
+                    okSoFar = false;
+                }
+            }
+            // A damaged byte can go unnoticed, but must never produce the wrong number of bytes.
+            for (size_t ii = 1; okSoFar && (ii < compressed.length()); ++ii)
+            {
+                for (uint8_t mask : {0x01, 0x80, 0xFF})
+                {
+                    std::string damaged{compressed};
+
+                    damaged[ii] ^= StaticCast(char, mask);
+                    if (ExpandMessageBytes(ReinterpretCast(CPtr(uint8_t), damaged.data()), damaged.length(), expanded) &&
+                        (data.length() != expanded.size()))
+                    {
+                        ODL_LOG("(ExpandMessageBytes(ReinterpretCast(CPtr(uint8_t), damaged.data()), damaged.length(), expanded) && " //####
+                                "(data.length() != expanded.size()))"); //####
+                        okSoFar = false;
+                    }
+                }
+            }
+        }
+        else
+        {
+            ODL_LOG("! (CompressMessageBytes(ReinterpretCast(CPtr(uint8_t), data.data()), data.length(), compressed))"); //####
+            okSoFar = false;
+        }
+        if (okSoFar)
+        {
+            std::string good{makeCompressedMessage(8, "\x40" "abcd" "\x04\x00"s)};
+
+            // Four literals and a four-byte match that exactly fills the Message.
+            if (ExpandMessageBytes(ReinterpretCast(CPtr(uint8_t), good.data()), good.length(), expanded) &&
+                ("abcdabcd"s == std::string(expanded.begin(), expanded.end())))
+            {
+                std::vector<std::pair<size_t, std::string>> badBlocks
+                {
+                    // A match one byte longer than the room left.
+                    { 8, "\x41" "abcd" "\x04\x00"s },
+                    // A match, with a continuation byte, much longer than the room left.
+                    { 8, "\x4F" "abcd" "\x04\x00\x10"s },
+                    // A match whose length continuation is missing.
+                    { 100, "\x4F" "abcd" "\x04\x00"s },
+                    // A match with no distance back.
+                    { 8, "\x40" "abcd" "\x00\x00"s },
+                    // A match that starts before the beginning of the Message.
+                    { 8, "\x40" "abcd" "\x05\x00"s },
+                    // A match whose distance back is cut short.
+                    { 8, "\x40" "abcd" "\x04"s },
+                    // More literals than the room left.
+                    { 4, "\x50" "abcde"s },
+                    // More literals than are present.
+                    { 8, "\x80" "abcd"s },
+                    // A literal length continuation that is missing.
+                    { 20, "\xF0"s },
+                    // A Message that would expand past the largest that is accepted.
+                    { kCompressedMessageMaximumLength + 1, "\x10" "a"s }
+                };
+
+                for (auto & walker : badBlocks)
+                {
+                    std::string bad{makeCompressedMessage(walker.first, walker.second)};
+
+                    if (ExpandMessageBytes(ReinterpretCast(CPtr(uint8_t), bad.data()), bad.length(), expanded))
+                    {
+                        ODL_LOG("(ExpandMessageBytes(ReinterpretCast(CPtr(uint8_t), bad.data()), bad.length(), expanded))"); //####
+                        okSoFar = false;
+                    }
+                }
+                if (okSoFar)
+                {
+                    result = 0;
+                }
+            }
+            else
+            {
+                ODL_LOG("! (ExpandMessageBytes(ReinterpretCast(CPtr(uint8_t), good.data()), good.length(), expanded) && " //####
+                        "(\"abcdabcd\"s == std::string(expanded.begin(), expanded.end())))"); //####
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestCompressedMessageWithDamagedBlocks
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 823 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestLostMessageWithKeyDefinition
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            auto            senderKeys{std::make_shared<KeyDictionary>()};
+            auto            receiverKeys{std::make_shared<KeyDictionary>()};
+            auto            aMap{std::make_shared<Map>()};
+            ReceiveQueue    queue{};
+            auto            encode{[&stuff, &aMap]
+                                    (void)
+                                    {
+                                        stuff->open(true);
+                                        stuff->setValue(aMap);
+                                        stuff->close();
+                                        return stuff->getString();
+                                    }};
+
+            aMap->addValue(std::make_shared<String>("status"), std::make_shared<String>(std::string(200, 'a')));
+            stuff->setKeyDictionary(senderKeys);
+            std::string defining{encode()};
+            std::string referring{encode()};
+            std::string compressed{};
+
+            if (CompressMessageBytes(ReinterpretCast(CPtr(uint8_t), defining.data()), defining.length(), compressed))
+            {
+                // The Message that defines the key can't be expanded, so the next Message refers to an unknown key.
+                compressed.pop_back();
+                bool    definitionLost{! queue.addBytesAsMessage(0, ReinterpretCast(CPtr(uint8_t), compressed.data()),
+                                                                 compressed.length(), receiverKeys)};
+                bool    referenceLost{! queue.addBytesAsMessage(0, ReinterpretCast(CPtr(uint8_t), referring.data()),
+                                                                referring.length(), receiverKeys)};
+
+                // Once both ends start again with empty dictionaries, the key is defined again.
+                senderKeys->reset();
+                receiverKeys->reset();
+                defining = encode();
+                referring = encode();
+                bool    definitionKept{queue.addBytesAsMessage(0, ReinterpretCast(CPtr(uint8_t), defining.data()),
+                                                               defining.length(), receiverKeys)};
+                bool    referenceKept{queue.addBytesAsMessage(0, ReinterpretCast(CPtr(uint8_t), referring.data()),
+                                                              referring.length(), receiverKeys)};
+
+                if (definitionLost && referenceLost && definitionKept && referenceKept)
+                {
+                    // Each Message was queued, so the last two are the ones that were kept.
+                    queue.getNextMessage();
+                    queue.getNextMessage();
+                    auto    first{queue.getNextMessage()};
+                    auto    second{queue.getNextMessage()};
+
+                    if (first && first->_receivedMessage && first->_receivedMessage->deeplyEqualTo(*aMap) && second &&
+                        second->_receivedMessage && second->_receivedMessage->deeplyEqualTo(*aMap))
+                    {
+                        result = 0;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (the kept Messages match the Map)"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (definitionLost && referenceLost && definitionKept && referenceKept)"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (CompressMessageBytes(ReinterpretCast(CPtr(uint8_t), defining.data()), " //####
+                        "defining.length(), compressed))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestLostMessageWithKeyDefinition
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+/*! @brief The entry point for unit tests of the %nImO common classes.
+
+ The first argument is the test number, the second argument is the name of the channel to be used
+ with the test, the optional third argument is the machine to connect to and the optional fourth
+ argument is the port number to be used. Output depends on the test being run.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used with the unit tests.
+ @return @c 0 on a successful test and @c 1 on failure. */
+int
+main
+    (int            argc,
+     Ptr(Ptr(char)) argv)
+{
+    std::string progName{*argv};
+    int         result{1};
+
+    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
+             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
+             kODLoggingOptionWriteToStderr); //####
+    ODL_ENTER(); //####
+    nImO::Initialize();
+    nImO::ReportVersions();
+    try
+    {
+        nImO::TestContext   ourContext{};
+
+        if (0 < --argc)
+        {
+            int64_t selector;
+
+            if (ConvertToInt64(argv[1], selector) && (0 < selector))
+            {
+                SetSignalHandlers(catchSignal);
+                switch (selector)
+                {
+                    case 1 :
+                        result = doTestMIMEBytesMod3Is0(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 2 :
+                        result = doTestMIMEBytesMod3Is1(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 3 :
+                        result = doTestMIMEBytesMod3Is2(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 4 :
+                        result = doTestMIMEBytesMod3Is0Packaged(*argv, argc - 1, argv + 2);
+                        break;
 
                     case 5 :
                         result = doTestMIMEBytesMod3Is1Packaged(*argv, argc - 1, argv + 2);
@@ -7320,6 +9501,14 @@ main
                         result = doTestMIMEBytesMod3Is2Packaged(*argv, argc - 1, argv + 2);
                         break;
 
+                    case 7 :
+                        result = doTestMIMELineLayout(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 8 :
+                        result = doTestMIMEBadCharacterInLine(*argv, argc - 1, argv + 2);
+                        break;
+
                     case 100 :
                         result = doTestMIMEInsertEmptyMessage(*argv, argc - 1, argv + 2);
                         break;
@@ -7800,6 +9989,102 @@ main
                         result = doTestMIMExtractWithBadCharacters(*argv, argc - 1, argv + 2);
                         break;
 
+                    case 800 :
+                        result = doTestFrameRoundTrip(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 801 :
+                        result = doTestFrameRoundTripWithChecksum(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 802 :
+                        result = doTestFrameWithBadChecksum(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 803 :
+                        result = doTestFrameWithBadHeader(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 804 :
+                        result = doTestMessageSeparatorMatching(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 805 :
+                        result = doTestMessageBurstInOneRead(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 806 :
+                        result = doTestSinglePassPackaging(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 807 :
+                        result = doTestTransmissionBufferReuse(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 808 :
+                        result = doTestUnpackageFromReceiveBuffer(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 809 :
+                        result = doTestCompressionRoundTrip(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 810 :
+                        result = doTestCompressionOfIncompressibleData(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 811 :
+                        result = doTestCompressedMessageWithBadData(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 812 :
+                        result = doTestStreamedResponseBatches(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 813 :
+                        result = doTestSharedMemoryRingRoundTrip(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 814 :
+                        result = doTestSharedMemoryRingLargeMessage(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 815 :
+                        result = doTestSharedMemoryRingClosed(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 816 :
+                        result = doTestDatagramFragmentsRoundTrip(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 817 :
+                        result = doTestDatagramReassemblyTableLimit(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 818 :
+                        result = doTestDatagramReassemblyTimeoutAndBadFragments(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 819 :
+                        result = doTestFrameWithMaximumLength(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 820 :
+                        result = doTestFrameFilledInPlace(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 821 :
+                        result = doTestCompressionWithMaximumLength(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 822 :
+                        result = doTestCompressedMessageWithDamagedBlocks(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 823 :
+                        result = doTestLostMessageWithKeyDefinition(*argv, argc - 1, argv + 2);
+                        break;
+
                     default :
                         break;
 
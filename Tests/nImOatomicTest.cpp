@@ -46,8 +46,10 @@
 #include <BasicTypes/nImOtime.h>
 #include <Containers/nImObufferChunk.h>
 #include <Containers/nImOstringBuffer.h>
+#include <Containers/nImOtextSink.h>
 #include <Contexts/nImOtestContext.h>
 
+#include <sstream>
 #include <string>
 
 //#include <odlEnable.h>
@@ -209,6 +211,79 @@ getIPv4Bytes
     return okSoFar;
 } // getIPv4Bytes
 
+/*! @brief Return the quoted form of a string, as StringBuffer::addString() should produce it.
+ Only the characters used by the tests of long strings are handled; these are printable ASCII
+ characters, tab, newline, the escape character, the two quote characters and one meta character.
+ @param[in] inString The string to be quoted.
+ @return The quoted form of the string. */
+static std::string
+quoteForStringBuffer
+    (const std::string &    inString)
+{
+    size_t      numDoubleQuotes{0};
+    size_t      numSingleQuotes{0};
+    bool        needsEscapes{false};
+    std::string result;
+
+    for (auto aChar : inString)
+    {
+        if (kDoubleQuote == aChar)
+        {
+            ++numDoubleQuotes;
+        }
+        else
+        {
+            if (kSingleQuote == aChar)
+            {
+                ++numSingleQuotes;
+            }
+            else
+            {
+                needsEscapes = (needsEscapes || (' ' > StaticCast(uint8_t, aChar)) || (0x7F < StaticCast(uint8_t, aChar)) ||
+                                (kEscapeChar == aChar));
+            }
+        }
+    }
+    if (needsEscapes || (0 < (numDoubleQuotes + numSingleQuotes)))
+    {
+        char    delimiter{(numDoubleQuotes > numSingleQuotes) ? kSingleQuote : kDoubleQuote};
+
+        result += delimiter;
+        for (auto aChar : inString)
+        {
+            switch (aChar)
+            {
+                case '\t' :
+                    result += "\\t"s;
+                    break;
+
+                case '\n' :
+                    result += "\\n"s;
+                    break;
+
+                case '\302' :
+                    result += "\\M-B"s;
+                    break;
+
+                default :
+                    if ((kEscapeChar == aChar) || (delimiter == aChar))
+                    {
+                        result += kEscapeChar;
+                    }
+                    result += aChar;
+                    break;
+
+            }
+        }
+        result += delimiter;
+    }
+    else
+    {
+        result = kDoubleQuote + inString + kDoubleQuote;
+    }
+    return result;
+} // quoteForStringBuffer
+
 #if defined(__APPLE__)
 # pragma mark *** Test Case 01 ***
 #endif // defined(__APPLE__)
@@ -1454,6 +1529,95 @@ doTestStringBufferReset
     return result;
 } // doTestStringBufferReset
 
+#if defined(__APPLE__)
+# pragma mark *** Test Case 22 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestStringBufferWithLongEscapedStrings
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<StringBuffer>()};
+
+        if (stuff)
+        {
+            // The lengths are longer than one or two blocks of 16 bytes and of 32 bytes, and the special
+            // characters are placed at either side of the block boundaries and at the end of the string.
+            static const size_t lengths[]{ 17, 33, 40, 64, 65 };
+            static const size_t positions[]{ 15, 16, 31, 32, SIZE_MAX };
+            static const char   specials[]{ '\t', '\n', kEscapeChar, kDoubleQuote, kSingleQuote, '\302' };
+
+            result = 0;
+            for (size_t length : lengths)
+            {
+                std::string plain;
+
+                for (size_t ii = 0; length > ii; ++ii)
+                {
+                    plain += StaticCast(char, 'a' + (ii % 26));
+                }
+                for (char special : specials)
+                {
+                    std::string allPositions{plain};
+
+                    for (size_t position : positions)
+                    {
+                        size_t      where{(SIZE_MAX == position) ? (length - 1) : position};
+                        std::string onePosition{plain};
+
+                        if (length > where)
+                        {
+                            onePosition[where] = special;
+                            allPositions[where] = special;
+                            for (const auto & inString : { onePosition, allPositions })
+                            {
+                                stuff->reset();
+                                stuff->addString(inString, true);
+                                if (stuff->getString() != quoteForStringBuffer(inString))
+                                {
+                                    ODL_LOG("(stuff->getString() != quoteForStringBuffer(inString))"); //####
+                                    ODL_I3(length, where, special); //####
+                                    result = 1;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestStringBufferWithLongEscapedStrings
+
 #if defined(__APPLE__)
 # pragma mark *** Test Case 50 ***
 #endif // defined(__APPLE__)
@@ -5958,6 +6122,214 @@ doTestTimeValueJSON
     return result;
 } // doTestTimeValueJSON
 
+#if defined(__APPLE__)
+# pragma mark *** Test Case 112 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestStringBufferWithSpanSink
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        size_t  capacity{(kBigTestSize * 2) + 100};
+        auto    bigBlob{std::make_unique<uint8_t[]>(kBigTestSize)};
+        auto    spanData{std::make_unique<uint8_t[]>(capacity)};
+
+        if (bigBlob && spanData)
+        {
+            SpanTextSink    sink{spanData.get(), capacity};
+            StringBuffer    direct{sink};
+            StringBuffer    collected;
+
+            for (size_t ii = 0; kBigTestSize > ii; ++ii)
+            {
+                bigBlob[ii] = StaticCast(uint8_t, ii ^ (ii >> 8));
+            }
+            // Start with a partial chunk, so that both ways of sending the text are used.
+            direct.addString("start"s);
+            collected.addString("start"s);
+            direct.addBytes(bigBlob.get(), kBigTestSize);
+            collected.addBytes(bigBlob.get(), kBigTestSize);
+            if (direct.flush())
+            {
+                auto            expectedString{collected.getString()};
+                std::string     resultString{ReinterpretCast(CPtr(char), spanData.get()), sink.getLength()};
+
+                if (0 == resultString.compare(expectedString))
+                {
+                    if (0 == direct.getLength())
+                    {
+                        result = 0;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (0 == direct.getLength())"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (0 == resultString.compare(expectedString))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (direct.flush())"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (bigBlob && spanData)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestStringBufferWithSpanSink
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 113 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestStringBufferWithStreamSink
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        std::ostringstream  outStream;
+        StreamTextSink      sink{outStream};
+        StringBuffer        direct{sink};
+        std::string         expectedString;
+
+        for (size_t ii = 0; kBigTestSize > ii; ii += 7)
+        {
+            StringBuffer    collected;
+
+            collected.addLong(ii).addString("a\"b"s, true).addTab();
+            expectedString += collected.getString();
+            direct.addLong(ii).addString("a\"b"s, true).addTab();
+        }
+        if (direct.flush())
+        {
+            if (0 == outStream.str().compare(expectedString))
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! (0 == outStream.str().compare(expectedString))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (direct.flush())"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestStringBufferWithStreamSink
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 114 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestStringBufferWithFullSpanSink
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        uint8_t         spanData[10];
+        SpanTextSink    sink{spanData, sizeof(spanData)};
+        StringBuffer    direct{sink};
+
+        direct.addString("abcdefghijklmnop"s);
+        if (direct.flush())
+        {
+            ODL_LOG("(direct.flush())"); //####
+        }
+        else
+        {
+            if (sink.hasFailed() && (0 == sink.getLength()))
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! (sink.hasFailed() && (0 == sink.getLength()))"); //####
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestStringBufferWithFullSpanSink
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
@@ -6070,6 +6442,10 @@ main
                         result = doTestStringBufferReset(*argv, argc - 1, argv + 2);
                         break;
 
+                    case 22 :
+                        result = doTestStringBufferWithLongEscapedStrings(*argv, argc - 1, argv + 2);
+                        break;
+
                     case 50 :
                         result = doTestDefaultLogicalValue(*argv, argc - 1, argv + 2);
                         break;
@@ -6270,6 +6646,18 @@ main
                         result = doTestTimeValueJSON(*argv, argc - 1, argv + 2);
                         break;
 
+                    case 112 :
+                        result = doTestStringBufferWithSpanSink(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 113 :
+                        result = doTestStringBufferWithStreamSink(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 114 :
+                        result = doTestStringBufferWithFullSpanSink(*argv, argc - 1, argv + 2);
+                        break;
+
                     default :
                         break;
 
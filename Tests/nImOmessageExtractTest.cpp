@@ -47,11 +47,16 @@
 #include <BasicTypes/nImOtime.h>
 #include <Containers/nImOarray.h>
 #include <Containers/nImObufferChunk.h>
+#include <Containers/nImOdeltaCoder.h>
+#include <Containers/nImOkeyDictionary.h>
 #include <Containers/nImOmap.h>
 #include <Containers/nImOmessage.h>
+#include <Containers/nImOschemaCodec.h>
 #include <Containers/nImOset.h>
 #include <Containers/nImOstringBuffer.h>
+#include <Containers/nImOstructBinding.h>
 #include <Contexts/nImOtestContext.h>
+#include <nImOreceiveQueue.h>
 
 #include <string>
 
@@ -79,6 +84,53 @@ using namespace nImO;
 # pragma mark Private structures, constants and variables
 #endif // defined(__APPLE__)
 
+/*! @brief A small struct that is written to Messages as a Map. */
+struct TestBoundPoint
+{
+    /*! @brief The horizontal coordinate. */
+    double  x;
+
+    /*! @brief The vertical coordinate. */
+    double  y;
+
+}; // TestBoundPoint
+
+NIMO_BIND_STRUCT(TestBoundPoint, NIMO_BIND_FIELD(TestBoundPoint, x), NIMO_BIND_FIELD(TestBoundPoint, y));
+
+/*! @brief A struct with one field of each supported kind that is written to Messages as a Map. */
+struct TestBoundRecord
+{
+    /*! @brief An empty sequence. */
+    std::vector<int>    empty;
+
+    /*! @brief A string that is too long for the short form. */
+    std::string label;
+
+    /*! @brief A nested struct. */
+    TestBoundPoint  origin;
+
+    /*! @brief A sequence of nested structs. */
+    std::vector<TestBoundPoint> path;
+
+    /*! @brief A sequence of floating-point values. */
+    std::vector<double> samples;
+
+    /*! @brief An integer that is too large for the short form. */
+    int64_t sequence;
+
+    /*! @brief A sequence of strings. */
+    std::vector<std::string>    tags;
+
+    /*! @brief A logical value. */
+    bool    valid;
+
+}; // TestBoundRecord
+
+NIMO_BIND_STRUCT(TestBoundRecord, NIMO_BIND_FIELD(TestBoundRecord, valid), NIMO_BIND_FIELD(TestBoundRecord, sequence),
+                 NIMO_BIND_FIELD(TestBoundRecord, label), NIMO_BIND_FIELD(TestBoundRecord, samples),
+                 NIMO_BIND_FIELD(TestBoundRecord, path), NIMO_BIND_FIELD(TestBoundRecord, tags),
+                 NIMO_BIND_FIELD(TestBoundRecord, origin), NIMO_BIND_FIELD(TestBoundRecord, empty));
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -192,6 +244,100 @@ extractValueAndCheck
     return result;
 } // extractValueAndCheck
 
+/*! @brief Fill a Message with a Blob that is much larger than a buffer chunk.
+ @param[in,out] stuff The Message to be filled.
+ @param[in] seed The value used to generate the bytes of the Blob.
+ @param[out] expectedBytes The bytes of the Blob.
+ @return The position within the Message of the first byte of the Blob. */
+static size_t
+fillMessageWithHugeBlob
+    (Message &                  stuff,
+     const uint8_t              seed,
+     std::vector<uint8_t> &     expectedBytes)
+{
+    ODL_ENTER(); //####
+    ODL_P2(&stuff, &expectedBytes); //####
+    constexpr size_t        actualDataCount{(3 * 1024 * 1024) + 7};
+    std::vector<DataKind>   insertedBytes
+    {
+        // Start of Message
+        DataKind::StartOfMessageValue |
+          DataKind::OtherMessageNonEmptyValue |
+          DataKind::OtherMessageExpectedStringOrBlobValue,
+        // Blob
+        DataKind::StringOrBlob | DataKind::StringOrBlobBlobValue |
+          DataKind::StringOrBlobLongLengthValue |
+          ((3 - 1) & DataKind::StringOrBlobLongLengthMask),
+        StaticCast(DataKind, (actualDataCount >> 16) & 0x00FF), StaticCast(DataKind, (actualDataCount >> 8) & 0x00FF),
+        StaticCast(DataKind, actualDataCount & 0x00FF)
+    };
+    size_t                  position{insertedBytes.size()};
+
+    expectedBytes.resize(actualDataCount);
+    for (size_t ii = 0; actualDataCount > ii; ++ii)
+    {
+        expectedBytes[ii] = StaticCast(uint8_t, seed + (ii * 7) + (ii >> 12));
+        insertedBytes.push_back(StaticCast(DataKind, expectedBytes[ii]));
+    }
+    // End of Message
+    insertedBytes.push_back(DataKind::EndOfMessageValue |
+                            DataKind::OtherMessageNonEmptyValue |
+                            DataKind::OtherMessageExpectedStringOrBlobValue);
+    stuff.open(false);
+    stuff.appendBytes(insertedBytes.data(), insertedBytes.size());
+    ODL_EXIT_I(position); //####
+    return position;
+} // fillMessageWithHugeBlob
+
+/*! @brief Return the Map that is equivalent to a TestBoundPoint.
+ @param[in] xValue The horizontal coordinate.
+ @param[in] yValue The vertical coordinate.
+ @return The equivalent Map. */
+static SpMap
+makeBoundPointMap
+    (const double   xValue,
+     const double   yValue)
+{
+    ODL_ENTER(); //####
+    auto    result{std::make_shared<Map>()};
+
+    result->addValue(std::make_shared<String>("x"), std::make_shared<Double>(xValue));
+    result->addValue(std::make_shared<String>("y"), std::make_shared<Double>(yValue));
+    ODL_EXIT_P(result.get()); //####
+    return result;
+} // makeBoundPointMap
+
+/*! @brief Return the Map that is equivalent to the TestBoundRecord used by the tests.
+ @return The equivalent Map. */
+static SpMap
+makeBoundRecordMap
+    (void)
+{
+    ODL_ENTER(); //####
+    auto    result{std::make_shared<Map>()};
+    auto    path{std::make_shared<Array>()};
+    auto    samples{std::make_shared<Array>()};
+    auto    tags{std::make_shared<Array>()};
+
+    path->addValue(makeBoundPointMap(1, 2));
+    path->addValue(makeBoundPointMap(-3, 4.5));
+    samples->addValue(std::make_shared<Double>(1.5));
+    samples->addValue(std::make_shared<Double>(2.5));
+    samples->addValue(std::make_shared<Double>(-3.25));
+    tags->addValue(std::make_shared<String>("a"));
+    tags->addValue(std::make_shared<String>("bc"));
+    result->addValue(std::make_shared<String>("empty"), std::make_shared<Array>());
+    result->addValue(std::make_shared<String>("label"), std::make_shared<String>("a label that is not short"));
+    result->addValue(std::make_shared<String>("origin"), makeBoundPointMap(0.5, -0.5));
+    result->addValue(std::make_shared<String>("path"), path);
+    result->addValue(std::make_shared<String>("samples"), samples);
+    result->addValue(std::make_shared<String>("sequence"), std::make_shared<Integer>(-123456));
+    result->addValue(std::make_shared<String>("tags"), tags);
+    result->addValue(std::make_shared<String>("valid"), std::make_shared<Logical>(true));
+    ODL_EXIT_P(result.get()); //####
+    return result;
+} // makeBoundRecordMap
+
 #if defined(__APPLE__)
 # pragma mark *** Test Case 001 ***
 #endif // defined(__APPLE__)
@@ -1189,7 +1335,1041 @@ doTestExtractMediumBlobMessage
             constexpr size_t        actualDataCount{numElementsInArray(actualData)};
             Blob                    mediumBlobValue{actualData, actualDataCount};
 
-            result = extractValueAndCheck(*stuff, insertedBytesForMediumBlob, insertedMediumBlobCount, mediumBlobValue);
+            result = extractValueAndCheck(*stuff, insertedBytesForMediumBlob, insertedMediumBlobCount, mediumBlobValue);
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestExtractMediumBlobMessage
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 013 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestExtractSingleDoubleMessage
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            static const DataKind   insertedBytesForPlus42Point5[]
+            {
+                // Start of Message
+                DataKind::StartOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedDoubleValue,
+                // Double
+                DataKind::Double | DataKind::DoubleShortCount |
+                  ((1 - kDataKindDoubleShortCountMinValue) &
+                    DataKind::DoubleShortCountMask),
+                StaticCast(DataKind, 0x40), StaticCast(DataKind, 0x45),
+                StaticCast(DataKind, 0x40), StaticCast(DataKind, 0x00),
+                StaticCast(DataKind, 0x00), StaticCast(DataKind, 0x00),
+                StaticCast(DataKind, 0x00), StaticCast(DataKind, 0x00),
+                // End of Message
+                DataKind::EndOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedDoubleValue
+            };
+            constexpr size_t        insertedPlus42Point5Count{numElementsInArray(insertedBytesForPlus42Point5)};
+            static const DataKind   insertedBytesForMinus42Point5[]
+            {
+                // Start of Message
+                DataKind::StartOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedDoubleValue,
+                // Double
+                DataKind::Double | DataKind::DoubleShortCount |
+                  ((1 - kDataKindDoubleShortCountMinValue) &
+                    DataKind::DoubleShortCountMask),
+                StaticCast(DataKind, 0xC0), StaticCast(DataKind, 0x45),
+                StaticCast(DataKind, 0x40), StaticCast(DataKind, 0x00),
+                StaticCast(DataKind, 0x00), StaticCast(DataKind, 0x00),
+                StaticCast(DataKind, 0x00), StaticCast(DataKind, 0x00),
+                // End of Message
+                DataKind::EndOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedDoubleValue
+            };
+            constexpr size_t        insertedMinus42Point5Count{numElementsInArray(insertedBytesForMinus42Point5)};
+            Double                  plus42Point5Value{42.5};
+            Double                  minus42Point5Value{-42.5};
+
+            result = extractValueAndCheck(*stuff, insertedBytesForMinus42Point5, insertedMinus42Point5Count, minus42Point5Value);
+            if (0 == result)
+            {
+                result = extractValueAndCheck(*stuff, insertedBytesForPlus42Point5, insertedPlus42Point5Count, plus42Point5Value);
+            }
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestExtractSingleDoubleMessage
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 014 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestExtractAddressMessage
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            static const DataKind   insertedBytesForAddress[]
+            {
+                // Start of Message
+                DataKind::StartOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedOtherValue,
+                // Address
+                DataKind::Other | DataKind::OtherMiscellaneous | DataKind::OtherMiscellaneousTypeBitField |
+                        DataKind::OtherMiscellaneousTypeBitFieldTypeIPv4Address,
+                    StaticCast(DataKind, 0x12),
+                    StaticCast(DataKind, 0x34),
+                    StaticCast(DataKind, 0x56),
+                    StaticCast(DataKind, 0x78),
+                // End of Message
+                DataKind::EndOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedOtherValue
+            };
+            constexpr size_t        insertedAddressCount{numElementsInArray(insertedBytesForAddress)};
+            Address                 addressValue{0x12345678};
+
+            result = extractValueAndCheck(*stuff, insertedBytesForAddress, insertedAddressCount, addressValue);
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestExtractAddressMessage
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 015 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestExtractDateMessage
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            static const Date::DatePieces   aDate{12, 11, 10};
+            static const DataKind           insertedBytesForDate[]
+            {
+                // Start of Message
+                DataKind::StartOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedOtherValue,
+                // Date
+                DataKind::Other | DataKind::OtherMiscellaneous | DataKind::OtherMiscellaneousTypeBitField |
+                        DataKind::OtherMiscellaneousTypeBitFieldTypeDate,
+                    StaticCast(DataKind, FirstDateByte(aDate)),
+                    StaticCast(DataKind, SecondDateByte(aDate)),
+                    StaticCast(DataKind, ThirdDateByte(aDate)),
+                    StaticCast(DataKind, FourthDateByte(aDate)),
+                // End of Message
+                DataKind::EndOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedOtherValue
+            };
+            constexpr size_t                insertedDateCount{numElementsInArray(insertedBytesForDate)};
+            Date                            dateValue{MakeDateValue(aDate)};
+
+            result = extractValueAndCheck(*stuff, insertedBytesForDate, insertedDateCount, dateValue);
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestExtractDateMessage
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 016 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestExtractTimeMessage
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            static const Time::TimePieces   aTime{12, 11, 10, 9};
+            static const DataKind           insertedBytesForTime[]
+            {
+                // Start of Message
+                DataKind::StartOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedOtherValue,
+                // Time
+                DataKind::Other | DataKind::OtherMiscellaneous | DataKind::OtherMiscellaneousTypeBitField |
+                        DataKind::OtherMiscellaneousTypeBitFieldTypeTime,
+                    StaticCast(DataKind, FirstTimeByte(aTime)),
+                    StaticCast(DataKind, SecondTimeByte(aTime)),
+                    StaticCast(DataKind, ThirdTimeByte(aTime)),
+                    StaticCast(DataKind, FourthTimeByte(aTime)),
+                // End of Message
+                DataKind::EndOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedOtherValue
+            };
+            constexpr size_t                insertedTimeCount{numElementsInArray(insertedBytesForTime)};
+            Time                            timeValue{MakeTimeValue(aTime)};
+
+            result = extractValueAndCheck(*stuff, insertedBytesForTime, insertedTimeCount, timeValue);
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestExtractTimeMessage
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 017 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestExtractBigBlobMessage
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            // The data is large enough to cross several buffer chunks.
+            constexpr size_t        actualDataCount{2500};
+            std::vector<uint8_t>    actualData(actualDataCount);
+            std::vector<DataKind>   insertedBytesForBigBlob
+            {
+                // Start of Message
+                DataKind::StartOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedStringOrBlobValue,
+                // Blob
+                DataKind::StringOrBlob | DataKind::StringOrBlobBlobValue |
+                  DataKind::StringOrBlobLongLengthValue |
+                  ((2 - 1) & DataKind::StringOrBlobLongLengthMask),
+                StaticCast(DataKind, actualDataCount >> 8), StaticCast(DataKind, actualDataCount & 0x00FF)
+            };
+
+            for (size_t ii = 0; actualDataCount > ii; ++ii)
+            {
+                actualData[ii] = StaticCast(uint8_t, (ii * 7) + (ii >> 8));
+                insertedBytesForBigBlob.push_back(StaticCast(DataKind, actualData[ii]));
+            }
+            // End of Message
+            insertedBytesForBigBlob.push_back(DataKind::EndOfMessageValue |
+                                              DataKind::OtherMessageNonEmptyValue |
+                                              DataKind::OtherMessageExpectedStringOrBlobValue);
+            Blob    bigBlobValue{actualData.data(), actualDataCount};
+
+            result = extractValueAndCheck(*stuff, insertedBytesForBigBlob.data(), insertedBytesForBigBlob.size(),
+                                          bigBlobValue);
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestExtractBigBlobMessage
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 018 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestExtractSchemaCodecMessage
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            auto    schema{std::make_shared<Map>()};
+            auto    matching{std::make_shared<Map>()};
+            auto    mismatched{std::make_shared<Map>()};
+
+            schema->addValue(std::make_shared<String>("tag"), std::make_shared<Integer>(7));
+            schema->addValue(std::make_shared<String>("x"), std::make_shared<Double>());
+            schema->addValue(std::make_shared<String>("y"), std::make_shared<Double>());
+            matching->addValue(std::make_shared<String>("tag"), std::make_shared<Integer>(7));
+            matching->addValue(std::make_shared<String>("x"), std::make_shared<Double>(3.5));
+            matching->addValue(std::make_shared<String>("y"), std::make_shared<Double>(-1.0));
+            mismatched->addValue(std::make_shared<String>("tag"), std::make_shared<Integer>(8));
+            mismatched->addValue(std::make_shared<String>("x"), std::make_shared<Double>(3.5));
+            mismatched->addValue(std::make_shared<String>("y"), std::make_shared<Double>(-1.0));
+            auto    codec{SchemaCodec::registerCodec("test/xy", schema)};
+
+            if (codec && (SchemaCodec::findCodec("test/xy") == codec) && (2 == codec->getFieldCount()))
+            {
+                Message source;
+                double  fields[2]{0, 0};
+
+                source.open(true);
+                source.setValue(matching);
+                source.close();
+                auto    matchingBytes{source.getString()};
+
+                source.open(true);
+                source.setValue(mismatched);
+                source.close();
+                auto    mismatchedBytes{source.getString()};
+
+                stuff->open(false);
+                stuff->appendBytes(ReinterpretCast(CPtr(uint8_t), matchingBytes.data()), matchingBytes.length());
+                if (codec->decode(*stuff, fields) && (3.5 == fields[0]) && (-1.0 == fields[1]))
+                {
+                    stuff->close();
+                    stuff->open(false);
+                    stuff->appendBytes(ReinterpretCast(CPtr(uint8_t), mismatchedBytes.data()), mismatchedBytes.length());
+                    if (codec->decode(*stuff, fields))
+                    {
+                        ODL_LOG("(codec->decode(*stuff, fields))"); //####
+                    }
+                    else
+                    {
+                        result = 0;
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (codec->decode(*stuff, fields) && (3.5 == fields[0]) && (-1.0 == fields[1]))"); //####
+                }
+                stuff->close();
+            }
+            else
+            {
+                ODL_LOG("! (codec && (SchemaCodec::findCodec(\"test/xy\") == codec) && (2 == codec->getFieldCount()))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestExtractSchemaCodecMessage
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 019 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestExtractBoundStructMessage
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            TestBoundRecord record;
+            Message         source;
+
+            source.open(true);
+            source.setValue(makeBoundRecordMap());
+            source.close();
+            auto    recordBytes{source.getString()};
+
+            source.open(true);
+            source.setValue(makeBoundPointMap(1, 2));
+            source.close();
+            auto    pointBytes{source.getString()};
+
+            stuff->open(false);
+            stuff->appendBytes(ReinterpretCast(CPtr(uint8_t), recordBytes.data()), recordBytes.length());
+            if (DecodeBoundValue(*stuff, record) && record.empty.empty() && (record.label == "a label that is not short") &&
+                (0.5 == record.origin.x) && (-0.5 == record.origin.y) && (2 == record.path.size()) &&
+                (-3 == record.path[1].x) && (4.5 == record.path[1].y) && (3 == record.samples.size()) &&
+                (-3.25 == record.samples[2]) && (-123456 == record.sequence) && (2 == record.tags.size()) &&
+                (record.tags[1] == "bc") && record.valid)
+            {
+                // A Message with a different shape must be rejected.
+                stuff->close();
+                stuff->open(false);
+                stuff->appendBytes(ReinterpretCast(CPtr(uint8_t), pointBytes.data()), pointBytes.length());
+                if (DecodeBoundValue(*stuff, record))
+                {
+                    ODL_LOG("(DecodeBoundValue(*stuff, record))"); //####
+                }
+                else
+                {
+                    result = 0;
+                }
+            }
+            else
+            {
+                ODL_LOG("! (DecodeBoundValue(*stuff, record) && the fields match)"); //####
+            }
+            stuff->close();
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestExtractBoundStructMessage
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 020 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestExtractSinglePrecisionDoublesMessage
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            static const DataKind   insertedArraySingleDoublesBytes[]
+            {
+                // Start of Message
+                DataKind::StartOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedOtherValue,
+                // Start of Array
+                DataKind::Other | DataKind::OtherContainerStart |
+                  DataKind::OtherContainerTypeArray |
+                  DataKind::OtherContainerNonEmptyValue,
+                // Signed Integer
+                DataKind::Integer |
+                  DataKind::IntegerShortValue |
+                  ((2 + kDataKindIntegerShortValueMinValue - 1) &
+                    DataKind::IntegerShortValueValueMask),
+                // Double
+                DataKind::Double | DataKind::DoubleLongCount |
+                  DataKind::DoubleLongCountSinglePrecisionValue |
+                  ((1 - 1) & DataKind::DoubleLongCountMask),
+                StaticCast(DataKind, 2),
+                StaticCast(DataKind, 0x42), StaticCast(DataKind, 0x2A),
+                StaticCast(DataKind, 0x00), StaticCast(DataKind, 0x00),
+                StaticCast(DataKind, 0xC2), StaticCast(DataKind, 0x2A),
+                StaticCast(DataKind, 0x00), StaticCast(DataKind, 0x00),
+                // End of Array
+                DataKind::Other | DataKind::OtherContainerEnd |
+                  DataKind::OtherContainerTypeArray |
+                  DataKind::OtherContainerNonEmptyValue,
+                // End of Message
+                DataKind::EndOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedOtherValue
+            };
+            constexpr size_t    insertedArraySingleDoublesByteCount{numElementsInArray(insertedArraySingleDoublesBytes)};
+            Array               arraySingleDoubles;
+
+            arraySingleDoubles.addValue(std::make_shared<Double>(42.5));
+            arraySingleDoubles.addValue(std::make_shared<Double>(-42.5));
+            result = extractValueAndCheck(*stuff, insertedArraySingleDoublesBytes, insertedArraySingleDoublesByteCount,
+                                          arraySingleDoubles);
+            if (0 == result)
+            {
+                // Bound structs must accept single-precision values as well.
+                Message         source;
+                TestBoundPoint  point{1.5, -2};
+                TestBoundPoint  decoded{0, 0};
+
+                result = 1;
+                source.setSinglePrecision(true);
+                source.open(true);
+                EncodeBoundValue(source, point);
+                source.close();
+                auto    pointBytes{source.getString()};
+
+                stuff->open(false);
+                stuff->appendBytes(ReinterpretCast(CPtr(uint8_t), pointBytes.data()), pointBytes.length());
+                if (DecodeBoundValue(*stuff, decoded) && (1.5 == decoded.x) && (-2 == decoded.y))
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (DecodeBoundValue(*stuff, decoded) && (1.5 == decoded.x) && (-2 == decoded.y))"); //####
+                }
+                stuff->close();
+            }
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestExtractSinglePrecisionDoublesMessage
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 021 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestExtractMapWithKeyDictionaryMessage
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            auto    senderKeys{std::make_shared<KeyDictionary>()};
+            auto    receiverKeys{std::make_shared<KeyDictionary>()};
+            auto    aMap{std::make_shared<Map>()};
+            Message source;
+
+            aMap->addValue(std::make_shared<String>("alpha"), std::make_shared<Integer>(1));
+            aMap->addValue(std::make_shared<String>("beta"), std::make_shared<Integer>(2));
+            source.setKeyDictionary(senderKeys);
+            source.open(true);
+            source.setValue(aMap);
+            source.close();
+            auto    fullBytes{source.getString()};
+
+            source.open(true);
+            source.setValue(aMap);
+            source.close();
+            auto    referenceBytes{source.getString()};
+
+            stuff->setKeyDictionary(receiverKeys);
+            stuff->open(false);
+            stuff->appendBytes(ReinterpretCast(CPtr(uint8_t), fullBytes.data()), fullBytes.length());
+            auto    firstValue{stuff->getValue()};
+
+            stuff->close();
+            stuff->open(false);
+            stuff->appendBytes(ReinterpretCast(CPtr(uint8_t), referenceBytes.data()), referenceBytes.length());
+            auto    secondValue{stuff->getValue()};
+
+            stuff->close();
+            if ((referenceBytes.length() < fullBytes.length()) && firstValue && firstValue->deeplyEqualTo(*aMap) && secondValue &&
+                secondValue->deeplyEqualTo(*aMap))
+            {
+                // A reference that is not in the dictionary must be rejected.
+                receiverKeys->reset();
+                stuff->open(false);
+                stuff->appendBytes(ReinterpretCast(CPtr(uint8_t), referenceBytes.data()), referenceBytes.length());
+                auto    thirdValue{stuff->getValue()};
+
+                stuff->close();
+                if (thirdValue && thirdValue->asFlaw())
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (thirdValue && thirdValue->asFlaw())"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! ((referenceBytes.length() < fullBytes.length()) && firstValue && " //####
+                        "firstValue->deeplyEqualTo(*aMap) && secondValue && secondValue->deeplyEqualTo(*aMap))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestExtractMapWithKeyDictionaryMessage
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 022 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestExtractDeltaEncodedMessages
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            DeltaCoder  sender{10};
+            DeltaCoder  receiver{0};
+            Message     source;
+            auto        encode{[&sender, &source]
+                                (SpValue aValue)
+                                {
+                                    source.open(true);
+                                    source.setValue(sender.encodeValue(aValue, false));
+                                    source.close();
+                                    auto    bytes{source.getString()};
+
+                                    sender.recordSentMessage(source);
+                                    return bytes;
+                                }};
+            auto        decode{[&stuff, &receiver]
+                                (const std::string &    bytes)
+                                {
+                                    stuff->open(false);
+                                    stuff->appendBytes(ReinterpretCast(CPtr(uint8_t), bytes.data()), bytes.length());
+                                    auto    envelope{stuff->getValue()};
+
+                                    stuff->close();
+                                    return receiver.decodeValue(envelope);
+                                }};
+            auto        firstInner{std::make_shared<Map>()};
+            auto        first{std::make_shared<Map>()};
+            auto        secondInner{std::make_shared<Map>()};
+            auto        second{std::make_shared<Map>()};
+            auto        third{std::make_shared<Map>()};
+
+            firstInner->addValue(std::make_shared<String>("x"), std::make_shared<Double>(1.5));
+            firstInner->addValue(std::make_shared<String>("y"), std::make_shared<Double>(2.5));
+            first->addValue(std::make_shared<String>("alpha"), std::make_shared<Integer>(1));
+            first->addValue(std::make_shared<String>("beta"), std::make_shared<Integer>(2));
+            first->addValue(std::make_shared<String>("inner"), firstInner);
+            secondInner->addValue(std::make_shared<String>("x"), std::make_shared<Double>(1.5));
+            secondInner->addValue(std::make_shared<String>("y"), std::make_shared<Double>(3.5));
+            second->addValue(std::make_shared<String>("alpha"), std::make_shared<Integer>(1));
+            second->addValue(std::make_shared<String>("gamma"), std::make_shared<Integer>(3));
+            second->addValue(std::make_shared<String>("inner"), secondInner);
+            third->addValue(std::make_shared<String>("alpha"), std::make_shared<Integer>(4));
+            third->addValue(std::make_shared<String>("gamma"), std::make_shared<Integer>(3));
+            third->addValue(std::make_shared<String>("inner"), secondInner);
+            auto    firstValue{decode(encode(first))};
+            auto    secondValue{decode(encode(second))};
+
+            // Lose a delta, so that the next one can't be applied.
+            encode(third);
+            auto    lostValue{decode(encode(third))};
+            bool    keyframeWasNeeded{receiver.isKeyframeNeeded()};
+
+            sender.requestKeyframe();
+            auto    recoveredValue{decode(encode(third))};
+
+            if (firstValue && firstValue->deeplyEqualTo(*first) && secondValue && secondValue->deeplyEqualTo(*second) &&
+                (nullptr == lostValue) && keyframeWasNeeded && recoveredValue && recoveredValue->deeplyEqualTo(*third) &&
+                (! receiver.isKeyframeNeeded()))
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! (firstValue && firstValue->deeplyEqualTo(*first) && secondValue && " //####
+                        "secondValue->deeplyEqualTo(*second) && (nullptr == lostValue) && keyframeWasNeeded && " //####
+                        "recoveredValue && recoveredValue->deeplyEqualTo(*third) && (! receiver.isKeyframeNeeded()))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestExtractDeltaEncodedMessages
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 023 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestExtractHugeBlobSharesMessageBytes
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            std::vector<uint8_t>    expectedBytes;
+            size_t                  position{fillMessageWithHugeBlob(*stuff, 0, expectedBytes)};
+            size_t                  contiguousCount;
+            CPtr(uint8_t)           messageBytes{stuff->getContiguousBytes(position, contiguousCount)};
+            auto                    extractedValue{stuff->getValue()};
+
+            stuff->close();
+            CPtr(Blob)  asBlob{extractedValue ? extractedValue->asBlob() : nullptr};
+
+            // The whole Blob is in one chunk of the Message, and the extracted Blob refers to it rather than to a copy.
+            if ((nullptr != asBlob) && (expectedBytes.size() <= contiguousCount) && (asBlob->getBytes().data() == messageBytes) &&
+                (asBlob->getBytes().size() == expectedBytes.size()) &&
+                (0 == memcmp(asBlob->getBytes().data(), expectedBytes.data(), expectedBytes.size())))
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! ((nullptr != asBlob) && (expectedBytes.size() <= contiguousCount) && " //####
+                        "(asBlob->getBytes().data() == messageBytes) && " //####
+                        "(asBlob->getBytes().size() == expectedBytes.size()) && " //####
+                        "(0 == memcmp(asBlob->getBytes().data(), expectedBytes.data(), expectedBytes.size())))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestExtractHugeBlobSharesMessageBytes
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 024 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestResetMessageWhileBlobIsShared
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            std::vector<uint8_t>    firstBytes;
+            std::vector<uint8_t>    secondBytes;
+
+            fillMessageWithHugeBlob(*stuff, 0, firstBytes);
+            auto    firstValue{stuff->getValue()};
+
+            stuff->close();
+            // Reusing the Message must not disturb the bytes of a Blob that still refers to them.
+            fillMessageWithHugeBlob(*stuff, 0x55, secondBytes);
+            auto    secondValue{stuff->getValue()};
+
+            stuff->close();
+            stuff->reset();
+            stuff->open(true);
+            stuff->setValue(std::make_shared<Logical>(true));
+            stuff->close();
+            CPtr(Blob)  firstBlob{firstValue ? firstValue->asBlob() : nullptr};
+            CPtr(Blob)  secondBlob{secondValue ? secondValue->asBlob() : nullptr};
+
+            if ((nullptr != firstBlob) && (nullptr != secondBlob) &&
+                (firstBlob->getBytes().size() == firstBytes.size()) && (secondBlob->getBytes().size() == secondBytes.size()) &&
+                (0 == memcmp(firstBlob->getBytes().data(), firstBytes.data(), firstBytes.size())) &&
+                (0 == memcmp(secondBlob->getBytes().data(), secondBytes.data(), secondBytes.size())))
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! ((nullptr != firstBlob) && (nullptr != secondBlob) && " //####
+                        "(firstBlob->getBytes().size() == firstBytes.size()) && " //####
+                        "(secondBlob->getBytes().size() == secondBytes.size()) && " //####
+                        "(0 == memcmp(firstBlob->getBytes().data(), firstBytes.data(), firstBytes.size())) && " //####
+                        "(0 == memcmp(secondBlob->getBytes().data(), secondBytes.data(), secondBytes.size())))"); //####
+            }
         }
         else
         {
@@ -1204,10 +2384,10 @@ doTestExtractMediumBlobMessage
     }
     ODL_EXIT_I(result); //####
     return result;
-} // doTestExtractMediumBlobMessage
+} // doTestResetMessageWhileBlobIsShared
 
 #if defined(__APPLE__)
-# pragma mark *** Test Case 013 ***
+# pragma mark *** Test Case 025 ***
 #endif // defined(__APPLE__)
 
 /*! @brief Perform a test case.
@@ -1216,7 +2396,7 @@ doTestExtractMediumBlobMessage
  @param[in] argv The arguments to be used for the test.
  @return @c 0 on success and @c 1 on failure. */
 static int
-doTestExtractSingleDoubleMessage
+doTestExtractBoundValuesWithDamagedSizes
     (CPtr(char)     launchPath,
      const int      argc,
      Ptr(Ptr(char)) argv)
@@ -1236,54 +2416,80 @@ doTestExtractSingleDoubleMessage
 
         if (stuff)
         {
-            static const DataKind   insertedBytesForPlus42Point5[]
+            // A String that claims to be about two gigabytes long, but holds three bytes.
+            static const DataKind   hugeStringBytes[]
             {
                 // Start of Message
                 DataKind::StartOfMessageValue |
                   DataKind::OtherMessageNonEmptyValue |
-                  DataKind::OtherMessageExpectedDoubleValue,
-                // Double
-                DataKind::Double | DataKind::DoubleShortCount |
-                  ((1 - kDataKindDoubleShortCountMinValue) &
-                    DataKind::DoubleShortCountMask),
-                StaticCast(DataKind, 0x40), StaticCast(DataKind, 0x45),
-                StaticCast(DataKind, 0x40), StaticCast(DataKind, 0x00),
-                StaticCast(DataKind, 0x00), StaticCast(DataKind, 0x00),
-                StaticCast(DataKind, 0x00), StaticCast(DataKind, 0x00),
+                  DataKind::OtherMessageExpectedStringOrBlobValue,
+                // String
+                DataKind::StringOrBlob | DataKind::StringOrBlobStringValue |
+                  DataKind::StringOrBlobLongLengthValue |
+                  ((4 - 1) & DataKind::StringOrBlobLongLengthMask),
+                StaticCast(DataKind, 0x7F), StaticCast(DataKind, 0xFF),
+                StaticCast(DataKind, 0xFF), StaticCast(DataKind, 0xFF),
+                StaticCast(DataKind, 'a'), StaticCast(DataKind, 'b'),
+                StaticCast(DataKind, 'c'),
                 // End of Message
                 DataKind::EndOfMessageValue |
                   DataKind::OtherMessageNonEmptyValue |
-                  DataKind::OtherMessageExpectedDoubleValue
+                  DataKind::OtherMessageExpectedStringOrBlobValue
             };
-            constexpr size_t        insertedPlus42Point5Count{numElementsInArray(insertedBytesForPlus42Point5)};
-            static const DataKind   insertedBytesForMinus42Point5[]
+            // An Array that claims to hold about two billion Integers, but holds one.
+            static const DataKind   hugeArrayBytes[]
             {
                 // Start of Message
                 DataKind::StartOfMessageValue |
                   DataKind::OtherMessageNonEmptyValue |
-                  DataKind::OtherMessageExpectedDoubleValue,
-                // Double
-                DataKind::Double | DataKind::DoubleShortCount |
-                  ((1 - kDataKindDoubleShortCountMinValue) &
-                    DataKind::DoubleShortCountMask),
-                StaticCast(DataKind, 0xC0), StaticCast(DataKind, 0x45),
-                StaticCast(DataKind, 0x40), StaticCast(DataKind, 0x00),
-                StaticCast(DataKind, 0x00), StaticCast(DataKind, 0x00),
-                StaticCast(DataKind, 0x00), StaticCast(DataKind, 0x00),
+                  DataKind::OtherMessageExpectedOtherValue,
+                // Start of Array
+                DataKind::Other | DataKind::OtherContainerStart |
+                  DataKind::OtherContainerTypeArray |
+                  DataKind::OtherContainerNonEmptyValue,
+                // Signed Integer
+                DataKind::Integer | DataKind::IntegerLongValue |
+                  ((4 - 1) & DataKind::IntegerLongValueCountMask),
+                StaticCast(DataKind, 0x7F), StaticCast(DataKind, 0xFF),
+                StaticCast(DataKind, 0xFF), StaticCast(DataKind, 0xFF),
+                // Signed Integer
+                DataKind::Integer |
+                  DataKind::IntegerShortValue |
+                  (1 & DataKind::IntegerShortValueValueMask),
+                // End of Array
+                DataKind::Other | DataKind::OtherContainerEnd |
+                  DataKind::OtherContainerTypeArray |
+                  DataKind::OtherContainerNonEmptyValue,
                 // End of Message
                 DataKind::EndOfMessageValue |
                   DataKind::OtherMessageNonEmptyValue |
-                  DataKind::OtherMessageExpectedDoubleValue
+                  DataKind::OtherMessageExpectedOtherValue
             };
-            constexpr size_t        insertedMinus42Point5Count{numElementsInArray(insertedBytesForMinus42Point5)};
-            Double                  plus42Point5Value{42.5};
-            Double                  minus42Point5Value{-42.5};
+            std::string             aString;
+            std::vector<int64_t>    someIntegers;
 
-            result = extractValueAndCheck(*stuff, insertedBytesForMinus42Point5, insertedMinus42Point5Count, minus42Point5Value);
-            if (0 == result)
+            // Neither Message may be accepted, and neither may cause a huge allocation.
+            stuff->open(false);
+            stuff->appendBytes(hugeStringBytes, sizeof(hugeStringBytes));
+            if (DecodeBoundValue(*stuff, aString))
             {
-                result = extractValueAndCheck(*stuff, insertedBytesForPlus42Point5, insertedPlus42Point5Count, plus42Point5Value);
+                ODL_LOG("(DecodeBoundValue(*stuff, aString))"); //####
+            }
+            else
+            {
+                stuff->close();
+                stuff->open(false);
+                stuff->appendBytes(hugeArrayBytes, sizeof(hugeArrayBytes));
+                if (DecodeBoundValue(*stuff, someIntegers))
+                {
+                    ODL_LOG("(DecodeBoundValue(*stuff, someIntegers))"); //####
+                }
+                else
+                {
+                    result = 0;
+                }
             }
+            stuff->close();
         }
         else
         {
@@ -1298,10 +2504,10 @@ doTestExtractSingleDoubleMessage
     }
     ODL_EXIT_I(result); //####
     return result;
-} // doTestExtractSingleDoubleMessage
+} // doTestExtractBoundValuesWithDamagedSizes
 
 #if defined(__APPLE__)
-# pragma mark *** Test Case 014 ***
+# pragma mark *** Test Case 026 ***
 #endif // defined(__APPLE__)
 
 /*! @brief Perform a test case.
@@ -1310,7 +2516,7 @@ doTestExtractSingleDoubleMessage
  @param[in] argv The arguments to be used for the test.
  @return @c 0 on success and @c 1 on failure. */
 static int
-doTestExtractAddressMessage
+doTestExtractDeltaOnlyWhenSmaller
     (CPtr(char)     launchPath,
      const int      argc,
      Ptr(Ptr(char)) argv)
@@ -1330,28 +2536,64 @@ doTestExtractAddressMessage
 
         if (stuff)
         {
-            static const DataKind   insertedBytesForAddress[]
+            DeltaCoder  sender{10};
+            DeltaCoder  receiver{0};
+            auto        send{[&sender, &stuff, &receiver]
+                                (SpValue    aValue,
+                                 bool &     wasKeyframe)
+                                {
+                                    stuff->open(true);
+                                    stuff->setValue(sender.encodeValue(aValue, false));
+                                    stuff->close();
+                                    sender.recordSentMessage(*stuff);
+                                    auto    bytes{stuff->getString()};
+
+                                    stuff->open(false);
+                                    stuff->appendBytes(ReinterpretCast(CPtr(uint8_t), bytes.data()), bytes.length());
+                                    auto    envelope{stuff->getValue()};
+                                    auto    asArray{envelope ? envelope->asArray() : nullptr};
+
+                                    stuff->close();
+                                    wasKeyframe = ((nullptr != asArray) && (3 == asArray->size()) &&
+                                                   (nullptr != asArray->at(1)->asLogical()) &&
+                                                   asArray->at(1)->asLogical()->getValue());
+                                    return receiver.decodeValue(envelope);
+                                }};
+            std::string longText(200, 'z');
+            auto        first{std::make_shared<Map>()};
+            auto        second{std::make_shared<Map>()};
+            auto        third{std::make_shared<Map>()};
+            bool        firstWasKeyframe{false};
+            bool        secondWasKeyframe{false};
+            bool        resentWasKeyframe{false};
+            bool        thirdWasKeyframe{true};
+
+            first->addValue(std::make_shared<String>("a"), std::make_shared<Integer>(1));
+            first->addValue(std::make_shared<String>("b"), std::make_shared<Integer>(2));
+            first->addValue(std::make_shared<String>("text"), std::make_shared<String>(longText));
+            // Only one short entry is carried over, so listing the changes takes more bytes than the Map.
+            second->addValue(std::make_shared<String>("a"), std::make_shared<Integer>(1));
+            second->addValue(std::make_shared<String>("b"), std::make_shared<Integer>(3));
+            // The long entry is carried over, so the delta is much smaller than the Map.
+            third->addValue(std::make_shared<String>("a"), std::make_shared<Integer>(1));
+            third->addValue(std::make_shared<String>("b"), std::make_shared<Integer>(4));
+            third->addValue(std::make_shared<String>("c"), std::make_shared<Integer>(5));
+            third->addValue(std::make_shared<String>("text"), std::make_shared<String>(longText));
+            auto    firstValue{send(first, firstWasKeyframe)};
+            auto    secondValue{send(second, secondWasKeyframe)};
+            auto    resentValue{send(first, resentWasKeyframe)};
+            auto    thirdValue{send(third, thirdWasKeyframe)};
+
+            if (firstValue && firstValue->deeplyEqualTo(*first) && firstWasKeyframe && secondValue &&
+                secondValue->deeplyEqualTo(*second) && secondWasKeyframe && resentValue && resentValue->deeplyEqualTo(*first) &&
+                resentWasKeyframe && thirdValue && thirdValue->deeplyEqualTo(*third) && (! thirdWasKeyframe))
             {
-                // Start of Message
-                DataKind::StartOfMessageValue |
-                  DataKind::OtherMessageNonEmptyValue |
-                  DataKind::OtherMessageExpectedOtherValue,
-                // Address
-                DataKind::Other | DataKind::OtherMiscellaneous | DataKind::OtherMiscellaneousTypeBitField |
-                        DataKind::OtherMiscellaneousTypeBitFieldTypeIPv4Address,
-                    StaticCast(DataKind, 0x12),
-                    StaticCast(DataKind, 0x34),
-                    StaticCast(DataKind, 0x56),
-                    StaticCast(DataKind, 0x78),
-                // End of Message
-                DataKind::EndOfMessageValue |
-                  DataKind::OtherMessageNonEmptyValue |
-                  DataKind::OtherMessageExpectedOtherValue
-            };
-            constexpr size_t        insertedAddressCount{numElementsInArray(insertedBytesForAddress)};
-            Address                 addressValue{0x12345678};
-
-            result = extractValueAndCheck(*stuff, insertedBytesForAddress, insertedAddressCount, addressValue);
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! (the Values match and only the last one was sent as a delta)"); //####
+            }
         }
         else
         {
@@ -1366,10 +2608,10 @@ doTestExtractAddressMessage
     }
     ODL_EXIT_I(result); //####
     return result;
-} // doTestExtractAddressMessage
+} // doTestExtractDeltaOnlyWhenSmaller
 
 #if defined(__APPLE__)
-# pragma mark *** Test Case 015 ***
+# pragma mark *** Test Case 027 ***
 #endif // defined(__APPLE__)
 
 /*! @brief Perform a test case.
@@ -1378,7 +2620,7 @@ doTestExtractAddressMessage
  @param[in] argv The arguments to be used for the test.
  @return @c 0 on success and @c 1 on failure. */
 static int
-doTestExtractDateMessage
+doTestExtractDeltaOfMapModifiedAfterSending
     (CPtr(char)     launchPath,
      const int      argc,
      Ptr(Ptr(char)) argv)
@@ -1398,29 +2640,65 @@ doTestExtractDateMessage
 
         if (stuff)
         {
-            static const Date::DatePieces   aDate{12, 11, 10};
-            static const DataKind           insertedBytesForDate[]
+            DeltaCoder  sender{10};
+            DeltaCoder  receiver{0};
+            auto        send{[&sender, &stuff, &receiver]
+                                (SpValue    aValue,
+                                 bool &     wasKeyframe)
+                                {
+                                    stuff->open(true);
+                                    stuff->setValue(sender.encodeValue(aValue, false));
+                                    stuff->close();
+                                    sender.recordSentMessage(*stuff);
+                                    auto    bytes{stuff->getString()};
+
+                                    stuff->open(false);
+                                    stuff->appendBytes(ReinterpretCast(CPtr(uint8_t), bytes.data()), bytes.length());
+                                    auto    envelope{stuff->getValue()};
+                                    auto    asArray{envelope ? envelope->asArray() : nullptr};
+
+                                    stuff->close();
+                                    wasKeyframe = ((nullptr != asArray) && (3 == asArray->size()) &&
+                                                   (nullptr != asArray->at(1)->asLogical()) &&
+                                                   asArray->at(1)->asLogical()->getValue());
+                                    return receiver.decodeValue(envelope);
+                                }};
+            std::string longText(200, 'z');
+            auto        aMap{std::make_shared<Map>()};
+            auto        nested{std::make_shared<Map>()};
+            auto        keyA{std::make_shared<String>("a")};
+            auto        keyN{std::make_shared<Integer>(1)};
+            bool        firstWasKeyframe{false};
+            bool        secondWasKeyframe{true};
+            bool        thirdWasKeyframe{true};
+
+            nested->addValue(keyN, std::make_shared<Integer>(10));
+            aMap->addValue(keyA, std::make_shared<Integer>(1));
+            aMap->addValue(std::make_shared<String>("nested"), nested);
+            aMap->addValue(std::make_shared<String>("text"), std::make_shared<String>(longText));
+            auto    firstValue{send(aMap, firstWasKeyframe)};
+            bool    firstMatched{firstValue && firstValue->deeplyEqualTo(*aMap)};
+
+            // Change the same Map, and a Map inside it, and send it again.
+            aMap->erase(keyA);
+            aMap->addValue(keyA, std::make_shared<Integer>(2));
+            auto    secondValue{send(aMap, secondWasKeyframe)};
+            bool    secondMatched{secondValue && secondValue->deeplyEqualTo(*aMap)};
+
+            nested->erase(keyN);
+            nested->addValue(keyN, std::make_shared<Integer>(20));
+            auto    thirdValue{send(aMap, thirdWasKeyframe)};
+            bool    thirdMatched{thirdValue && thirdValue->deeplyEqualTo(*aMap)};
+
+            if (firstMatched && firstWasKeyframe && secondMatched && (! secondWasKeyframe) && thirdMatched &&
+                (! thirdWasKeyframe))
             {
-                // Start of Message
-                DataKind::StartOfMessageValue |
-                  DataKind::OtherMessageNonEmptyValue |
-                  DataKind::OtherMessageExpectedOtherValue,
-                // Date
-                DataKind::Other | DataKind::OtherMiscellaneous | DataKind::OtherMiscellaneousTypeBitField |
-                        DataKind::OtherMiscellaneousTypeBitFieldTypeDate,
-                    StaticCast(DataKind, FirstDateByte(aDate)),
-                    StaticCast(DataKind, SecondDateByte(aDate)),
-                    StaticCast(DataKind, ThirdDateByte(aDate)),
-                    StaticCast(DataKind, FourthDateByte(aDate)),
-                // End of Message
-                DataKind::EndOfMessageValue |
-                  DataKind::OtherMessageNonEmptyValue |
-                  DataKind::OtherMessageExpectedOtherValue
-            };
-            constexpr size_t                insertedDateCount{numElementsInArray(insertedBytesForDate)};
-            Date                            dateValue{MakeDateValue(aDate)};
-
-            result = extractValueAndCheck(*stuff, insertedBytesForDate, insertedDateCount, dateValue);
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! (each change was seen by the receiver and sent as a delta)"); //####
+            }
         }
         else
         {
@@ -1435,10 +2713,10 @@ doTestExtractDateMessage
     }
     ODL_EXIT_I(result); //####
     return result;
-} // doTestExtractDateMessage
+} // doTestExtractDeltaOfMapModifiedAfterSending
 
 #if defined(__APPLE__)
-# pragma mark *** Test Case 016 ***
+# pragma mark *** Test Case 028 ***
 #endif // defined(__APPLE__)
 
 /*! @brief Perform a test case.
@@ -1447,7 +2725,7 @@ doTestExtractDateMessage
  @param[in] argv The arguments to be used for the test.
  @return @c 0 on success and @c 1 on failure. */
 static int
-doTestExtractTimeMessage
+doTestExtractSchemaCodecThroughReceiveQueue
     (CPtr(char)     launchPath,
      const int      argc,
      Ptr(Ptr(char)) argv)
@@ -1463,37 +2741,169 @@ doTestExtractTimeMessage
 
     try
     {
-        auto    stuff{std::make_unique<Message>()};
-
-        if (stuff)
+        auto    schema{std::make_shared<Map>()};
+        auto    mismatched{std::make_shared<Map>()};
+
+        schema->addValue(std::make_shared<String>("tag"), std::make_shared<Integer>(7));
+        schema->addValue(std::make_shared<String>("x"), std::make_shared<Double>());
+        schema->addValue(std::make_shared<String>("y"), std::make_shared<Double>());
+        mismatched->addValue(std::make_shared<String>("tag"), std::make_shared<Integer>(8));
+        mismatched->addValue(std::make_shared<String>("x"), std::make_shared<Double>(3.5));
+        mismatched->addValue(std::make_shared<String>("y"), std::make_shared<Double>(-1.0));
+        auto    codec{SchemaCodec::registerCodec("test/queue", schema)};
+
+        if (codec)
         {
-            static const Time::TimePieces   aTime{12, 11, 10, 9};
-            static const DataKind           insertedBytesForTime[]
+            Message         source;
+            ReceiveQueue    queue{};
+            const double    fields[2]{3.5, -1.0};
+
+            source.open(true);
+            codec->encode(source, fields);
+            source.close();
+            auto    matchingBytes{source.getString()};
+
+            source.open(true);
+            source.setValue(mismatched);
+            source.close();
+            auto    mismatchedBytes{source.getString()};
+
+            // A Message with the shape of the schema is delivered as its fields and any other Message as a Value.
+            bool    allAdded{queue.addBytesAsMessage(0, ReinterpretCast(CPtr(uint8_t), matchingBytes.data()), matchingBytes.length(),
+                                                     nullptr, nullptr, codec) &&
+                             queue.addBytesAsMessage(0, ReinterpretCast(CPtr(uint8_t), mismatchedBytes.data()),
+                                                     mismatchedBytes.length(), nullptr, nullptr, codec) &&
+                             queue.addBytesAsMessage(0, ReinterpretCast(CPtr(uint8_t), matchingBytes.data()), matchingBytes.length())};
+
+            if (allAdded)
             {
-                // Start of Message
-                DataKind::StartOfMessageValue |
-                  DataKind::OtherMessageNonEmptyValue |
-                  DataKind::OtherMessageExpectedOtherValue,
-                // Time
-                DataKind::Other | DataKind::OtherMiscellaneous | DataKind::OtherMiscellaneousTypeBitField |
-                        DataKind::OtherMiscellaneousTypeBitFieldTypeTime,
-                    StaticCast(DataKind, FirstTimeByte(aTime)),
-                    StaticCast(DataKind, SecondTimeByte(aTime)),
-                    StaticCast(DataKind, ThirdTimeByte(aTime)),
-                    StaticCast(DataKind, FourthTimeByte(aTime)),
-                // End of Message
-                DataKind::EndOfMessageValue |
-                  DataKind::OtherMessageNonEmptyValue |
-                  DataKind::OtherMessageExpectedOtherValue
-            };
-            constexpr size_t                insertedTimeCount{numElementsInArray(insertedBytesForTime)};
-            Time                            timeValue{MakeTimeValue(aTime)};
+                auto    asFields{queue.getNextMessage()};
+                auto    asMismatched{queue.getNextMessage()};
+                auto    withoutCodec{queue.getNextMessage()};
+
+                if (asFields && (nullptr == asFields->_receivedMessage) && (2 == asFields->_receivedFields.size()) &&
+                    (3.5 == asFields->_receivedFields[0]) && (-1.0 == asFields->_receivedFields[1]) && asMismatched &&
+                    asMismatched->_receivedMessage && asMismatched->_receivedMessage->deeplyEqualTo(*mismatched) &&
+                    asMismatched->_receivedFields.empty() && withoutCodec && withoutCodec->_receivedMessage &&
+                    withoutCodec->_receivedMessage->asMap() && withoutCodec->_receivedFields.empty())
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (only the matching Message sent through the codec was delivered as fields)"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (allAdded)"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (codec)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
 
-            result = extractValueAndCheck(*stuff, insertedBytesForTime, insertedTimeCount, timeValue);
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestExtractSchemaCodecThroughReceiveQueue
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 029 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestExtractBoundStructWithKeyDictionaryThroughReceiveQueue
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto            stuff{std::make_unique<Message>()};
+        auto            boundKeys{std::make_shared<KeyDictionary>()};
+        auto            mapKeys{std::make_shared<KeyDictionary>()};
+        auto            receiverKeys{std::make_shared<KeyDictionary>()};
+        Message         boundSource;
+        Message         mapSource;
+        ReceiveQueue    queue{};
+        TestBoundRecord record;
+        std::string     boundBytes[2];
+        std::string     mapBytes[2];
+        bool            allAdded{true};
+
+        mapSource.open(true);
+        mapSource.setValue(makeBoundRecordMap());
+        mapSource.close();
+        auto    recordBytes{mapSource.getString()};
+
+        stuff->open(false);
+        stuff->appendBytes(ReinterpretCast(CPtr(uint8_t), recordBytes.data()), recordBytes.length());
+        bool    okSoFar{DecodeBoundValue(*stuff, record)};
+
+        stuff->close();
+        boundSource.setKeyDictionary(boundKeys);
+        mapSource.setKeyDictionary(mapKeys);
+        // The keys are sent in full the first time and as references after that, as they are for the equivalent Map.
+        for (size_t ii = 0; okSoFar && (2 > ii); ++ii)
+        {
+            boundSource.open(true);
+            EncodeBoundValue(boundSource, record);
+            boundSource.close();
+            boundBytes[ii] = boundSource.getString();
+            mapSource.open(true);
+            mapSource.setValue(makeBoundRecordMap());
+            mapSource.close();
+            mapBytes[ii] = mapSource.getString();
+            allAdded &= queue.addBytesAsMessage(0, ReinterpretCast(CPtr(uint8_t), boundBytes[ii].data()), boundBytes[ii].length(),
+                                                receiverKeys, nullptr, nullptr, true);
+        }
+        if (okSoFar && allAdded && (boundBytes[0] == mapBytes[0]) && (boundBytes[1] == mapBytes[1]) &&
+            (boundBytes[1].length() < boundBytes[0].length()))
+        {
+            for (size_t ii = 0; okSoFar && (2 > ii); ++ii)
+            {
+                auto            received{queue.getNextMessage()};
+                TestBoundRecord decoded;
+
+                okSoFar = (received && (nullptr == received->_receivedMessage) && received->_receivedEncoding &&
+                           DecodeBoundValue(*received->_receivedEncoding, decoded) && (decoded.label == record.label) &&
+                           (decoded.sequence == record.sequence) && (decoded.samples == record.samples) &&
+                           (decoded.tags == record.tags) && (decoded.path.size() == record.path.size()) &&
+                           (decoded.origin.y == record.origin.y) && (decoded.valid == record.valid));
+            }
+            if (okSoFar)
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! (okSoFar)"); //####
+            }
         }
         else
         {
-            ODL_LOG("! (stuff)"); //####
+            ODL_LOG("! (okSoFar && allAdded && the bound struct was encoded as the Map)"); //####
         }
     }
     catch (...)
@@ -1504,7 +2914,7 @@ doTestExtractTimeMessage
     }
     ODL_EXIT_I(result); //####
     return result;
-} // doTestExtractTimeMessage
+} // doTestExtractBoundStructWithKeyDictionaryThroughReceiveQueue
 
 #if defined(__APPLE__)
 # pragma mark *** Test Case 100 ***
@@ -5631,6 +7041,58 @@ main
                         result = doTestExtractTimeMessage(*argv, argc - 1, argv + 2);
                         break;
 
+                    case 17 :
+                        result = doTestExtractBigBlobMessage(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 18 :
+                        result = doTestExtractSchemaCodecMessage(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 19 :
+                        result = doTestExtractBoundStructMessage(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 20 :
+                        result = doTestExtractSinglePrecisionDoublesMessage(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 21 :
+                        result = doTestExtractMapWithKeyDictionaryMessage(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 22 :
+                        result = doTestExtractDeltaEncodedMessages(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 23 :
+                        result = doTestExtractHugeBlobSharesMessageBytes(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 24 :
+                        result = doTestResetMessageWhileBlobIsShared(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 25 :
+                        result = doTestExtractBoundValuesWithDamagedSizes(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 26 :
+                        result = doTestExtractDeltaOnlyWhenSmaller(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 27 :
+                        result = doTestExtractDeltaOfMapModifiedAfterSending(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 28 :
+                        result = doTestExtractSchemaCodecThroughReceiveQueue(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 29 :
+                        result = doTestExtractBoundStructWithKeyDictionaryThroughReceiveQueue(*argv, argc - 1, argv + 2);
+                        break;
+
                     case 100 :
                         result = doTestExtractEmptyArrayMessage(*argv, argc - 1, argv + 2);
                         break;
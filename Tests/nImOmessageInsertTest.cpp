@@ -46,10 +46,13 @@
 #include <BasicTypes/nImOtime.h>
 #include <Containers/nImOarray.h>
 #include <Containers/nImObufferChunk.h>
+#include <Containers/nImOkeyDictionary.h>
 #include <Containers/nImOmap.h>
 #include <Containers/nImOmessage.h>
+#include <Containers/nImOschemaCodec.h>
 #include <Containers/nImOset.h>
 #include <Containers/nImOstringBuffer.h>
+#include <Containers/nImOstructBinding.h>
 #include <Contexts/nImOtestContext.h>
 
 #include <string>
@@ -78,6 +81,53 @@ using namespace nImO;
 # pragma mark Private structures, constants and variables
 #endif // defined(__APPLE__)
 
+/*! @brief A small struct that is written to Messages as a Map. */
+struct TestBoundPoint
+{
+    /*! @brief The horizontal coordinate. */
+    double  x;
+
+    /*! @brief The vertical coordinate. */
+    double  y;
+
+}; // TestBoundPoint
+
+NIMO_BIND_STRUCT(TestBoundPoint, NIMO_BIND_FIELD(TestBoundPoint, x), NIMO_BIND_FIELD(TestBoundPoint, y));
+
+/*! @brief A struct with one field of each supported kind that is written to Messages as a Map. */
+struct TestBoundRecord
+{
+    /*! @brief An empty sequence. */
+    std::vector<int>    empty;
+
+    /*! @brief A string that is too long for the short form. */
+    std::string label;
+
+    /*! @brief A nested struct. */
+    TestBoundPoint  origin;
+
+    /*! @brief A sequence of nested structs. */
+    std::vector<TestBoundPoint> path;
+
+    /*! @brief A sequence of floating-point values. */
+    std::vector<double> samples;
+
+    /*! @brief An integer that is too large for the short form. */
+    int64_t sequence;
+
+    /*! @brief A sequence of strings. */
+    std::vector<std::string>    tags;
+
+    /*! @brief A logical value. */
+    bool    valid;
+
+}; // TestBoundRecord
+
+NIMO_BIND_STRUCT(TestBoundRecord, NIMO_BIND_FIELD(TestBoundRecord, valid), NIMO_BIND_FIELD(TestBoundRecord, sequence),
+                 NIMO_BIND_FIELD(TestBoundRecord, label), NIMO_BIND_FIELD(TestBoundRecord, samples),
+                 NIMO_BIND_FIELD(TestBoundRecord, path), NIMO_BIND_FIELD(TestBoundRecord, tags),
+                 NIMO_BIND_FIELD(TestBoundRecord, origin), NIMO_BIND_FIELD(TestBoundRecord, empty));
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -102,6 +152,55 @@ catchSignal
     exit(1);
 } // catchSignal
 
+/*! @brief Return the Map that is equivalent to a TestBoundPoint.
+ @param[in] xValue The horizontal coordinate.
+ @param[in] yValue The vertical coordinate.
+ @return The equivalent Map. */
+static SpMap
+makeBoundPointMap
+    (const double   xValue,
+     const double   yValue)
+{
+    ODL_ENTER(); //####
+    auto    result{std::make_shared<Map>()};
+
+    result->addValue(std::make_shared<String>("x"), std::make_shared<Double>(xValue));
+    result->addValue(std::make_shared<String>("y"), std::make_shared<Double>(yValue));
+    ODL_EXIT_P(result.get()); //####
+    return result;
+} // makeBoundPointMap
+
+/*! @brief Return the Map that is equivalent to the TestBoundRecord used by the tests.
+ @return The equivalent Map. */
+static SpMap
+makeBoundRecordMap
+    (void)
+{
+    ODL_ENTER(); //####
+    auto    result{std::make_shared<Map>()};
+    auto    path{std::make_shared<Array>()};
+    auto    samples{std::make_shared<Array>()};
+    auto    tags{std::make_shared<Array>()};
+
+    path->addValue(makeBoundPointMap(1, 2));
+    path->addValue(makeBoundPointMap(-3, 4.5));
+    samples->addValue(std::make_shared<Double>(1.5));
+    samples->addValue(std::make_shared<Double>(2.5));
+    samples->addValue(std::make_shared<Double>(-3.25));
+    tags->addValue(std::make_shared<String>("a"));
+    tags->addValue(std::make_shared<String>("bc"));
+    result->addValue(std::make_shared<String>("empty"), std::make_shared<Array>());
+    result->addValue(std::make_shared<String>("label"), std::make_shared<String>("a label that is not short"));
+    result->addValue(std::make_shared<String>("origin"), makeBoundPointMap(0.5, -0.5));
+    result->addValue(std::make_shared<String>("path"), path);
+    result->addValue(std::make_shared<String>("samples"), samples);
+    result->addValue(std::make_shared<String>("sequence"), std::make_shared<Integer>(-123456));
+    result->addValue(std::make_shared<String>("tags"), tags);
+    result->addValue(std::make_shared<String>("valid"), std::make_shared<Logical>(true));
+    ODL_EXIT_P(result.get()); //####
+    return result;
+} // makeBoundRecordMap
+
 /*! @brief Put a Value into a Message and verify what was stored.
  @param[in,out] stuff The Message to be modified.
  @param[in] aValue The Value to be added to the Message.
@@ -5256,6 +5355,391 @@ doTestInsertTimeSetMessage
     return result;
 } // doTestInsertTimeSetMessage
 
+#if defined(__APPLE__)
+# pragma mark *** Test Case 172 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestInsertSchemaCodecMessage
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            static const double fieldValues[]{ 1.5, -2.25, 1234.5, 0.125 };
+            auto                schema{std::make_shared<Map>()};
+            auto                position{std::make_shared<Array>()};
+            auto                expected{std::make_shared<Map>()};
+            auto                expectedPosition{std::make_shared<Array>()};
+
+            for (size_t ii = 0; 3 > ii; ++ii)
+            {
+                position->addValue(std::make_shared<Double>());
+                expectedPosition->addValue(std::make_shared<Double>(fieldValues[ii]));
+            }
+            schema->addValue(std::make_shared<String>("name"), std::make_shared<String>("pose"));
+            schema->addValue(std::make_shared<String>("position"), position);
+            schema->addValue(std::make_shared<String>("stamp"), std::make_shared<Double>());
+            expected->addValue(std::make_shared<String>("name"), std::make_shared<String>("pose"));
+            expected->addValue(std::make_shared<String>("position"), expectedPosition);
+            expected->addValue(std::make_shared<String>("stamp"), std::make_shared<Double>(fieldValues[3]));
+            SchemaCodec codec{schema};
+
+            if (codec.isValid() && (4 == codec.getFieldCount()) && (1 == codec.getFieldIndex("position[1]")) &&
+                (3 == codec.getFieldIndex("stamp")))
+            {
+                Message reference;
+
+                reference.open(true);
+                reference.setValue(expected);
+                reference.close();
+                stuff->open(true);
+                codec.encode(*stuff, fieldValues);
+                stuff->close();
+                if (reference.getString() == stuff->getString())
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (reference.getString() == stuff->getString())"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (codec.isValid() && (4 == codec.getFieldCount()) && (1 == codec.getFieldIndex(\"position[1]\")) && (3 == codec.getFieldIndex(\"stamp\")))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestInsertSchemaCodecMessage
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 173 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestInsertBoundStructMessage
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            TestBoundRecord record;
+
+            record.label = "a label that is not short";
+            record.origin = TestBoundPoint{0.5, -0.5};
+            record.path = {TestBoundPoint{1, 2}, TestBoundPoint{-3, 4.5}};
+            record.samples = {1.5, 2.5, -3.25};
+            record.sequence = -123456;
+            record.tags = {"a", "bc"};
+            record.valid = true;
+            Message reference;
+
+            reference.open(true);
+            reference.setValue(makeBoundRecordMap());
+            reference.close();
+            stuff->open(true);
+            EncodeBoundValue(*stuff, record);
+            stuff->close();
+            if (reference.getString() == stuff->getString())
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! (reference.getString() == stuff->getString())"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestInsertBoundStructMessage
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 174 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestInsertSinglePrecisionDoublesMessage
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            static const DataKind   expectedArraySingleDoublesBytes[]
+            {
+                // Start of Message
+                DataKind::StartOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedOtherValue,
+                // Start of Array
+                DataKind::Other | DataKind::OtherContainerStart |
+                  DataKind::OtherContainerTypeArray |
+                  DataKind::OtherContainerNonEmptyValue,
+                // Signed Integer
+                DataKind::Integer |
+                  DataKind::IntegerShortValue |
+                  ((2 + kDataKindIntegerShortValueMinValue - 1) &
+                    DataKind::IntegerShortValueValueMask),
+                // Double
+                DataKind::Double | DataKind::DoubleLongCount |
+                  DataKind::DoubleLongCountSinglePrecisionValue |
+                  ((1 - 1) & DataKind::DoubleLongCountMask),
+                StaticCast(DataKind, 2),
+                StaticCast(DataKind, 0x42), StaticCast(DataKind, 0x2A),
+                StaticCast(DataKind, 0x00), StaticCast(DataKind, 0x00),
+                StaticCast(DataKind, 0xC2), StaticCast(DataKind, 0x2A),
+                StaticCast(DataKind, 0x00), StaticCast(DataKind, 0x00),
+                // End of Array
+                DataKind::Other | DataKind::OtherContainerEnd |
+                  DataKind::OtherContainerTypeArray |
+                  DataKind::OtherContainerNonEmptyValue,
+                // End of Message
+                DataKind::EndOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedOtherValue
+            };
+            constexpr size_t        expectedArraySingleDoublesByteCount{numElementsInArray(expectedArraySingleDoublesBytes)};
+            static const DataKind   expectedSingleDoubleBytes[]
+            {
+                // Start of Message
+                DataKind::StartOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedDoubleValue,
+                // Double
+                DataKind::Double | DataKind::DoubleLongCount |
+                  DataKind::DoubleLongCountSinglePrecisionValue |
+                  ((1 - 1) & DataKind::DoubleLongCountMask),
+                StaticCast(DataKind, 1),
+                StaticCast(DataKind, 0x42), StaticCast(DataKind, 0x2A),
+                StaticCast(DataKind, 0x00), StaticCast(DataKind, 0x00),
+                // End of Message
+                DataKind::EndOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedDoubleValue
+            };
+            constexpr size_t        expectedSingleDoubleByteCount{numElementsInArray(expectedSingleDoubleBytes)};
+            auto                    arraySingleDoubles{std::make_shared<Array>()};
+
+            arraySingleDoubles->setSinglePrecision(true);
+            arraySingleDoubles->addValue(std::make_shared<Double>(42.5));
+            arraySingleDoubles->addValue(std::make_shared<Double>(-42.5));
+            result = setValueAndCheck(*stuff, arraySingleDoubles, expectedArraySingleDoublesBytes,
+                                      expectedArraySingleDoublesByteCount);
+            if (0 == result)
+            {
+                stuff->setSinglePrecision(true);
+                result = setValueAndCheck(*stuff, std::make_shared<Double>(42.5), expectedSingleDoubleBytes,
+                                          expectedSingleDoubleByteCount);
+            }
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestInsertSinglePrecisionDoublesMessage
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 175 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestInsertMapWithKeyDictionaryMessage
+    (CPtr(char)     launchPath,
+     const int      argc,
+     Ptr(Ptr(char)) argv)
+{
+    NIMO_UNUSED_VAR_(launchPath);
+    NIMO_UNUSED_VAR_(argc);
+    NIMO_UNUSED_VAR_(argv);
+    ODL_ENTER(); //####
+    //ODL_S1(launchPath); //####
+    //ODL_I1(argc); //####
+    //ODL_P1(argv); //####
+    int result{1};
+
+    try
+    {
+        auto    stuff{std::make_unique<Message>()};
+
+        if (stuff)
+        {
+            static const DataKind   expectedMapWithReferencesBytes[]
+            {
+                // Start of Message
+                DataKind::StartOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedOtherValue,
+                // Start of Map
+                DataKind::Other | DataKind::OtherContainerStart |
+                  DataKind::OtherContainerTypeMap |
+                  DataKind::OtherContainerNonEmptyValue,
+                // Signed Integer
+                DataKind::Integer |
+                  DataKind::IntegerShortValue |
+                  ((2 + kDataKindIntegerShortValueMinValue - 1) &
+                    DataKind::IntegerShortValueValueMask),
+                // Key Reference
+                DataKind::StringOrBlob | DataKind::StringOrBlobStringValue |
+                  DataKind::StringOrBlobLongLengthValue |
+                  DataKind::StringOrBlobLongLengthKeyReferenceValue |
+                  ((1 - 1) & DataKind::StringOrBlobLongLengthMask),
+                StaticCast(DataKind, 0),
+                // Signed Integer
+                DataKind::Integer |
+                  DataKind::IntegerShortValue |
+                  (1 & DataKind::IntegerShortValueValueMask),
+                // Key Reference
+                DataKind::StringOrBlob | DataKind::StringOrBlobStringValue |
+                  DataKind::StringOrBlobLongLengthValue |
+                  DataKind::StringOrBlobLongLengthKeyReferenceValue |
+                  ((1 - 1) & DataKind::StringOrBlobLongLengthMask),
+                StaticCast(DataKind, 1),
+                // Signed Integer
+                DataKind::Integer |
+                  DataKind::IntegerShortValue |
+                  (2 & DataKind::IntegerShortValueValueMask),
+                // End of Map
+                DataKind::Other | DataKind::OtherContainerEnd |
+                  DataKind::OtherContainerTypeMap |
+                  DataKind::OtherContainerNonEmptyValue,
+                // End of Message
+                DataKind::EndOfMessageValue |
+                  DataKind::OtherMessageNonEmptyValue |
+                  DataKind::OtherMessageExpectedOtherValue
+            };
+            constexpr size_t        expectedMapWithReferencesByteCount{numElementsInArray(expectedMapWithReferencesBytes)};
+            auto                    keys{std::make_shared<KeyDictionary>()};
+            auto                    aMap{std::make_shared<Map>()};
+            Message                 reference;
+
+            aMap->addValue(std::make_shared<String>("alpha"), std::make_shared<Integer>(1));
+            aMap->addValue(std::make_shared<String>("beta"), std::make_shared<Integer>(2));
+            reference.open(true);
+            reference.setValue(aMap);
+            reference.close();
+            // The first time that the keys are seen, they are sent in full.
+            stuff->setKeyDictionary(keys);
+            stuff->open(true);
+            stuff->setValue(aMap);
+            stuff->close();
+            if ((reference.getString() == stuff->getString()) && (2 == keys->size()))
+            {
+                result = setValueAndCheck(*stuff, aMap, expectedMapWithReferencesBytes, expectedMapWithReferencesByteCount);
+            }
+            else
+            {
+                ODL_LOG("! ((reference.getString() == stuff->getString()) && (2 == keys->size()))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestInsertMapWithKeyDictionaryMessage
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
@@ -5527,6 +6011,22 @@ main
                         result = doTestInsertTimeSetMessage(*argv, argc - 1, argv + 2);
                         break;
 
+                    case 172 :
+                        result = doTestInsertSchemaCodecMessage(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 173 :
+                        result = doTestInsertBoundStructMessage(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 174 :
+                        result = doTestInsertSinglePrecisionDoublesMessage(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 175 :
+                        result = doTestInsertMapWithKeyDictionaryMessage(*argv, argc - 1, argv + 2);
+                        break;
+
                     default :
                         break;
 
@@ -42,14 +42,27 @@
 #include <BasicTypes/nImOnumber.h>
 #include <BasicTypes/nImOstring.h>
 #include <Containers/nImObufferChunk.h>
+#include <Containers/nImOincrementalParser.h>
+#include <Containers/nImOJSONReader.h>
+#include <Containers/nImOJSONWriter.h>
+#include <Containers/nImOparallelParser.h>
 #include <Containers/nImOstringBuffer.h>
 #include <Contexts/nImOtestContext.h>
+#include <nImOmappedInput.h>
 
+#include <sstream>
 #include <string>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
+#if MAC_OR_LINUX_OR_BSD_
+# include <unistd.h>
+#else // not MAC_OR_LINUX_OR_BSD_
+# include <fcntl.h>
+# include <io.h>
+#endif // not MAC_OR_LINUX_OR_BSD_
+
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -120,6 +133,53 @@ compareValueWithString
     return result;
 } // compareValueWithString
 
+/*! @brief Parse the lines from a MappedInput.
+ @param[in,out] inInput The source of the lines.
+ @param[out] resultString The printed Values, separated by vertical bars.
+ @return @c true if all the lines were parsed as complete Values. */
+static bool
+parseMappedLines
+    (MappedInput &  inInput,
+     std::string &  resultString)
+{
+    ODL_ENTER(); //####
+    ODL_P2(&inInput, &resultString); //####
+    IncrementalParser   parser;
+    bool                okSoFar{true};
+    CPtr(char)          lineStart;
+    size_t              lineLength;
+
+    resultString.clear();
+    for ( ; inInput.getLine(lineStart, lineLength); )
+    {
+        parser.addLine(lineStart, lineLength);
+        for (auto readValue{parser.getNextValue()}; readValue; readValue = parser.getNextValue())
+        {
+            if (nullptr == readValue->asFlaw())
+            {
+                StringBuffer    buff;
+
+                readValue->printToStringBuffer(buff);
+                if (! resultString.empty())
+                {
+                    resultString += " | "s;
+                }
+                resultString += buff.getString();
+            }
+            else
+            {
+                okSoFar = false;
+            }
+        }
+    }
+    if (parser.hasPartialValue())
+    {
+        okSoFar = false;
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // parseMappedLines
+
 #if defined(__APPLE__)
 # pragma mark *** Test Case 01 ***
 #endif // defined(__APPLE__)
@@ -890,6 +950,428 @@ doTestParseImplicitArrayValue
     return result;
 } // doTestParseImplicitArrayValue
 
+#if defined(__APPLE__)
+# pragma mark *** Test Case 11 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] expected @c true if the test is expected to succeed, and @c false otherwise.
+ @param[in] inString The string to be used for the test.
+ @param[in] expectedString The expected output from the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestParseIncrementalValues
+    (const bool expected,
+     CPtr(char) inString,
+     CPtr(char) expectedString)
+{
+    ODL_ENTER(); //####
+    ODL_B1(expected); //####
+    ODL_S2(inString, expectedString); //####
+    int result{1};
+
+    try
+    {
+        IncrementalParser   parser;
+        bool                sawFlaw{false};
+        std::string         resultString;
+
+        // Add the text a character at a time, to check that the parser resumes correctly.
+        for (size_t ii = 0, len = strlen(inString); len > ii; ++ii)
+        {
+            parser.addString(std::string(1, inString[ii]));
+        }
+        parser.addLine(""s);
+        for (auto readValue{parser.getNextValue()}; readValue; readValue = parser.getNextValue())
+        {
+            if (nullptr == readValue->asFlaw())
+            {
+                StringBuffer    buff;
+
+                readValue->printToStringBuffer(buff);
+                if (! resultString.empty())
+                {
+                    resultString += " | "s;
+                }
+                resultString += buff.getString();
+            }
+            else
+            {
+                sawFlaw = true;
+            }
+        }
+        ODL_S1s(resultString); //####
+        if (sawFlaw || parser.hasPartialValue())
+        {
+            if (expected)
+            {
+                ODL_LOG("(expected)"); //####
+            }
+            else
+            {
+                result = 0;
+            }
+        }
+        else
+        {
+            if (expected)
+            {
+                if (resultString == expectedString)
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (resultString == expectedString)"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (expected)"); //####
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestParseIncrementalValues
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 12 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] expected @c true if the test is expected to succeed, and @c false otherwise.
+ @param[in] inString The string to be used for the test.
+ @param[in] expectedString The expected output from the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestParseJSONValues
+    (const bool expected,
+     CPtr(char) inString,
+     CPtr(char) expectedString)
+{
+    ODL_ENTER(); //####
+    ODL_B1(expected); //####
+    ODL_S2(inString, expectedString); //####
+    int result{1};
+
+    try
+    {
+        std::istringstream  inStream{inString};
+        std::ostringstream  outStream;
+        JSONReader          reader{inStream};
+        bool                sawFlaw{false};
+
+        // Write each Value back as compact JSON, one per line.
+        {
+            JSONWriter  writer{outStream, true};
+
+            for (auto readValue{reader.readValue()}; readValue; readValue = reader.readValue())
+            {
+                if (nullptr == readValue->asFlaw())
+                {
+                    writer.writeValue(*readValue);
+                }
+                else
+                {
+                    sawFlaw = true;
+                }
+            }
+        }
+        auto    resultString{outStream.str()};
+
+        ODL_S1s(resultString); //####
+        if (sawFlaw)
+        {
+            if (expected)
+            {
+                ODL_LOG("(expected)"); //####
+            }
+            else
+            {
+                result = 0;
+            }
+        }
+        else
+        {
+            if (expected)
+            {
+                if (resultString == expectedString)
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (resultString == expectedString)"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (expected)"); //####
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestParseJSONValues
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 13 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] expected @c true if the test is expected to succeed, and @c false otherwise.
+ @param[in] inString The string to be used for the test.
+ @param[in] expectedString The expected output from the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestParseMappedValues
+    (const bool expected,
+     CPtr(char) inString,
+     CPtr(char) expectedString)
+{
+    ODL_ENTER(); //####
+    ODL_B1(expected); //####
+    ODL_S2(inString, expectedString); //####
+    int result{1};
+
+    try
+    {
+        size_t      inLength{strlen(inString)};
+        std::string fileResult;
+        std::string pipeResult;
+        bool        fileOK{false};
+        bool        pipeOK{false};
+        auto        tempFile{tmpfile()};
+        int         pipeEnds[2];
+
+        // A regular file is mapped.
+        if (nullptr != tempFile)
+        {
+            fwrite(inString, 1, inLength, tempFile);
+            fflush(tempFile);
+            rewind(tempFile);
+            {
+                MappedInput inInput{fileno(tempFile)};
+
+                fileOK = parseMappedLines(inInput, fileResult) && ((0 == inLength) || inInput.isMapped());
+            }
+            fclose(tempFile);
+        }
+        // A pipe is read a block at a time.
+#if MAC_OR_LINUX_OR_BSD_
+        if (0 == pipe(pipeEnds))
+#else // not MAC_OR_LINUX_OR_BSD_
+        if (0 == _pipe(pipeEnds, 4096, _O_BINARY))
+#endif // not MAC_OR_LINUX_OR_BSD_
+        {
+#if MAC_OR_LINUX_OR_BSD_
+            NIMO_UNUSED_VAR_(write(pipeEnds[1], inString, inLength));
+            close(pipeEnds[1]);
+#else // not MAC_OR_LINUX_OR_BSD_
+            _write(pipeEnds[1], inString, StaticCast(unsigned int, inLength));
+            _close(pipeEnds[1]);
+#endif // not MAC_OR_LINUX_OR_BSD_
+            {
+                MappedInput inInput{pipeEnds[0]};
+
+                pipeOK = parseMappedLines(inInput, pipeResult) && (! inInput.isMapped());
+            }
+#if MAC_OR_LINUX_OR_BSD_
+            close(pipeEnds[0]);
+#else // not MAC_OR_LINUX_OR_BSD_
+            _close(pipeEnds[0]);
+#endif // not MAC_OR_LINUX_OR_BSD_
+        }
+        ODL_S2s(fileResult, pipeResult); //####
+        if (fileOK && pipeOK)
+        {
+            if (expected)
+            {
+                if ((fileResult == expectedString) && (pipeResult == expectedString))
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! ((fileResult == expectedString) && (pipeResult == expectedString))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (expected)"); //####
+            }
+        }
+        else
+        {
+            if (expected)
+            {
+                ODL_LOG("(expected)"); //####
+            }
+            else
+            {
+                result = 0;
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestParseMappedValues
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 14 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] expected @c true if the test is expected to succeed, and @c false otherwise.
+ @param[in] inString The string to be used for the test.
+ @param[in] expectedString The expected output from the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestParseParallelValues
+    (const bool expected,
+     CPtr(char) inString,
+     CPtr(char) expectedString)
+{
+    ODL_ENTER(); //####
+    ODL_B1(expected); //####
+    ODL_S2(inString, expectedString); //####
+    int result{1};
+
+    try
+    {
+        const size_t        kNumCopies{50};
+        IncrementalParser   parser;
+        std::string         inText;
+        std::string         parallelResult;
+        std::string         sequentialResult;
+        size_t              lineNumber{0};
+        bool                sawFlaw{false};
+        bool                linesMatch{true};
+        size_t              nextParallel{0};
+
+        // Make a recording-like text, with a separator before each copy of the input.
+        for (size_t ii = 0; kNumCopies > ii; ++ii)
+        {
+            inText += kCommentChar;
+            inText += kEndOfLine;
+            inText += inString;
+            inText += kEndOfLine;
+        }
+        // Use tiny pieces, so that the text is split at every separator.
+        auto    parsedValues{ParseValuesInParallel(inText.c_str(), inText.length(), 4, 1)};
+
+        for (auto & aValue : parsedValues)
+        {
+            if (nullptr == aValue._value->asFlaw())
+            {
+                StringBuffer    buff;
+
+                aValue._value->printToStringBuffer(buff);
+                parallelResult += buff.getString() + " | "s;
+            }
+            else
+            {
+                sawFlaw = true;
+            }
+        }
+        // The Values and line numbers must match those from parsing the text in sequence.
+        for (size_t start = 0; start < inText.length(); )
+        {
+            size_t  endOfLine{inText.find(kEndOfLine, start)};
+
+            parser.addLine(inText.substr(start, endOfLine - start));
+            ++lineNumber;
+            start = endOfLine + 1;
+            for (auto readValue{parser.getNextValue()}; readValue; readValue = parser.getNextValue())
+            {
+                if ((nextParallel >= parsedValues.size()) || (parsedValues[nextParallel++]._lineNumber != lineNumber))
+                {
+                    linesMatch = false;
+                }
+                if (nullptr == readValue->asFlaw())
+                {
+                    StringBuffer    buff;
+
+                    readValue->printToStringBuffer(buff);
+                    sequentialResult += buff.getString() + " | "s;
+                }
+            }
+        }
+        ODL_S2s(parallelResult, sequentialResult); //####
+        if (linesMatch && (nextParallel == parsedValues.size()) && (parallelResult == sequentialResult))
+        {
+            if (sawFlaw || parser.hasPartialValue())
+            {
+                if (expected)
+                {
+                    ODL_LOG("(expected)"); //####
+                }
+                else
+                {
+                    result = 0;
+                }
+            }
+            else
+            {
+                if (expected)
+                {
+                    std::string oneCopy{expectedString + " | "s};
+                    std::string allCopies;
+
+                    for (size_t ii = 0; kNumCopies > ii; ++ii)
+                    {
+                        allCopies += oneCopy;
+                    }
+                    if (parallelResult == allCopies)
+                    {
+                        result = 0;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (parallelResult == allCopies)"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (expected)"); //####
+                }
+            }
+        }
+        else
+        {
+            ODL_LOG("! (linesMatch && (nextParallel == parsedValues.size()) && " //####
+                    "(parallelResult == sequentialResult))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestParseParallelValues
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
@@ -972,6 +1454,22 @@ main
                         result = doTestParseImplicitArrayValue(expected, *(argv + 3), *(argv + 4));
                         break;
 
+                    case 11 :
+                        result = doTestParseIncrementalValues(expected, *(argv + 3), *(argv + 4));
+                        break;
+
+                    case 12 :
+                        result = doTestParseJSONValues(expected, *(argv + 3), *(argv + 4));
+                        break;
+
+                    case 13 :
+                        result = doTestParseMappedValues(expected, *(argv + 3), *(argv + 4));
+                        break;
+
+                    case 14 :
+                        result = doTestParseParallelValues(expected, *(argv + 3), *(argv + 4));
+                        break;
+
                     default :
                         break;
 
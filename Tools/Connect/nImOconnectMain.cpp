@@ -37,9 +37,11 @@
 //--------------------------------------------------------------------------------------------------
 
 #include <ArgumentDescriptors/nImOchannelArgumentDescriptor.h>
+#include <ArgumentDescriptors/nImOintegerArgumentDescriptor.h>
 #include <ArgumentDescriptors/nImOstringsArgumentDescriptor.h>
 #include <BasicTypes/nImOaddress.h>
 #include <BasicTypes/nImOinteger.h>
+#include <BasicTypes/nImOlogical.h>
 #include <BasicTypes/nImOstring.h>
 #include <Contexts/nImOutilityContext.h>
 #include <nImOchannelName.h>
@@ -126,6 +128,9 @@ main
                                                                                        nImO::ArgumentMode::Optional |
                                                                                        nImO::ArgumentMode::CaseInsensitive,
                                                                                        nImO::kProtocolAnyName, nImO::ChannelName::transportNames())};
+    auto                    fourthArg{std::make_shared<nImO::IntegerArgumentDescriptor>("compress"s,
+                                                                                        "Smallest Message, in bytes, to compress (0 for none)"s,
+                                                                                        nImO::ArgumentMode::Optional, 0, true, 0, false, 0)};
     nImO::DescriptorVector  argumentList{};
     nImO::StandardOptions   optionValues{};
     int                     exitCode{0};
@@ -139,6 +144,7 @@ main
     argumentList.push_back(firstArg);
     argumentList.push_back(secondArg);
     argumentList.push_back(thirdArg);
+    argumentList.push_back(fourthArg);
     if (nImO::ProcessStandardOptions(argc, argv, argumentList, "Connect two channels"s, "nImOconnect service1/out service2/in udp"s, 2016, nImO::kCopyrightName, optionValues,
                                      helpForConnect, nImO::kSkipExpandedOption | nImO::kSkipFlavoursOption | nImO::kSkipMachineOption))
     {
@@ -259,7 +265,53 @@ main
                 nImO::TransportType fromModes{nImO::TransportType::kUnknown};
                 nImO::TransportType toModes{nImO::TransportType::kUnknown};
                 nImO::TransportType resolvedMode{nImO::TransportType::kUnknown};
+                nImO::Connection    fromConnection;
+                nImO::Connection    toConnection;
 
+                // The node locations are needed to decide if the channels can use shared memory.
+                if (0 == exitCode)
+                {
+                    auto    statusWithNodeInfo{proxy->getNodeInformation(fromNode)};
+
+                    if (statusWithNodeInfo.first.first)
+                    {
+                        if (statusWithNodeInfo.second._found)
+                        {
+                            fromConnection = statusWithNodeInfo.second._connection;
+                        }
+                        else
+                        {
+                            ourContext->report("Unknown node: '"s + fromNode + "'."s);
+                            exitCode = 1;
+                        }
+                    }
+                    else
+                    {
+                        std::cerr << "Problem with 'getNodeInformation': " << statusWithNodeInfo.first.second << ".\n";
+                        exitCode = 1;
+                    }
+                    if (0 == exitCode)
+                    {
+                        statusWithNodeInfo = proxy->getNodeInformation(toNode);
+                        if (statusWithNodeInfo.first.first)
+                        {
+                            if (statusWithNodeInfo.second._found)
+                            {
+                                toConnection = statusWithNodeInfo.second._connection;
+                            }
+                            else
+                            {
+                                ourContext->report("Unknown node: '"s + toNode + "'."s);
+                                exitCode = 1;
+                            }
+                        }
+                        else
+                        {
+                            std::cerr << "Problem with 'getNodeInformation': " << statusWithNodeInfo.first.second << ".\n";
+                            exitCode = 1;
+                        }
+                    }
+                }
                 if (0 == exitCode)
                 {
                     auto    statusWithChannelInfo{proxy->getChannelInformation(fromNode, fromPath)};
@@ -364,7 +416,36 @@ main
                                     }
                                     else
                                     {
-                                        if (nImO::TransportType::kAny == resolvedMode)
+                                        // The local transports are impossible unless both nodes are on the same machine, where shared memory
+                                        // is preferred.
+                                        auto    localModes{nImO::TransportType::kSharedMemory | nImO::TransportType::kLocalStream |
+                                                           nImO::TransportType::kLocalDatagram};
+
+                                        if (nImO::TransportType::kUnknown != (resolvedMode & localModes))
+                                        {
+                                            if (fromConnection._address == toConnection._address)
+                                            {
+                                                if (nImO::TransportType::kSharedMemory == (resolvedMode & nImO::TransportType::kSharedMemory))
+                                                {
+                                                    resolvedMode = nImO::TransportType::kSharedMemory;
+                                                }
+                                            }
+                                            else
+                                            {
+                                                resolvedMode = (resolvedMode & (~ localModes));
+                                                if (nImO::TransportType::kUnknown == resolvedMode)
+                                                {
+                                                    ourContext->report("local transport modes require '"s + fromNode + "' and '"s + toNode +
+                                                                       "' to be on the same machine."s);
+                                                    exitCode = 1;
+                                                }
+                                            }
+                                            ODL_I1(resolvedMode); //####
+                                        }
+                                        if ((0 == exitCode) && (nImO::TransportType::kTCP != resolvedMode) &&
+                                            (nImO::TransportType::kUDP != resolvedMode) && (nImO::TransportType::kSharedMemory != resolvedMode) &&
+                                            (nImO::TransportType::kLocalStream != resolvedMode) &&
+                                            (nImO::TransportType::kLocalDatagram != resolvedMode))
                                         {
                                             ourContext->report("requested transport mode is ambiguous."s);
                                             exitCode = 1;
@@ -402,50 +483,13 @@ main
                 }
                 if (0 == exitCode)
                 {
-                    nImO::Connection    fromConnection;
-                    nImO::Connection    toConnection;
-                    auto                statusWithNodeInfo{proxy->getNodeInformation(fromNode)};
-
-                    if (statusWithNodeInfo.first.first)
-                    {
-                        if (statusWithNodeInfo.second._found)
-                        {
-                            fromConnection = statusWithNodeInfo.second._connection;
-                        }
-                        else
-                        {
-                            ourContext->report("Unknown node: '"s + fromNode + "'."s);
-                            exitCode = 1;
-                        }
-                    }
-                    else
-                    {
-                        std::cerr << "Problem with 'getNodeInformation': " << statusWithNodeInfo.first.second << ".\n";
-                        exitCode = 1;
-                    }
-                    if (0 == exitCode)
-                    {
-                        statusWithNodeInfo = proxy->getNodeInformation(toNode);
-                        if (statusWithNodeInfo.first.first)
-                        {
-                            if (statusWithNodeInfo.second._found)
-                            {
-                                toConnection = statusWithNodeInfo.second._connection;
-                            }
-                            else
-                            {
-                                ourContext->report("Unknown node: '"s + toNode + "'."s);
-                                exitCode = 1;
-                            }
-                        }
-                        else
-                        {
-                            std::cerr << "Problem with 'getNodeInformation': " << statusWithNodeInfo.first.second << ".\n";
-                            exitCode = 1;
-                        }
-                    }
                     nImO::IPv4Address   receiverAddress;
                     nImO::IPv4Port      receiverPort;
+                    bool                useKeyDictionary{false};
+                    bool                receiverAcceptsDeltas{false};
+                    bool                receiverAcceptsFrames{false};
+                    bool                receiverAcceptsCompression{false};
+                    std::string         localEndpointName{};
 
                     if (0 == exitCode)
                     {
@@ -456,6 +500,8 @@ main
                         argArray->addValue(std::make_shared<nImO::String>(toPath));
                         argArray->addValue(std::make_shared<nImO::String>(toDataType));
                         argArray->addValue(std::make_shared<nImO::Integer>(StaticCast(int64_t, resolvedMode)));
+                        argArray->addValue(std::make_shared<nImO::Logical>((nImO::TransportType::kTCP == resolvedMode) ||
+                                                                           (nImO::TransportType::kLocalStream == resolvedMode)));
                         auto    status{nImO::SendRequestWithArgumentsAndNonEmptyResponse(ourContext, toConnection, handler.get(), argArray.get(),
                                                                                          nImO::kSetUpReceiverRequest, nImO::kSetUpReceiverResponse)};
 
@@ -465,6 +511,11 @@ main
 
                             receiverAddress = result._address;
                             receiverPort = result._port;
+                            useKeyDictionary = handler->usesKeyDictionary();
+                            receiverAcceptsDeltas = handler->acceptsDeltaEncoding();
+                            receiverAcceptsFrames = handler->acceptsBinaryFraming();
+                            receiverAcceptsCompression = handler->acceptsCompression();
+                            localEndpointName = handler->localEndpointName();
                         }
                         else
                         {
@@ -474,6 +525,8 @@ main
                     }
                     nImO::IPv4Address   senderAddress;
                     nImO::IPv4Port      senderPort;
+                    bool                useDeltaEncoding{false};
+                    bool                useBinaryFraming{false};
 
                     if (0 == exitCode)
                     {
@@ -486,6 +539,12 @@ main
                         argArray->addValue(std::make_shared<nImO::Integer>(receiverPort));
                         argArray->addValue(std::make_shared<nImO::String>(fromDataType));
                         argArray->addValue(std::make_shared<nImO::Integer>(StaticCast(int64_t, resolvedMode)));
+                        argArray->addValue(std::make_shared<nImO::Logical>(useKeyDictionary));
+                        argArray->addValue(std::make_shared<nImO::Logical>(receiverAcceptsDeltas));
+                        argArray->addValue(std::make_shared<nImO::Logical>(receiverAcceptsFrames));
+                        argArray->addValue(std::make_shared<nImO::Logical>(receiverAcceptsCompression));
+                        argArray->addValue(std::make_shared<nImO::String>(localEndpointName));
+                        argArray->addValue(std::make_shared<nImO::Integer>(fourthArg->getCurrentValue()));
                         auto    status{nImO::SendRequestWithArgumentsAndNonEmptyResponse(ourContext, fromConnection, handler.get(), argArray.get(),
                                                                                          nImO::kSetUpSenderRequest, nImO::kSetUpSenderResponse)};
 
@@ -495,6 +554,8 @@ main
 
                             senderAddress = result._address;
                             senderPort = result._port;
+                            useDeltaEncoding = handler->usesDeltaEncoding();
+                            useBinaryFraming = handler->usesBinaryFraming();
                         }
                         else
                         {
@@ -511,6 +572,8 @@ main
                         argArray->addValue(std::make_shared<nImO::String>(toPath));
                         argArray->addValue(std::make_shared<nImO::Address>(senderAddress));
                         argArray->addValue(std::make_shared<nImO::Integer>(senderPort));
+                        argArray->addValue(std::make_shared<nImO::Logical>(useDeltaEncoding));
+                        argArray->addValue(std::make_shared<nImO::Logical>(useBinaryFraming));
                         auto    status{nImO::SendRequestWithArgumentsAndNonEmptyResponse(ourContext, toConnection, handler.get(), argArray.get(),
                                                                                          nImO::kStartReceiverRequest, nImO::kStartReceiverResponse)};
 
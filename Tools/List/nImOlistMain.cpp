@@ -597,6 +597,18 @@ listChannels
                             modes = nImO::kProtocolUdpName;
                             break;
 
+                        case nImO::TransportType::kSharedMemory :
+                            modes = nImO::kProtocolSharedMemoryName;
+                            break;
+
+                        case nImO::TransportType::kLocalStream :
+                            modes = nImO::kProtocolLocalStreamName;
+                            break;
+
+                        case nImO::TransportType::kLocalDatagram :
+                            modes = nImO::kProtocolLocalDatagramName;
+                            break;
+
                         default :
                             if (nImO::TransportType::kTCP == (theInfo._modes & nImO::TransportType::kTCP))
                             {
@@ -613,6 +625,39 @@ listChannels
                                     modes = nImO::kProtocolUdpName;
                                 }
                             }
+                            if (nImO::TransportType::kSharedMemory == (theInfo._modes & nImO::TransportType::kSharedMemory))
+                            {
+                                if (modes.empty())
+                                {
+                                    modes = nImO::kProtocolSharedMemoryName;
+                                }
+                                else
+                                {
+                                    modes += "+"s + nImO::kProtocolSharedMemoryName;
+                                }
+                            }
+                            if (nImO::TransportType::kLocalStream == (theInfo._modes & nImO::TransportType::kLocalStream))
+                            {
+                                if (modes.empty())
+                                {
+                                    modes = nImO::kProtocolLocalStreamName;
+                                }
+                                else
+                                {
+                                    modes += "+"s + nImO::kProtocolLocalStreamName;
+                                }
+                            }
+                            if (nImO::TransportType::kLocalDatagram == (theInfo._modes & nImO::TransportType::kLocalDatagram))
+                            {
+                                if (modes.empty())
+                                {
+                                    modes = nImO::kProtocolLocalDatagramName;
+                                }
+                                else
+                                {
+                                    modes += "+"s + nImO::kProtocolLocalDatagramName;
+                                }
+                            }
                             break;
                             
                     }
@@ -943,6 +988,18 @@ listConnections
                             mode = nImO::kProtocolUdpName;
                             break;
 
+                        case nImO::TransportType::kSharedMemory :
+                            mode = nImO::kProtocolSharedMemoryName;
+                            break;
+
+                        case nImO::TransportType::kLocalStream :
+                            mode = nImO::kProtocolLocalStreamName;
+                            break;
+
+                        case nImO::TransportType::kLocalDatagram :
+                            mode = nImO::kProtocolLocalDatagramName;
+                            break;
+
                         default :
                             if (nImO::TransportType::kTCP == (theInfo._mode & nImO::TransportType::kTCP))
                             {
@@ -959,6 +1016,39 @@ listConnections
                                     mode = nImO::kProtocolUdpName;
                                 }
                             }
+                            if (nImO::TransportType::kSharedMemory == (theInfo._mode & nImO::TransportType::kSharedMemory))
+                            {
+                                if (mode.empty())
+                                {
+                                    mode = nImO::kProtocolSharedMemoryName;
+                                }
+                                else
+                                {
+                                    mode += '+' + nImO::kProtocolSharedMemoryName;
+                                }
+                            }
+                            if (nImO::TransportType::kLocalStream == (theInfo._mode & nImO::TransportType::kLocalStream))
+                            {
+                                if (mode.empty())
+                                {
+                                    mode = nImO::kProtocolLocalStreamName;
+                                }
+                                else
+                                {
+                                    mode += '+' + nImO::kProtocolLocalStreamName;
+                                }
+                            }
+                            if (nImO::TransportType::kLocalDatagram == (theInfo._mode & nImO::TransportType::kLocalDatagram))
+                            {
+                                if (mode.empty())
+                                {
+                                    mode = nImO::kProtocolLocalDatagramName;
+                                }
+                                else
+                                {
+                                    mode += '+' + nImO::kProtocolLocalDatagramName;
+                                }
+                            }
                             break;
 
                     }
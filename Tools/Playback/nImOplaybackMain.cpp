@@ -40,11 +40,14 @@
 #include <ArgumentDescriptors/nImOdoubleArgumentDescriptor.h>
 #include <ArgumentDescriptors/nImOfilePathArgumentDescriptor.h>
 #include <Containers/nImOarray.h>
-#include <Containers/nImOstringBuffer.h>
+#include <Containers/nImOincrementalParser.h>
+#include <Containers/nImOJSONReader.h>
+#include <Containers/nImOparallelParser.h>
 #include <Contexts/nImOsourceContext.h>
 #include <nImOcallbackFunction.h>
 #include <nImOchannelName.h>
 #include <nImOmainSupport.h>
+#include <nImOmappedInput.h>
 #include <nImOregistryProxy.h>
 #include <nImOserviceOptions.h>
 #include <nImOsourceBreakHandler.h>
@@ -121,7 +124,7 @@ main
     argumentList.push_back(secondArg);
     argumentList.push_back(thirdArg);
     if (nImO::ProcessServiceOptions(argc, argv, argumentList, "Playback from a file to a channel"s, "nImOplayback recording.txt"s, 2024, nImO::kCopyrightName, optionValues,
-                                    nImO::kSkipExpandedOption | nImO::kSkipFlavoursOption | nImO::kSkipInTypeOption))
+                                    nImO::kSkipExpandedOption | nImO::kSkipInTypeOption))
     {
         nImO::LoadConfiguration(optionValues._configFilePath);
         try
@@ -206,30 +209,80 @@ main
                                     if (0 == _access(workingPath.c_str(), 4))
 #endif // not MAC_OR_LINUX_OR_BSD_
                                     {
-                                        std::ifstream   inStream{workingPath};
+                                        nImO::MappedInput   inInput{workingPath};
 
-                                        if (inStream)
+                                        if (inInput.isOpen())
                                         {
                                             auto    outChannel{ourContext->getOutputChannel(outChannelPath)};
 
                                             if (outChannel)
                                             {
-                                                nImO::StringBuffer  inBuffer;
-                                                std::string         inLine;
-                                                nImO::Array         inValues;
+                                                nImO::IncrementalParser inParser;
+                                                nImO::Array             inValues;
+                                                size_t                  lineNumber{0};
 
                                                 std::cout << "ready.\n";
                                                 std::cout.flush();
                                                 // Collect the file as a sequence of objects.
-                                                for ( ; getline(inStream, inLine); )
+                                                if (nImO::OutputFlavour::kFlavourJSON == optionValues._flavour)
                                                 {
-                                                    inBuffer.addString("\n" + inLine);
-                                                    auto    readValue{inBuffer.convertToValue()};
+                                                    nImO::JSONReader    inReader{inInput};
 
-                                                    if (readValue)
+                                                    for (auto readValue{inReader.readValue()}; readValue; readValue = inReader.readValue())
                                                     {
-                                                        inBuffer.reset();
-                                                        inValues.addValue(readValue);
+                                                        if (nullptr == readValue->asFlaw())
+                                                        {
+                                                            inValues.addValue(readValue);
+                                                        }
+                                                        else
+                                                        {
+                                                            std::cerr << "Ignoring invalid JSON text.\n";
+                                                        }
+                                                    }
+                                                }
+                                                else
+                                                {
+                                                    size_t      textLength;
+                                                    CPtr(char)  mappedText{inInput.getMappedText(textLength)};
+
+                                                    // A mapped file can be split up and parsed by several threads.
+                                                    if (nullptr == mappedText)
+                                                    {
+                                                        CPtr(char)  lineStart;
+                                                        size_t      lineLength;
+
+                                                        for ( ; inInput.getLine(lineStart, lineLength); )
+                                                        {
+                                                            ++lineNumber;
+                                                            inParser.addLine(lineStart, lineLength);
+                                                            for (auto readValue{inParser.getNextValue()}; readValue; readValue = inParser.getNextValue())
+                                                            {
+                                                                if (nullptr == readValue->asFlaw())
+                                                                {
+                                                                    inValues.addValue(readValue);
+                                                                }
+                                                                else
+                                                                {
+                                                                    std::cerr << "Ignoring invalid text ending at line " << lineNumber << ".\n";
+                                                                }
+                                                            }
+                                                        }
+                                                    }
+                                                    else
+                                                    {
+                                                        auto    parsedValues{nImO::ParseValuesInParallel(mappedText, textLength)};
+
+                                                        for (auto & aValue : parsedValues)
+                                                        {
+                                                            if (nullptr == aValue._value->asFlaw())
+                                                            {
+                                                                inValues.addValue(aValue._value);
+                                                            }
+                                                            else
+                                                            {
+                                                                std::cerr << "Ignoring invalid text ending at line " << aValue._lineNumber << ".\n";
+                                                            }
+                                                        }
                                                     }
                                                 }
                                                 if (optionValues._waitForConnections)
@@ -40,6 +40,7 @@
 #include <ArgumentDescriptors/nImOstringArgumentDescriptor.h>
 #include <Containers/nImOarray.h>
 #include <Contexts/nImOcontextWithMDNS.h>
+#include <nImOmappedInput.h>
 #include <nImOstandardOptions.h>
 
 //#include <odlEnable.h>
@@ -126,11 +127,13 @@ main
                 {
                     stuffToSend.push_back(header);
                 }
-                std::string inLine;
+                nImO::MappedInput   inInput{fileno(stdin)};
+                CPtr(char)          lineStart;
+                size_t              lineLength;
 
-                for ( ; getline(std::cin, inLine); )
+                for ( ; inInput.getLine(lineStart, lineLength); )
                 {
-                    stuffToSend.push_back(inLine);
+                    stuffToSend.emplace_back(lineStart, lineLength);
                 }
                 if (1 < stuffToSend.size())
                 {
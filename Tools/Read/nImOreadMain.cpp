@@ -36,7 +36,7 @@
 //
 //--------------------------------------------------------------------------------------------------
 
-#include <Containers/nImOstringBuffer.h>
+#include <Containers/nImOJSONWriter.h>
 #include <Contexts/nImOsinkContext.h>
 #include <nImOchannelName.h>
 #include <nImOmainSupport.h>
@@ -105,7 +105,7 @@ main
     nImO::Initialize();
     nImO::ReportVersions();
     if (nImO::ProcessServiceOptions(argc, argv, argumentList, "Read from a channel"s, "nImOread"s, 2016, nImO::kCopyrightName, optionValues,
-                                    nImO::kSkipExpandedOption | nImO::kSkipFlavoursOption | nImO::kSkipOutTypeOption))
+                                    nImO::kSkipExpandedOption | nImO::kSkipOutTypeOption))
     {
         nImO::LoadConfiguration(optionValues._configFilePath);
         try
@@ -201,6 +201,10 @@ main
                                         std::cout << "ready.\n";
                                         std::cout.flush();
                                     }
+                                    nImO::JSONWriter        jsonWriter{std::cout};
+                                    nImO::StreamTextSink    textSink{std::cout};
+                                    nImO::StringBuffer      textBuffer{textSink};
+
                                     for ( ; nImO::gKeepRunning; )
                                     {
                                         boost::this_thread::yield();
@@ -210,13 +214,18 @@ main
                                         {
                                             if (nextData)
                                             {
-                                                auto                contents{nextData->_receivedMessage};
-                                                nImO::StringBuffer  buff;
-
-                                                contents->printToStringBuffer(buff);
-                                                auto    valString{buff.getString()};
+                                                auto    contents{nextData->_receivedMessage};
 
-                                                std::cout << valString << "\n";
+                                                if (nImO::OutputFlavour::kFlavourJSON == optionValues._flavour)
+                                                {
+                                                    jsonWriter.writeValue(*contents);
+                                                }
+                                                else
+                                                {
+                                                    contents->printToStringBuffer(textBuffer);
+                                                    textBuffer.appendChar('\n');
+                                                    textBuffer.flush();
+                                                }
                                             }
                                         }
                                     }
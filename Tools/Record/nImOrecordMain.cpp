@@ -37,7 +37,7 @@
 //--------------------------------------------------------------------------------------------------
 
 #include <ArgumentDescriptors/nImOfilePathArgumentDescriptor.h>
-#include <Containers/nImOstringBuffer.h>
+#include <Containers/nImOJSONWriter.h>
 #include <Contexts/nImOsinkContext.h>
 #include <nImOchannelName.h>
 #include <nImOmainSupport.h>
@@ -107,7 +107,7 @@ main
     nImO::ReportVersions();
     argumentList.push_back(firstArg);
     if (nImO::ProcessServiceOptions(argc, argv, argumentList, "Record to a file from a channel"s, "nImOrecord recording.txt"s, 2024, nImO::kCopyrightName, optionValues,
-                                    nImO::kSkipExpandedOption | nImO::kSkipFlavoursOption | nImO::kSkipOutTypeOption))
+                                    nImO::kSkipExpandedOption | nImO::kSkipOutTypeOption))
     {
         nImO::LoadConfiguration(optionValues._configFilePath);
         try
@@ -208,6 +208,10 @@ main
                                             std::cout << "ready.\n";
                                             std::cout.flush();
                                         }
+                                        nImO::JSONWriter        jsonWriter{outStream};
+                                        nImO::StreamTextSink    textSink{outStream};
+                                        nImO::StringBuffer      textBuffer{textSink};
+
                                         for ( ; nImO::gKeepRunning; )
                                         {
                                             boost::this_thread::yield();
@@ -217,14 +221,21 @@ main
                                             {
                                                 if (nextData)
                                                 {
-                                                    auto                contents{nextData->_receivedMessage};
-                                                    nImO::StringBuffer  buff;
-
-                                                    contents->printToStringBuffer(buff);
-                                                    auto    valString{buff.getString()};
+                                                    auto    contents{nextData->_receivedMessage};
 
-                                                    outStream << nImO::kCommentChar << "\n" << valString << "\n";
-                                                    outStream.flush();
+                                                    // JSON has no comments, so each Value is written as a line of its own.
+                                                    if (nImO::OutputFlavour::kFlavourJSON == optionValues._flavour)
+                                                    {
+                                                        jsonWriter.writeValue(*contents);
+                                                    }
+                                                    else
+                                                    {
+                                                        textBuffer.appendChar(nImO::kCommentChar);
+                                                        textBuffer.appendChar('\n');
+                                                        contents->printToStringBuffer(textBuffer);
+                                                        textBuffer.appendChar('\n');
+                                                        textBuffer.flush();
+                                                    }
                                                 }
                                             }
                                         }
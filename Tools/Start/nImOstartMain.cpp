@@ -449,6 +449,10 @@ main
                                     optionNeedsString.insert(charWalker);
                                     break;
 
+                                case 'j' :
+                                    std::cout << "Read or write Values as JSON";
+                                    break;
+
                                 case 'l' :
                                     std::cout << "Log the application";
                                     break;
@@ -36,16 +36,19 @@
 //
 //--------------------------------------------------------------------------------------------------
 
-#include <Containers/nImOstringBuffer.h>
+#include <Containers/nImOincrementalParser.h>
+#include <Containers/nImOJSONReader.h>
 #include <Contexts/nImOsourceContext.h>
 #include <nImOcallbackFunction.h>
 #include <nImOchannelName.h>
 #include <nImOmainSupport.h>
+#include <nImOmappedInput.h>
 #include <nImOregistryProxy.h>
 #include <nImOserviceOptions.h>
 #include <nImOsourceBreakHandler.h>
 
 #include <chrono>
+#include <sstream>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -94,17 +97,19 @@ static void
 gatherLines
     (std::string &  outLine)
 {
-    std::string inLine{};
+    nImO::MappedInput   inInput{fileno(stdin)};
+    CPtr(char)          lineStart;
+    size_t              lineLength;
 
     for ( ; nImO::gKeepRunning; )
     {
         boost::this_thread::yield();
-        if (getline(std::cin, inLine))
+        if (inInput.getLine(lineStart, lineLength))
         {
             {
                 std::lock_guard<std::mutex>  lock{lReceivedLock};
 
-                outLine = inLine;
+                outLine.assign(lineStart, lineLength);
             }
             lReceivedCondition.notify_one();
         }
@@ -139,7 +144,7 @@ main
     nImO::Initialize();
     nImO::ReportVersions();
     if (nImO::ProcessServiceOptions(argc, argv, argumentList, "Write to a channel"s, "nImOwrite"s, 2016, nImO::kCopyrightName, optionValues,
-                                    nImO::kSkipExpandedOption | nImO::kSkipFlavoursOption | nImO::kSkipInTypeOption))
+                                    nImO::kSkipExpandedOption | nImO::kSkipInTypeOption))
     {
         nImO::LoadConfiguration(optionValues._configFilePath);
         try
@@ -233,13 +238,13 @@ main
                                             }
                                         }
                                         ourContext->report("waiting for input."s);
-                                        nImO::StringBuffer  inBuffer;
-                                        std::string         inLine;
-                                        auto                aThread{new boost::thread([&inLine]
-                                                                                        (void)
-                                                                                        {
-                                                                                            gatherLines(inLine);
-                                                                                        })};
+                                        nImO::IncrementalParser inParser;
+                                        std::string             inLine;
+                                        auto                    aThread{new boost::thread([&inLine]
+                                                                                            (void)
+                                                                                            {
+                                                                                                gatherLines(inLine);
+                                                                                            })};
 
                                         ODL_P1(aThread); //####
                                         aThread->detach();
@@ -264,14 +269,33 @@ main
                                             }
                                             if (nImO::gKeepRunning)
                                             {
-                                                inBuffer.addString("\n" + inLine);
-                                                inLine.clear();
-                                                auto    readValue{inBuffer.convertToValue()};
+                                                std::vector<nImO::SpValue>  inValues;
 
-                                                if (readValue)
+                                                // JSON input is read a line at a time, as each line is expected to be a complete JSON text.
+                                                if (nImO::OutputFlavour::kFlavourJSON == optionValues._flavour)
                                                 {
-                                                    inBuffer.reset();
-                                                    if (nImO::gKeepRunning)
+                                                    std::istringstream  lineStream{inLine};
+                                                    nImO::JSONReader    lineReader{lineStream};
+
+                                                    for (auto readValue{lineReader.readValue()}; readValue; readValue = lineReader.readValue())
+                                                    {
+                                                        inValues.push_back(readValue);
+                                                    }
+                                                }
+                                                else
+                                                {
+                                                    inParser.addLine(inLine);
+                                                    for (auto readValue{inParser.getNextValue()}; readValue; readValue = inParser.getNextValue())
+                                                    {
+                                                        inValues.push_back(readValue);
+                                                    }
+                                                }
+                                                inLine.clear();
+                                                for (size_t ii = 0; nImO::gKeepRunning && (ii < inValues.size()); ++ii)
+                                                {
+                                                    auto    readValue{inValues[ii]};
+
+                                                    if (nullptr == readValue->asFlaw())
                                                     {
                                                         if (! outChannel->send(readValue))
                                                         {
@@ -282,6 +306,15 @@ main
 
                                                         }
                                                     }
+                                                    else
+                                                    {
+                                                        std::cerr << "Ignoring invalid text.\n";
+                                                    }
+                                                }
+                                                if (0 != exitCode)
+                                                {
+                                                    break;
+
                                                 }
                                             }
                                         }
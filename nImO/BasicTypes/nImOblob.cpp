@@ -187,27 +187,37 @@ nImO::Blob::Blob
     if ((nullptr != data) && (0 < size))
     {
         _size = size;
-        _value = std::make_unique<uint8_t[]>(_size);
+        _value.reset(new uint8_t[_size]);
         memcpy(_value.get(), data, _size);
     }
     ODL_EXIT_P(this); //####
 } // nImO::Blob::Blob
 
 nImO::Blob::Blob
-    (const Blob &   other) :
+    (SpAuint8_t     data,
+     const size_t   size) :
         inherited{}, _value{}, _size{0}
 {
     ODL_ENTER(); //####
-    ODL_P1(&other); //####
-    if (0 < other._size)
+    ODL_P1(data.get()); //####
+    ODL_I1(size); //####
+    if (data && (0 < size))
     {
-        _size = other._size;
-        _value = std::make_unique<uint8_t[]>(_size);
-        memcpy(_value.get(), other._value.get(), _size);
+        _size = size;
+        _value = data;
     }
     ODL_EXIT_P(this); //####
 } // nImO::Blob::Blob
 
+nImO::Blob::Blob
+    (const Blob &   other) :
+        inherited{}, _value{other._value}, _size{other._size}
+{
+    ODL_ENTER(); //####
+    ODL_P1(&other); //####
+    ODL_EXIT_P(this); //####
+} // nImO::Blob::Blob
+
 nImO::Blob::Blob
     (Blob &&    other)
     noexcept :
@@ -362,31 +372,23 @@ nImO::Blob::extractValue
     }
     if (0 < numBytes)
     {
-        auto    holder{std::make_unique<uint8_t[]>(numBytes)};
-        bool    okSoFar{nullptr != holder};
+        // Share the bytes with the Message, rather than copying them, where possible.
+        auto    holder{theMessage.getSharedBytes(position, numBytes)};
 
-        for (size_t ii = 0; okSoFar && (numBytes > ii); ++ii)
+        if (holder)
         {
-            int aByte{theMessage.getByte(position, atEnd)};
-
-            if (atEnd)
-            {
-                ODL_LOG("(atEnd)"); //####
-                result.reset();
-                okSoFar = false;
-                ODL_B1(okSoFar); //####
-            }
-            else
-            {
-                holder[ii] = StaticCast(uint8_t, aByte);
-                ++position;
-                ODL_I1(position); //####
-            }
+            result = std::make_shared<Blob>(holder, numBytes);
+            position += numBytes;
+            ODL_I2(numBytes, position); //####
         }
-        if (okSoFar)
+        else
         {
-            result = std::make_shared<Blob>(holder.get(), numBytes);
-            ODL_I1(numBytes); //####
+            ODL_LOG("! (holder)"); //####
+            // Consume what is there, as a byte-by-byte read would have.
+            for ( ; ! theMessage.atEnd(position); ++position)
+            {
+            }
+            result.reset();
         }
     }
     else
@@ -575,13 +577,8 @@ nImO::Blob::operator=
     ODL_P1(&other); //####
     if (this != &other)
     {
-        removeAllEntries();
-        if (0 < other._size)
-        {
-            _size = other._size;
-            _value = std::make_unique<uint8_t[]>(_size);
-            memcpy(_value.get(), other._value.get(), _size);
-        }
+        _value = other._value;
+        _size = other._size;
     }
     ODL_OBJEXIT_P(this);
     return *this;
@@ -54,7 +54,98 @@
 
 namespace nImO
 {
-    /*! @brief A class to provide binary data with unknown structure. */
+    /*! @brief A read-only view of a sequence of bytes. */
+    class ByteSpan final
+    {
+
+        public :
+            // Public methods.
+
+            /*! @brief The constructor.
+             @param[in] first The first byte of the sequence.
+             @param[in] count The number of bytes in the sequence. */
+            inline ByteSpan
+                (CPtr(uint8_t)  first = nullptr,
+                 const size_t   count = 0) :
+                    _data{first}, _size{count}
+            {
+            }
+
+            /*! @brief Return the start of the sequence.
+             @return The first byte of the sequence. */
+            inline CPtr(uint8_t)
+            begin
+                (void)
+                const
+            {
+                return _data;
+            }
+
+            /*! @brief Return the start of the sequence.
+             @return The first byte of the sequence. */
+            inline CPtr(uint8_t)
+            data
+                (void)
+                const
+            {
+                return _data;
+            }
+
+            /*! @brief Return @c true if the sequence has no bytes.
+             @return @c true if the sequence has no bytes. */
+            inline bool
+            empty
+                (void)
+                const
+            {
+                return (0 == _size);
+            }
+
+            /*! @brief Return the end of the sequence.
+             @return The location just past the last byte of the sequence. */
+            inline CPtr(uint8_t)
+            end
+                (void)
+                const
+            {
+                return _data + _size;
+            }
+
+            /*! @brief Return a byte of the sequence.
+             @param[in] index The zero-based location in the sequence.
+             @return The byte at the given location. */
+            inline uint8_t
+            operator[]
+                (const size_t   index)
+                const
+            {
+                return _data[index];
+            }
+
+            /*! @brief Return the number of bytes in the sequence.
+             @return The number of bytes in the sequence. */
+            inline size_t
+            size
+                (void)
+                const
+            {
+                return _size;
+            }
+
+        private :
+            // Private fields.
+
+            /*! @brief The first byte of the sequence. */
+            CPtr(uint8_t)   _data{nullptr};
+
+            /*! @brief The number of bytes in the sequence. */
+            size_t  _size{0};
+
+    }; // ByteSpan
+
+    /*! @brief A class to provide binary data with unknown structure.
+     Note that the data is never modified once it has been set, so that copies of a Blob, and Blobs
+     extracted from a Message, can share the data rather than copy it. */
     class Blob final : public Value
     {
 
@@ -84,7 +175,16 @@ namespace nImO
                 (CPtr(uint8_t)  data,
                  const size_t   size);
 
+            /*! @brief The constructor.
+             Note that the data is shared with the caller rather than copied.
+             @param[in] data The data to be placed in the object.
+             @param[in] size The number of bytes in the data. */
+            Blob
+                (SpAuint8_t     data,
+                 const size_t   size);
+
             /*! @brief The copy constructor.
+             Note that the data is shared with the other object rather than copied.
              @param[in] other The object to be copied. */
             Blob
                 (const Blob &   other);
@@ -135,6 +235,16 @@ namespace nImO
                 const
                 override;
 
+            /*! @brief Return the value of the object.
+             @return A view of the bytes of the object. */
+            inline ByteSpan
+            getBytes
+                (void)
+                const
+            {
+                return ByteSpan{_value.get(), _size};
+            }
+
             /*! @brief Get the extraction information for Blob objects.
              @param[out] aByte The byte value that indicates the start of a Blob value.
              @param[out] aMask The mask to apply to a lead byte.
@@ -200,6 +310,7 @@ namespace nImO
                 override;
 
             /*! @brief The copy assignment operator.
+             Note that the data is shared with the other object rather than copied.
              @param[in] other The object to be copied.
              @return The updated object. */
             Blob &
@@ -301,7 +412,7 @@ namespace nImO
             // Private fields.
 
             /*! @brief The associated value. */
-            UpAuint8_t  _value{};
+            SpAuint8_t  _value{};
 
             /*! @brief The size of the associated value. */
             size_t  _size{0};
@@ -234,6 +234,9 @@ nImO::Double::extractValue
     SpValue result;
     bool    atEnd;
     bool    isShort{DataKind::DoubleShortCount == (DataKind::DoubleCountMask & leadByte)};
+    bool    isSingle{(! isShort) && (DataKind::DoubleLongCountSinglePrecisionValue ==
+                                     (DataKind::DoubleLongCountSinglePrecisionValue & leadByte))};
+    size_t  valueSize{isSingle ? sizeof(float) : sizeof(double)};
     int64_t howMany;
 
     ++position; // We will always accept the lead byte
@@ -287,7 +290,7 @@ nImO::Double::extractValue
         }
         for (int64_t ii = 0; okSoFar && (howMany > ii); ++ii)
         {
-            for (size_t jj = 0; okSoFar && (sizeof(int64_t) > jj); ++jj)
+            for (size_t jj = 0; okSoFar && (valueSize > jj); ++jj)
             {
                 int aByte{theMessage.getByte(position, atEnd)};
 
@@ -307,7 +310,8 @@ nImO::Double::extractValue
             }
             if (okSoFar)
             {
-                result = std::make_shared<Double>(B2D(holder));
+                // Single-precision values are widened.
+                result = std::make_shared<Double>(isSingle ? B2F(holder) : B2D(holder));
                 if (parentValue && result)
                 {
                     ODL_LOG("(parentValue && result)"); //####
@@ -587,24 +591,38 @@ nImO::Double::writeToMessage
 {
     ODL_OBJENTER(); //####
     ODL_P1(&outMessage); //####
-    NumberAsBytes   numBuff;
+    if (outMessage.usesSinglePrecision())
+    {
+        ODL_LOG("(outMessage.usesSinglePrecision())"); //####
+        std::queue<double>  values;
+
+        values.push(_floatValue);
+        writeValuesToMessage(values, outMessage);
+    }
+    else
+    {
+        ODL_LOG("! (outMessage.usesSinglePrecision())"); //####
+        NumberAsBytes   numBuff;
 
-    D2B(_floatValue, numBuff);
-    DataKind    stuff{DataKind::Double | DataKind::DoubleShortCount |
-                        ((1 - kDataKindDoubleShortCountMinValue) & DataKind::DoubleShortCountMask)};
+        D2B(_floatValue, numBuff);
+        DataKind    stuff{DataKind::Double | DataKind::DoubleShortCount |
+                            ((1 - kDataKindDoubleShortCountMinValue) & DataKind::DoubleShortCountMask)};
 
-    outMessage.appendBytes(&stuff, sizeof(stuff));
-    outMessage.appendBytes(numBuff, sizeof(numBuff));
+        outMessage.appendBytes(&stuff, sizeof(stuff));
+        outMessage.appendBytes(numBuff, sizeof(numBuff));
+    }
     ODL_OBJEXIT(); //####
 } // nImO::Double::writeToMessage
 
 void
 nImO::Double::writeValuesToMessage
     (std::queue<double> &   values,
-     nImO::Message &        outMessage)
+     nImO::Message &        outMessage,
+     const bool             singlePrecision)
 {
     ODL_ENTER(); //####
     ODL_P2(&values, &outMessage); //####
+    ODL_B1(singlePrecision); //####
     NumberAsBytes   numBuff;
     size_t          numValues{values.size()};
 
@@ -612,9 +630,12 @@ nImO::Double::writeValuesToMessage
     if (0 < numValues)
     {
         ODL_LOG("(0 < numValues)"); //####
-        if (StaticCast(size_t, kDataKindDoubleShortCountMaxValue) < numValues)
+        bool    useSingle{singlePrecision || outMessage.usesSinglePrecision()};
+
+        // Single-precision values are only written with a long count.
+        if (useSingle || (StaticCast(size_t, kDataKindDoubleShortCountMaxValue) < numValues))
         {
-            ODL_LOG("(StaticCast(size_t, kDataKindDoubleShortCountMaxValue) < numValues)"); //####
+            ODL_LOG("(useSingle || (StaticCast(size_t, kDataKindDoubleShortCountMaxValue) < numValues))"); //####
             size_t  numBytes{I2B(numValues, numBuff)};
 
             if (0 < numBytes)
@@ -624,13 +645,18 @@ nImO::Double::writeValuesToMessage
                                         (DataKind::DoubleLongCountMask &
                                          StaticCast(DataKind, numBytes - 1))};
 
+                if (useSingle)
+                {
+                    ODL_LOG("(useSingle)"); //####
+                    countTag = (countTag | DataKind::DoubleLongCountSinglePrecisionValue);
+                }
                 outMessage.appendBytes(&countTag, sizeof(countTag));
                 outMessage.appendBytes(numBuff + sizeof(numBuff) - numBytes, numBytes);
             }
         }
         else
         {
-            ODL_LOG("! (StaticCast(size_t, kDataKindDoubleShortCountMaxValue) < numValues)"); //####
+            ODL_LOG("! (useSingle || (StaticCast(size_t, kDataKindDoubleShortCountMaxValue) < numValues))"); //####
             DataKind    countTag{DataKind::Double | DataKind::DoubleShortCount |
                                     (StaticCast(DataKind, numValues - kDataKindDoubleShortCountMinValue) &
                                      DataKind::DoubleShortCountMask)};
@@ -642,8 +668,16 @@ nImO::Double::writeValuesToMessage
         {
             double  aValue{values.front()};
 
-            D2B(aValue, numBuff);
-            outMessage.appendBytes(numBuff, sizeof(numBuff));
+            if (useSingle)
+            {
+                F2B(StaticCast(float, aValue), numBuff);
+                outMessage.appendBytes(numBuff, sizeof(float));
+            }
+            else
+            {
+                D2B(aValue, numBuff);
+                outMessage.appendBytes(numBuff, sizeof(numBuff));
+            }
         }
     }
     ODL_EXIT(); //####
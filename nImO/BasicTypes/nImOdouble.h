@@ -265,12 +265,16 @@ namespace nImO
                 override;
 
             /*! @brief Add the binary representation of a sequence of values to the message.
+             Note that the values are written as single-precision values if requested or if the Message
+             has been set to use single-precision values.
              @param[in,out] values The values to be added.
-             @param[in,out] outMessage The Message to be appended to. */
+             @param[in,out] outMessage The Message to be appended to.
+             @param[in] singlePrecision @c true if the values are to be written as single-precision values. */
             static void
             writeValuesToMessage
                 (std::queue<double> &   values,
-                 Message &              outMessage);
+                 Message &              outMessage,
+                 const bool             singlePrecision = false);
 
         protected :
             // Protected methods.
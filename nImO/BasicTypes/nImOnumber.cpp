@@ -42,6 +42,8 @@
 #include <BasicTypes/nImOinteger.h>
 #include <Containers/nImOstringBuffer.h>
 
+#include <charconv>
+
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
@@ -174,17 +176,27 @@ nImO::Number::readFromStringBuffer
     bool        sawExponentMinus(false);
     bool        sawExponentPlus(false);
     bool        valid(false);
-    int64_t     integerPart(0);
-    int64_t     fractionPart(0);
-    int         exponent(0);
-    int         fractionPower(0);
     ScanState   currentState{ScanState::Initial};
     SpValue     result;
     size_t      localIndex{position};
+    size_t      spanLength{0};
+    size_t      spanIndex{0};
+    size_t      firstSpanLength;
+    CPtr(char)  firstSpan;
+    CPtr(char)  span{ReinterpretCast(CPtr(char), inBuffer.getContiguousBytes(localIndex, spanLength))};
 
-    for (int aChar; (! done); )
+    // Scan the characters a chunk at a time, rather than looking up each one.
+    firstSpan = span;
+    firstSpanLength = spanLength;
+    for (int aChar; (! done); ++localIndex)
     {
-        aChar = tolower(inBuffer.getChar(localIndex++, atEnd));
+        if (spanIndex >= spanLength)
+        {
+            span = ReinterpretCast(CPtr(char), inBuffer.getContiguousBytes(localIndex, spanLength));
+            spanIndex = 0;
+        }
+        atEnd = (nullptr == span);
+        aChar = (atEnd ? -1 : tolower(span[spanIndex++]));
         ODL_I2(aChar, localIndex); //####
         ODL_B1(atEnd); //####
         switch (currentState)
@@ -228,7 +240,6 @@ nImO::Number::readFromStringBuffer
                             if (isdigit(aChar))
                             {
                                 currentState = ScanState::IntegerDigitSeen;
-                                integerPart = aChar - '0';
                             }
                             else
                             {
@@ -258,17 +269,11 @@ nImO::Number::readFromStringBuffer
                         if (atEnd || isLegalTerminator(aChar))
                         {
                             // unexpected character seen, but valid so far
-                            --localIndex;
                             done = valid = true;
                         }
                         else
                         {
-                            if (isdigit(aChar))
-                            {
-                                integerPart *= 10;
-                                integerPart += aChar - '0';
-                            }
-                            else
+                            if (! isdigit(aChar))
                             {
                                 ODL_LOG("! (isDigit(aChar))"); //####
                                 done = true;
@@ -301,7 +306,6 @@ nImO::Number::readFromStringBuffer
                         }
                         else
                         {
-                            --localIndex;
                             done = valid = true; // the character seen is the end of the value
                         }
                     }
@@ -310,9 +314,6 @@ nImO::Number::readFromStringBuffer
                         if (isdigit(aChar))
                         {
                             needsAdigit = false;
-                            fractionPart *= 10;
-                            fractionPart += aChar - '0';
-                            ++fractionPower;
                         }
                         else
                         {
@@ -355,7 +356,6 @@ nImO::Number::readFromStringBuffer
                         if (isdigit(aChar))
                         {
                             currentState = ScanState::ExponentSeen;
-                            exponent = aChar - '0';
                         }
                         else
                         {
@@ -369,17 +369,11 @@ nImO::Number::readFromStringBuffer
             case ScanState::ExponentSeen :
                 if (atEnd || isLegalTerminator(aChar))
                 {
-                    --localIndex;
                     done = valid = true; // the character seen is the buffer end
                 }
                 else
                 {
-                    if (isdigit(aChar))
-                    {
-                        exponent *= 10;
-                        exponent += aChar - '0';
-                    }
-                    else
+                    if (! isdigit(aChar))
                     {
                         ODL_LOG("! (isDigit(aChar))"); //####
                         done = true;
@@ -394,48 +388,59 @@ nImO::Number::readFromStringBuffer
     }
     if (valid)
     {
+        // The loop stepped past the character that ended the value.
+        size_t          textLength{localIndex - position - 1};
+        SpAuint8_t      gathered;
+        CPtr(char)      textStart;
+
+        if (textLength <= firstSpanLength)
+        {
+            textStart = firstSpan;
+        }
+        else
+        {
+            ODL_LOG("! (textLength <= firstSpanLength)"); //####
+            gathered = inBuffer.getSharedBytes(position, textLength);
+            textStart = ReinterpretCast(CPtr(char), gathered.get());
+        }
+        CPtr(char)  textEnd{textStart + textLength};
+
+        // std::from_chars doesn't accept a leading plus sign, but does accept a leading minus sign.
+        if (sawInitialPlus)
+        {
+            ++textStart;
+        }
         if (isDouble)
         {
-            double  fullNumber;
+            double  value;
 
-            if (0 == exponent)
+            if (ConvertCharsToDouble(textStart, textEnd, value))
             {
-                fullNumber = integerPart + (fractionPart / std::pow(10.0, fractionPower));
+                result = std::make_shared<Double>(value);
             }
             else
             {
-                if (sawExponentMinus)
-                {
-                    fullNumber = ((integerPart + (fractionPart / std::pow(10.0, fractionPower))) / std::pow(10.0, exponent));
-                }
-                else
-                {
-                    if (exponent > fractionPower)
-                    {
-                        fullNumber = ((integerPart * std::pow(10.0, exponent)) +
-                                      (fractionPart * std::pow(10.0, exponent - fractionPower)));
-                    }
-                    else
-                    {
-                        if (exponent < fractionPower)
-                        {
-                            fullNumber = ((integerPart * std::pow(10.0, exponent)) +
-                                          (fractionPart / std::pow(10.0, fractionPower - exponent)));
-                        }
-                        else
-                        {
-                            fullNumber = (integerPart * std::pow(10.0, exponent)) + fractionPart;
-                        }
-                    }
-                }
+                ODL_LOG("! (ConvertCharsToDouble(textStart, textEnd, value))"); //####
             }
-            result = std::make_shared<Double>(sawInitialMinus ? -fullNumber : fullNumber);
         }
         else
         {
-            result = std::make_shared<Integer>(sawInitialMinus ? -integerPart : integerPart);
+            int64_t value;
+            auto    converted{std::from_chars(textStart, textEnd, value)};
+
+            if ((std::errc() == converted.ec) && (textEnd == converted.ptr))
+            {
+                result = std::make_shared<Integer>(value);
+            }
+            else
+            {
+                ODL_LOG("! ((std::errc() == converted.ec) && (textEnd == converted.ptr))"); //####
+            }
+        }
+        if (result)
+        {
+            position = localIndex - 1;
         }
-        position = localIndex;
     }
     ODL_EXIT_P(result.get()); //####
     return result;
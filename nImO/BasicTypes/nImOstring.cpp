@@ -38,7 +38,9 @@
 
 #include <BasicTypes/nImOstring.h>
 
+#include <BasicTypes/nImOinvalid.h>
 #include <Containers/nImOarray.h>
+#include <Containers/nImOkeyDictionary.h>
 #include <Containers/nImOmessage.h>
 #include <Containers/nImOstringBuffer.h>
 
@@ -231,6 +233,8 @@ nImO::String::extractValue
     SpValue result;
     bool    atEnd;
     bool    isShort{DataKind::StringOrBlobShortLengthValue == (DataKind::StringOrBlobLengthMask & leadByte)};
+    bool    isReference{(! isShort) && (DataKind::StringOrBlobLongLengthKeyReferenceValue ==
+                                        (DataKind::StringOrBlobLongLengthKeyReferenceValue & leadByte))};
     size_t  numBytes{0};
 
     ++position; // We will always accept the lead byte
@@ -266,44 +270,70 @@ nImO::String::extractValue
         }
         if (okSoFar)
         {
-            numBytes = B2I(holder, size);
-            ODL_I1(numBytes); //####
+            if (isReference)
+            {
+                ODL_LOG("(isReference)"); //####
+                auto        keys{theMessage.getKeyDictionary()};
+                int64_t     index{B2I(holder, size)};
+                std::string key;
+
+                ODL_I1(index); //####
+                if (keys && keys->findKey(index, key))
+                {
+                    ODL_LOG("(keys && keys->findKey(index, key))"); //####
+                    result = std::make_shared<String>(key);
+                }
+                else
+                {
+                    ODL_LOG("! (keys && keys->findKey(index, key))"); //####
+                    result = std::make_shared<Invalid>("Unknown Map key reference", position);
+                }
+            }
+            else
+            {
+                numBytes = B2I(holder, size);
+                ODL_I1(numBytes); //####
+            }
         }
     }
-    if (0 < numBytes)
+    if (! isReference)
     {
-        auto    holder{std::make_unique<char[]>(numBytes + 1)};
-        bool    okSoFar{nullptr != holder};
-
-        for (size_t ii = 0; okSoFar && (numBytes > ii); ++ii)
+        ODL_LOG("(! isReference)"); //####
+        if (0 < numBytes)
         {
-            int aByte{theMessage.getByte(position, atEnd)};
+            auto    holder{std::make_unique<char[]>(numBytes + 1)};
+            bool    okSoFar{nullptr != holder};
 
-            if (atEnd)
+            for (size_t ii = 0; okSoFar && (numBytes > ii); ++ii)
             {
-                ODL_LOG("(atEnd)"); //####
-                result.reset();
-                okSoFar = false;
-                ODL_B1(okSoFar); //####
+                int aByte{theMessage.getByte(position, atEnd)};
+
+                if (atEnd)
+                {
+                    ODL_LOG("(atEnd)"); //####
+                    result.reset();
+                    okSoFar = false;
+                    ODL_B1(okSoFar); //####
+                }
+                else
+                {
+                    holder[ii] = StaticCast(char, aByte);
+                    ++position;
+                    ODL_I1(position); //####
+                }
             }
-            else
+            if (okSoFar)
             {
-                holder[ii] = StaticCast(char, aByte);
-                ++position;
-                ODL_I1(position); //####
+                holder[numBytes] = kEndOfString;
+                result = std::make_shared<String>(holder.get());
+                ODL_I1(numBytes); //####
             }
         }
-        if (okSoFar)
+        else
         {
-            holder[numBytes] = kEndOfString;
-            result = std::make_shared<String>(holder.get());
-            ODL_I1(numBytes); //####
+            result = std::make_shared<String>();
         }
     }
-    else
-    {
-        result = std::make_shared<String>();
-    }
     if (parentValue && result && (! result->asFlaw()))
     {
         ODL_LOG("(parentValue && result && (! result->asFlaw()))"); //####
@@ -856,6 +886,59 @@ nImO::String::readFromStringBuffer
     return result;
 } // nImO::String::readFromStringBuffer
 
+void
+nImO::String::writeKeyToMessage
+    (Message &  outMessage)
+    const
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(&outMessage); //####
+    auto    keys{outMessage.getKeyDictionary()};
+    bool    sentAsReference{false};
+
+    if (keys)
+    {
+        ODL_LOG("(keys)"); //####
+        int64_t index{keys->findIndex(_value)};
+
+        ODL_I1(index); //####
+        if (0 > index)
+        {
+            ODL_LOG("(0 > index)"); //####
+            // The receiver adds the key to its dictionary when it sees it in full.
+            keys->addKey(_value);
+        }
+        else
+        {
+            ODL_LOG("! (0 > index)"); //####
+            NumberAsBytes   numBuff;
+            // The first index has no significant bytes, but at least one byte must be sent.
+            size_t          numBytes{std::max(I2B(index, numBuff), StaticCast(size_t, 1))};
+
+            if (_value.length() > numBytes)
+            {
+                ODL_LOG("(_value.length() > numBytes)"); //####
+                DataKind    stuff{DataKind::StringOrBlob | DataKind::StringOrBlobStringValue |
+                                    DataKind::StringOrBlobLongLengthValue |
+                                    DataKind::StringOrBlobLongLengthKeyReferenceValue |
+                                    (DataKind::StringOrBlobLongLengthMask &
+                                     StaticCast(DataKind, numBytes - 1))};
+
+                outMessage.appendBytes(&stuff, sizeof(stuff));
+                outMessage.appendBytes(numBuff + sizeof(numBuff) - numBytes, numBytes);
+                sentAsReference = true;
+                ODL_B1(sentAsReference); //####
+            }
+        }
+    }
+    if (! sentAsReference)
+    {
+        ODL_LOG("(! sentAsReference)"); //####
+        writeToMessage(outMessage);
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::String::writeKeyToMessage
+
 void
 nImO::String::writeToMessage
     (Message &  outMessage)
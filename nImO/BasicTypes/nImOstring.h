@@ -297,6 +297,16 @@ namespace nImO
                 (const StringBuffer &   inBuffer,
                  size_t &               position);
 
+            /*! @brief Add a binary representation of the object to the message, as a Map key.
+             If the Message has a KeyDictionary, the key is sent as a reference to an entry in the
+             dictionary when it has been seen before and that is shorter than the key itself; a key that
+             has not been seen before is sent in full and added to the dictionary.
+             @param[in,out] outMessage The Message to be appended to. */
+            void
+            writeKeyToMessage
+                (Message &  outMessage)
+                const;
+
             /*! @brief Add a binary representation of the object to the message.
              @param[in,out] outMessage The Message to be appended to. */
             void
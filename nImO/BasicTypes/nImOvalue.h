@@ -277,6 +277,19 @@ namespace nImO
                 (const Value &  other)
                 const;
 
+            /*! @brief Extracts an integer value from a Message.
+             @param[in] theMessage The Message being processed.
+             @param[in] leadByte The initial byte from the Message.
+             @param[in,out] position The location of the next byte to be processed.
+             @param[out] status Whether the extraction was successful.
+             @return Zero if there is a problem with the extraction. */
+            static int64_t
+            extractInt64FromMessage
+                (const Message &    theMessage,
+                 const int          leadByte,
+                 size_t &           position,
+                 IntStatus &        status);
+
             /*! @brief Return the type tag for the Value for use with Messages.
              @return The type tag for the Value for use with Messages. */
             virtual DataKind
@@ -453,6 +466,14 @@ namespace nImO
                 (Message &  outMessage)
                 const;
 
+            /*! @brief Add a binary representation of an integer to the Message.
+             @param[in,out] outMessage The Message to be appended to.
+             @param[in] outValue The integer to be appended. */
+            static void
+            writeInt64ToMessage
+                (Message &      outMessage,
+                 const int64_t  outValue);
+
             friend std::ostream &
             operator<<
                 (std::ostream & out,
@@ -482,27 +503,6 @@ namespace nImO
                 (std::ostream & out)
                 const;
 
-            /*! @brief Extracts an integer value from a Message.
-             @param[in] theMessage The Message being processed.
-             @param[in] leadByte The initial byte from the Message.
-             @param[in,out] position The location of the next byte to be processed.
-             @param[out] status Whether the extraction was successful.
-             @return Zero if there is a problem with the extraction. */
-            static int64_t
-            extractInt64FromMessage
-                (const Message &    theMessage,
-                 const int          leadByte,
-                 size_t &           position,
-                 IntStatus &        status);
-
-            /*! @brief Add a binary representation of an integer to the Message.
-             @param[in,out] outMessage The Message to be appended to.
-             @param[in] outValue The integer to be appended. */
-            static void
-            writeInt64ToMessage
-                (Message &      outMessage,
-                 const int64_t  outValue);
-
         private :
             // Private methods.
 
@@ -40,6 +40,7 @@
 
 #include <BasicTypes/nImOaddress.h>
 #include <BasicTypes/nImOinteger.h>
+#include <BasicTypes/nImOlogical.h>
 #include <BasicTypes/nImOstring.h>
 #include <Containers/nImOarray.h>
 #include <nImOinChannel.h>
@@ -120,19 +121,39 @@ nImO::SetUpReceiverCommandHandler::doIt
 
             if (theChannel)
             {
-                if (theChannel->setUp(StaticCast(TransportType, modeValue->getIntegerValue())))
+                bool    useKeyDictionary{false};
+
+                // The request for a dictionary for Map keys is optional.
+                if (4 < arguments.size())
+                {
+                    auto    keyDictionaryValue{arguments[4]->asLogical()};
+
+                    useKeyDictionary = ((nullptr != keyDictionaryValue) && keyDictionaryValue->getValue());
+                }
+                // The data type selects the schema codec for the connection, if one is registered.
+                theChannel->setDataType(dataTypeString->getValue());
+                if (theChannel->setUp(StaticCast(TransportType, modeValue->getIntegerValue()), useKeyDictionary))
                 {
                     auto    theConnection{theChannel->getConnection()};
                     auto    infoArray{std::make_shared<Array>()};
 
                     infoArray->addValue(std::make_shared<Address>(theConnection._address));
                     infoArray->addValue(std::make_shared<Integer>(theConnection._port));
+                    infoArray->addValue(std::make_shared<Logical>(theChannel->usesKeyDictionary()));
+                    // Input channels can always reconstruct delta-encoded Values.
+                    infoArray->addValue(std::make_shared<Logical>(true));
+                    // Input channels can always handle Messages in binary frames.
+                    infoArray->addValue(std::make_shared<Logical>(true));
+                    // Input channels can always expand compressed Messages.
+                    infoArray->addValue(std::make_shared<Logical>(true));
+                    // The local endpoint name is only meaningful for shared memory and local socket connections.
+                    infoArray->addValue(std::make_shared<String>(theChannel->getLocalEndpointName()));
                     okSoFar = sendComplexResponse(socket, kSetUpReceiverResponse, "set up receiver"s, infoArray, reason);
                     ODL_B1(okSoFar); //####
                 }
                 else
                 {
-                    ODL_LOG("! (theChannel->setUp(StaticCast(TransportType, modeValue->getIntegerValue())))"); //####
+                    ODL_LOG("! (theChannel->setUp(StaticCast(TransportType, modeValue->getIntegerValue()), useKeyDictionary))"); //####
                     reason = "Problem setting up input channel"s;
                 }
             }
@@ -40,6 +40,7 @@
 
 #include <BasicTypes/nImOaddress.h>
 #include <BasicTypes/nImOinteger.h>
+#include <BasicTypes/nImOlogical.h>
 #include <BasicTypes/nImOstring.h>
 #include <Containers/nImOarray.h>
 #include <nImOinputOutputCommands.h>
@@ -125,20 +126,83 @@ nImO::SetUpSenderCommandHandler::doIt
                 auto    receiveAddress{addressValue->getAddressValue()};
                 auto    receivePort{StaticCast(IPv4Port, portValue->getIntegerValue())};
                 auto    mode{StaticCast(TransportType, modeValue->getIntegerValue())};
+                bool    useKeyDictionary{false};
 
-                if (theChannel->setUp(receiveAddress, receivePort, mode))
+                // The agreement to use a dictionary for Map keys is optional.
+                if (6 < arguments.size())
+                {
+                    auto    keyDictionaryValue{arguments[6]->asLogical()};
+
+                    useKeyDictionary = ((nullptr != keyDictionaryValue) && keyDictionaryValue->getValue());
+                }
+                bool    receiverAcceptsDeltas{false};
+
+                // Whether the receiver can reconstruct delta-encoded Values is optional.
+                if (7 < arguments.size())
+                {
+                    auto    acceptsDeltasValue{arguments[7]->asLogical()};
+
+                    receiverAcceptsDeltas = ((nullptr != acceptsDeltasValue) && acceptsDeltasValue->getValue());
+                }
+                bool    receiverAcceptsFrames{false};
+
+                // Whether the receiver can handle Messages in binary frames is optional.
+                if (8 < arguments.size())
+                {
+                    auto    acceptsFramesValue{arguments[8]->asLogical()};
+
+                    receiverAcceptsFrames = ((nullptr != acceptsFramesValue) && acceptsFramesValue->getValue());
+                }
+                bool    receiverAcceptsCompression{false};
+
+                // Whether the receiver can expand compressed Messages is optional.
+                if (9 < arguments.size())
+                {
+                    auto    acceptsCompressionValue{arguments[9]->asLogical()};
+
+                    receiverAcceptsCompression = ((nullptr != acceptsCompressionValue) && acceptsCompressionValue->getValue());
+                }
+                std::string localEndpointName{};
+
+                // The name of the receiver's shared memory segment or local socket is optional.
+                if (10 < arguments.size())
+                {
+                    auto    localEndpointNameValue{arguments[10]->asString()};
+
+                    if (nullptr != localEndpointNameValue)
+                    {
+                        localEndpointName = localEndpointNameValue->getValue();
+                    }
+                }
+                // The size of the smallest Message to compress is optional; compression is only used if the receiver accepts it.
+                if (11 < arguments.size())
+                {
+                    auto    compressionThresholdValue{arguments[11]->asInteger()};
+
+                    if ((nullptr != compressionThresholdValue) && (0 <= compressionThresholdValue->getIntegerValue()))
+                    {
+                        theChannel->setCompressionThreshold(StaticCast(size_t, compressionThresholdValue->getIntegerValue()));
+                    }
+                }
+                // The data type selects the schema codec for the connection, if one is registered.
+                theChannel->setDataType(dataTypeString->getValue());
+                if (theChannel->setUp(receiveAddress, receivePort, mode, useKeyDictionary, receiverAcceptsDeltas, receiverAcceptsFrames,
+                                      receiverAcceptsCompression, localEndpointName))
                 {
                     auto    theConnection{theChannel->getConnection()};
                     auto    infoArray{std::make_shared<Array>()};
 
                     infoArray->addValue(std::make_shared<Address>(theConnection._address));
                     infoArray->addValue(std::make_shared<Integer>(theConnection._port));
+                    infoArray->addValue(std::make_shared<Logical>(theChannel->usesDeltaEncoding()));
+                    infoArray->addValue(std::make_shared<Logical>(theChannel->usesBinaryFraming()));
                     okSoFar = sendComplexResponse(socket, kSetUpSenderResponse, "set up sender"s, infoArray, reason);
                     ODL_B1(okSoFar); //####
                 }
                 else
                 {
-                    ODL_LOG("! (theChannel->setUp(receiveAddress, receivePort, mode))"); //####
+                    ODL_LOG("! (theChannel->setUp(receiveAddress, receivePort, mode, useKeyDictionary, receiverAcceptsDeltas, " //####
+                            "receiverAcceptsFrames, receiverAcceptsCompression, localEndpointName))"); //####
                     reason = "Problem setting up output channel"s;
                 }
             }
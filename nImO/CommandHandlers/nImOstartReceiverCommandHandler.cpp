@@ -40,6 +40,7 @@
 
 #include <BasicTypes/nImOaddress.h>
 #include <BasicTypes/nImOinteger.h>
+#include <BasicTypes/nImOlogical.h>
 #include <BasicTypes/nImOstring.h>
 #include <Containers/nImOarray.h>
 #include <nImOinChannel.h>
@@ -122,9 +123,26 @@ nImO::StartReceiverCommandHandler::doIt
             {
                 auto    senderAddress{addressValue->getAddressValue()};
                 auto    senderPort{StaticCast(IPv4Port, portValue->getIntegerValue())};
+                bool    useDeltaEncoding{false};
 
+                // Whether the sender uses delta encoding is optional.
+                if (4 < arguments.size())
+                {
+                    auto    deltaEncodingValue{arguments[4]->asLogical()};
+
+                    useDeltaEncoding = ((nullptr != deltaEncodingValue) && deltaEncodingValue->getValue());
+                }
+                bool    useBinaryFraming{false};
+
+                // Whether the sender uses binary frames is optional.
+                if (5 < arguments.size())
+                {
+                    auto    binaryFramingValue{arguments[5]->asLogical()};
+
+                    useBinaryFraming = ((nullptr != binaryFramingValue) && binaryFramingValue->getValue());
+                }
                 // Send the response to the requestor.
-                okSoFar = sendSimpleResponse(socket, kStartReceiverResponse, "start receiver"s, theChannel->start(senderAddress, senderPort), reason);
+                okSoFar = sendSimpleResponse(socket, kStartReceiverResponse, "start receiver"s, theChannel->start(senderAddress, senderPort, useDeltaEncoding, useBinaryFraming), reason);
                 ODL_B1(okSoFar); //####
             }
             else
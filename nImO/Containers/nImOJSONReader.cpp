@@ -0,0 +1,607 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOJSONReader.cpp
+//
+//  Project:    nImO
+//
+//  Contains:   The class definition for reading Values from JSON.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include <Containers/nImOJSONReader.h>
+
+#include <BasicTypes/nImOdouble.h>
+#include <BasicTypes/nImOinteger.h>
+#include <BasicTypes/nImOinvalid.h>
+#include <BasicTypes/nImOlogical.h>
+#include <BasicTypes/nImOstring.h>
+#include <Containers/nImOarray.h>
+#include <Containers/nImOmap.h>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for reading Values from JSON. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace nImO;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The Unicode code point that stands in for half of a surrogate pair that has no other half. */
+constexpr uint32_t  kReplacementCharacter{0xFFFD};
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Add a Unicode code point to a string, as UTF-8.
+ @param[in,out] aString The string to be added to.
+ @param[in] codePoint The code point to be added. */
+static void
+appendUTF8
+    (std::string &  aString,
+     const uint32_t codePoint)
+{
+    ODL_ENTER(); //####
+    ODL_P1(&aString); //####
+    ODL_X1(codePoint); //####
+    if (0x80 > codePoint)
+    {
+        aString += StaticCast(char, codePoint);
+    }
+    else
+    {
+        if (0x800 > codePoint)
+        {
+            aString += StaticCast(char, 0xC0 | (codePoint >> 6));
+        }
+        else
+        {
+            if (0x10000 > codePoint)
+            {
+                aString += StaticCast(char, 0xE0 | (codePoint >> 12));
+            }
+            else
+            {
+                aString += StaticCast(char, 0xF0 | (codePoint >> 18));
+                aString += StaticCast(char, 0x80 | ((codePoint >> 12) & 0x3F));
+            }
+            aString += StaticCast(char, 0x80 | ((codePoint >> 6) & 0x3F));
+        }
+        aString += StaticCast(char, 0x80 | (codePoint & 0x3F));
+    }
+    ODL_EXIT(); //####
+} // appendUTF8
+
+/*! @brief Replace the first half of a surrogate pair that was not followed by the second half.
+ @param[in,out] aString The string to be added to.
+ @param[in,out] highSurrogate The first half of a surrogate pair, or zero if there is none; it is cleared. */
+static void
+flushHighSurrogate
+    (std::string &  aString,
+     uint32_t &     highSurrogate)
+{
+    if (0 != highSurrogate)
+    {
+        appendUTF8(aString, kReplacementCharacter);
+        highSurrogate = 0;
+    }
+} // flushHighSurrogate
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+nImO::JSONReader::JSONReader
+    (std::istream & inStream) :
+        _source{inStream.rdbuf()}
+{
+    ODL_ENTER(); //####
+    ODL_P1(&inStream); //####
+    ODL_EXIT_P(this); //####
+} // nImO::JSONReader::JSONReader
+
+nImO::JSONReader::JSONReader
+    (std::streambuf &   inBuffer) :
+        _source{&inBuffer}
+{
+    ODL_ENTER(); //####
+    ODL_P1(&inBuffer); //####
+    ODL_EXIT_P(this); //####
+} // nImO::JSONReader::JSONReader
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+nImO::SpValue
+nImO::JSONReader::readArray
+    (const size_t   depth)
+{
+    ODL_OBJENTER(); //####
+    ODL_I1(depth); //####
+    auto    result{std::make_shared<Array>()};
+
+    skipWhiteSpace();
+    if (']' == peekChar())
+    {
+        getChar();
+    }
+    else
+    {
+        for (bool done = false; (! done) && result; )
+        {
+            auto    element{readElement(depth + 1)};
+
+            if (element)
+            {
+                result->addValue(element);
+                skipWhiteSpace();
+                int aChar{getChar()};
+
+                if (']' == aChar)
+                {
+                    done = true;
+                }
+                else
+                {
+                    if (',' != aChar)
+                    {
+                        ODL_LOG("(',' != aChar)"); //####
+                        result.reset();
+                    }
+                }
+            }
+            else
+            {
+                ODL_LOG("! (element)"); //####
+                result.reset();
+            }
+        }
+    }
+    ODL_OBJEXIT_P(result.get()); //####
+    return result;
+} // nImO::JSONReader::readArray
+
+nImO::SpValue
+nImO::JSONReader::readElement
+    (const size_t   depth)
+{
+    ODL_OBJENTER(); //####
+    ODL_I1(depth); //####
+    SpValue result;
+
+    skipWhiteSpace();
+    if (kJSONMaximumDepth > depth)
+    {
+        int aChar{peekChar()};
+
+        switch (aChar)
+        {
+            case '[' :
+                getChar();
+                result = readArray(depth);
+                break;
+
+            case '{' :
+                getChar();
+                result = readObject(depth);
+                break;
+
+            case kDoubleQuote :
+                {
+                    std::string aString;
+
+                    getChar();
+                    if (readString(aString))
+                    {
+                        result = std::make_shared<String>(aString);
+                    }
+                }
+                break;
+
+            case 't' :
+                getChar();
+                if (readLiteral("rue"))
+                {
+                    result = std::make_shared<Logical>(true);
+                }
+                break;
+
+            case 'f' :
+                getChar();
+                if (readLiteral("alse"))
+                {
+                    result = std::make_shared<Logical>(false);
+                }
+                break;
+
+            case 'n' :
+                getChar();
+                if (readLiteral("ull"))
+                {
+                    result = std::make_shared<Array>();
+                }
+                break;
+
+            default :
+                if (('-' == aChar) || isdigit(aChar))
+                {
+                    result = readNumber();
+                }
+                break;
+
+        }
+    }
+    ODL_OBJEXIT_P(result.get()); //####
+    return result;
+} // nImO::JSONReader::readElement
+
+bool
+nImO::JSONReader::readLiteral
+    (CPtr(char) rest)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1(rest); //####
+    bool    okSoFar{true};
+
+    for ( ; okSoFar && (kEndOfString != *rest); ++rest)
+    {
+        okSoFar = (*rest == getChar());
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::JSONReader::readLiteral
+
+nImO::SpValue
+nImO::JSONReader::readNumber
+    (void)
+{
+    ODL_OBJENTER(); //####
+    SpValue             result;
+    std::string         numberText;
+    bool                isInteger{true};
+    bool                okSoFar{true};
+    static const char   kNumberChars[]{"0123456789+-.eE"};
+
+    for (int aChar = peekChar(); (EOF != aChar) && (nullptr != strchr(kNumberChars, aChar)); aChar = peekChar())
+    {
+        numberText += StaticCast(char, getChar());
+    }
+    // The number conversions are more forgiving than JSON; reject leading zeros, leading plus signs
+    // and missing digits before or after a decimal point.
+    size_t  firstDigit{('-' == numberText[0]) ? 1U : 0U};
+
+    if ((numberText.length() <= firstDigit) || (! isdigit(numberText[firstDigit])))
+    {
+        okSoFar = false;
+    }
+    else
+    {
+        if (('0' == numberText[firstDigit]) && ((firstDigit + 1) < numberText.length()) && isdigit(numberText[firstDigit + 1]))
+        {
+            okSoFar = false;
+        }
+    }
+    for (size_t ii = firstDigit, len = numberText.length(); okSoFar && (len > ii); ++ii)
+    {
+        char    aChar{numberText[ii]};
+
+        if ('.' == aChar)
+        {
+            isInteger = false;
+            okSoFar = (((ii + 1) < len) && isdigit(numberText[ii + 1]));
+        }
+        else
+        {
+            if (('e' == aChar) || ('E' == aChar))
+            {
+                isInteger = false;
+            }
+        }
+    }
+    if (okSoFar)
+    {
+        int64_t intValue;
+        double  doubleValue;
+
+        if (isInteger && ConvertToInt64(numberText, intValue))
+        {
+            result = std::make_shared<Integer>(intValue);
+        }
+        else
+        {
+            if (ConvertToDouble(numberText, doubleValue))
+            {
+                result = std::make_shared<Double>(doubleValue);
+            }
+        }
+    }
+    ODL_OBJEXIT_P(result.get()); //####
+    return result;
+} // nImO::JSONReader::readNumber
+
+nImO::SpValue
+nImO::JSONReader::readObject
+    (const size_t   depth)
+{
+    ODL_OBJENTER(); //####
+    ODL_I1(depth); //####
+    auto    result{std::make_shared<Map>()};
+
+    skipWhiteSpace();
+    if ('}' == peekChar())
+    {
+        getChar();
+    }
+    else
+    {
+        for (bool done = false; (! done) && result; )
+        {
+            std::string keyString;
+
+            skipWhiteSpace();
+            if ((kDoubleQuote == getChar()) && readString(keyString))
+            {
+                skipWhiteSpace();
+                if (':' == getChar())
+                {
+                    auto    element{readElement(depth + 1)};
+
+                    if (element)
+                    {
+                        result->addValue(std::make_shared<String>(keyString), element);
+                        skipWhiteSpace();
+                        int aChar{getChar()};
+
+                        if ('}' == aChar)
+                        {
+                            done = true;
+                        }
+                        else
+                        {
+                            if (',' != aChar)
+                            {
+                                ODL_LOG("(',' != aChar)"); //####
+                                result.reset();
+                            }
+                        }
+                    }
+                    else
+                    {
+                        ODL_LOG("! (element)"); //####
+                        result.reset();
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (':' == getChar())"); //####
+                    result.reset();
+                }
+            }
+            else
+            {
+                ODL_LOG("! ((kDoubleQuote == getChar()) && readString(keyString))"); //####
+                result.reset();
+            }
+        }
+    }
+    ODL_OBJEXIT_P(result.get()); //####
+    return result;
+} // nImO::JSONReader::readObject
+
+bool
+nImO::JSONReader::readString
+    (std::string &  result)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(&result); //####
+    bool        okSoFar{true};
+    uint32_t    highSurrogate{0};
+
+    for (bool done = false; okSoFar && (! done); )
+    {
+        int aChar{getChar()};
+
+        if ((EOF == aChar) || (0x20 > aChar))
+        {
+            okSoFar = false;
+        }
+        else
+        {
+            if (kDoubleQuote == aChar)
+            {
+                flushHighSurrogate(result, highSurrogate);
+                done = true;
+            }
+            else
+            {
+                if (kEscapeChar == aChar)
+                {
+                    aChar = getChar();
+                    if ('u' != aChar)
+                    {
+                        flushHighSurrogate(result, highSurrogate);
+                    }
+                    switch (aChar)
+                    {
+                        case kDoubleQuote :
+                        case kEscapeChar :
+                        case '/' :
+                            result += StaticCast(char, aChar);
+                            break;
+
+                        case 'b' :
+                            result += '\b';
+                            break;
+
+                        case 'f' :
+                            result += '\f';
+                            break;
+
+                        case 'n' :
+                            result += '\n';
+                            break;
+
+                        case 'r' :
+                            result += '\r';
+                            break;
+
+                        case 't' :
+                            result += '\t';
+                            break;
+
+                        case 'u' :
+                            {
+                                uint32_t    codePoint{0};
+
+                                for (int ii = 0; okSoFar && (4 > ii); ++ii)
+                                {
+                                    int hexChar{getChar()};
+
+                                    okSoFar = ((EOF != hexChar) && isxdigit(hexChar));
+                                    if (okSoFar)
+                                    {
+                                        codePoint = (codePoint << 4) + StaticCast(uint32_t, isdigit(hexChar) ? (hexChar - '0') : ((tolower(hexChar) - 'a') + 10));
+                                    }
+                                }
+                                if (okSoFar)
+                                {
+                                    // Half of a surrogate pair without the other half is not valid UTF-8, so it is replaced.
+                                    if ((0xDC00 <= codePoint) && (0xDFFF >= codePoint))
+                                    {
+                                        if (0 == highSurrogate)
+                                        {
+                                            appendUTF8(result, kReplacementCharacter);
+                                        }
+                                        else
+                                        {
+                                            appendUTF8(result, 0x10000 + ((highSurrogate - 0xD800) << 10) + (codePoint - 0xDC00));
+                                            highSurrogate = 0;
+                                        }
+                                    }
+                                    else
+                                    {
+                                        flushHighSurrogate(result, highSurrogate);
+                                        if ((0xD800 <= codePoint) && (0xDBFF >= codePoint))
+                                        {
+                                            // The first half of a surrogate pair.
+                                            highSurrogate = codePoint;
+                                        }
+                                        else
+                                        {
+                                            appendUTF8(result, codePoint);
+                                        }
+                                    }
+                                }
+                            }
+                            break;
+
+                        default :
+                            okSoFar = false;
+                            break;
+
+                    }
+                }
+                else
+                {
+                    flushHighSurrogate(result, highSurrogate);
+                    result += StaticCast(char, aChar);
+                }
+            }
+        }
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::JSONReader::readString
+
+nImO::SpValue
+nImO::JSONReader::readValue
+    (void)
+{
+    ODL_OBJENTER(); //####
+    SpValue result;
+
+    skipWhiteSpace();
+    if (EOF != peekChar())
+    {
+        result = readElement(0);
+        if (! result)
+        {
+            // Resynchronize at the start of the next line.
+            for (int aChar = getChar(); (EOF != aChar) && (kEndOfLine != aChar); aChar = getChar())
+            {
+            }
+            result = std::make_shared<Invalid>("Text is not valid JSON");
+        }
+    }
+    ODL_OBJEXIT_P(result.get()); //####
+    return result;
+} // nImO::JSONReader::readValue
+
+void
+nImO::JSONReader::skipWhiteSpace
+    (void)
+{
+    ODL_OBJENTER(); //####
+    for (int aChar = peekChar(); (' ' == aChar) || ('\t' == aChar) || ('\n' == aChar) || ('\r' == aChar); aChar = peekChar())
+    {
+        getChar();
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::JSONReader::skipWhiteSpace
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,208 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOJSONReader.h
+//
+//  Project:    nImO
+//
+//  Contains:   The class declaration for reading Values from JSON.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(nImOJSONReader_H_))
+# define nImOJSONReader_H_ /* Header guard */
+
+# include <nImOcommon.h>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for reading Values from JSON. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace nImO
+{
+    /*! @brief A class to read a sequence of JSON texts from a stream as Values.
+
+     The stream is read directly, one JSON text at a time, so only the Value being built is held in
+     memory. JSON arrays become Arrays, objects become Maps with String keys, numbers become Integers
+     if they have no fraction or exponent and fit in 64 bits and Doubles otherwise, @c true and
+     @c false become Logicals and, as there is no equivalent, @c null becomes an empty Array. */
+    class JSONReader final
+    {
+
+        public :
+            // Public type definitions.
+
+        protected :
+            // Protected type definitions.
+
+        private :
+            // Private type definitions.
+
+        public :
+            // Public methods.
+
+            /*! @brief The constructor.
+             @param[in] inStream The stream to be read from. */
+            explicit JSONReader
+                (std::istream & inStream);
+
+            /*! @brief The constructor.
+             @param[in] inBuffer The stream buffer to be read from. */
+            explicit JSONReader
+                (std::streambuf &   inBuffer);
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            JSONReader
+                (const JSONReader & other) = delete;
+
+            /*! @brief The move constructor.
+             @param[in] other The object to be moved. */
+            JSONReader
+                (JSONReader &&  other)
+                noexcept = delete;
+
+            /*! @brief The copy assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            JSONReader &
+            operator=
+                (const JSONReader & other) = delete;
+
+            /*! @brief The move assignment operator.
+             @param[in] other The object to be moved.
+             @return The updated object. */
+            JSONReader &
+            operator=
+                (JSONReader &&  other)
+                noexcept = delete;
+
+            /*! @brief Return the next Value from the stream.
+             If the text is not valid JSON, the rest of the line containing the error is skipped.
+             @return The next Value, an Invalid if the text was not valid JSON or @c nullptr if the
+             end of the stream has been reached. */
+            SpValue
+            readValue
+                (void);
+
+        protected :
+            // Protected methods.
+
+        private :
+            // Private methods.
+
+            /*! @brief Return the next character in the stream and move past it.
+             @return The next character in the stream or @c EOF if the end of the stream has been reached. */
+            inline int
+            getChar
+                (void)
+            {
+                return _source->sbumpc();
+            }
+
+            /*! @brief Return the next character in the stream without moving past it.
+             @return The next character in the stream or @c EOF if the end of the stream has been reached. */
+            inline int
+            peekChar
+                (void)
+            {
+                return _source->sgetc();
+            }
+
+            /*! @brief Read a JSON array, after its opening bracket.
+             @param[in] depth The nesting depth of the array.
+             @return The Array or @c nullptr if the text is not valid. */
+            SpValue
+            readArray
+                (const size_t   depth);
+
+            /*! @brief Read a JSON value.
+             @param[in] depth The nesting depth of the value.
+             @return The Value or @c nullptr if the text is not valid. */
+            SpValue
+            readElement
+                (const size_t   depth);
+
+            /*! @brief Read the remainder of a JSON literal.
+             @param[in] rest The characters of the literal that follow the first character.
+             @return @c true if the characters matched. */
+            bool
+            readLiteral
+                (CPtr(char) rest);
+
+            /*! @brief Read a JSON number.
+             @return The Integer or Double or @c nullptr if the text is not valid. */
+            SpValue
+            readNumber
+                (void);
+
+            /*! @brief Read a JSON object, after its opening brace.
+             @param[in] depth The nesting depth of the object.
+             @return The Map or @c nullptr if the text is not valid. */
+            SpValue
+            readObject
+                (const size_t   depth);
+
+            /*! @brief Read a JSON string, after its opening quote.
+             @param[out] result The characters of the string, with escapes replaced.
+             @return @c true if the text is valid. */
+            bool
+            readString
+                (std::string &  result);
+
+            /*! @brief Skip over any whitespace in the stream. */
+            void
+            skipWhiteSpace
+                (void);
+
+        public :
+            // Public fields.
+
+        protected :
+            // Protected fields.
+
+        private :
+            // Private fields.
+
+            /*! @brief The source of the characters. */
+            Ptr(std::streambuf) _source{nullptr};
+
+    }; // JSONReader
+
+} // nImO
+
+#endif // not defined(nImOJSONReader_H_)
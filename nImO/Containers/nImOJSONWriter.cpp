@@ -0,0 +1,404 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOJSONWriter.cpp
+//
+//  Project:    nImO
+//
+//  Contains:   The class definition for writing Values as JSON.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include <Containers/nImOJSONWriter.h>
+
+#include <BasicTypes/nImOblob.h>
+#include <BasicTypes/nImOdouble.h>
+#include <BasicTypes/nImOstring.h>
+#include <Containers/nImOarray.h>
+#include <Containers/nImOmap.h>
+#include <Containers/nImOset.h>
+
+#include <cmath>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for writing Values as JSON. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace nImO;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The JSON text for a missing or invalid value. */
+static const std::string    kJSONNull{"null"s};
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+nImO::JSONWriter::JSONWriter
+    (std::ostream & outStream,
+     const bool     squished) :
+        _sink{new StreamTextSink(outStream)}, _squished{squished}
+{
+    ODL_ENTER(); //####
+    ODL_P1(&outStream); //####
+    ODL_B1(squished); //####
+    _pending.reserve(kJSONBufferSize);
+    ODL_EXIT_P(this); //####
+} // nImO::JSONWriter::JSONWriter
+
+nImO::JSONWriter::JSONWriter
+    (const int  outDescriptor,
+     const bool squished) :
+        _sink{new DescriptorTextSink(outDescriptor)}, _squished{squished}
+{
+    ODL_ENTER(); //####
+    ODL_I1(outDescriptor); //####
+    ODL_B1(squished); //####
+    _pending.reserve(kJSONBufferSize);
+    ODL_EXIT_P(this); //####
+} // nImO::JSONWriter::JSONWriter
+
+nImO::JSONWriter::~JSONWriter
+    (void)
+{
+    ODL_OBJENTER(); //####
+    flush();
+    ODL_OBJEXIT(); //####
+} // nImO::JSONWriter::~JSONWriter
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+nImO::JSONWriter::appendText
+    (CPtr(char)     someText,
+     const size_t   length)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(someText); //####
+    ODL_I1(length); //####
+    _pending.append(someText, length);
+    if (kJSONBufferSize <= _pending.length())
+    {
+        flush();
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::JSONWriter::appendText
+
+bool
+nImO::JSONWriter::flush
+    (void)
+{
+    ODL_OBJENTER(); //####
+    if (! _pending.empty())
+    {
+        ODL_LOG("(! _pending.empty())"); //####
+        _sink->write(_pending.c_str(), _pending.length());
+        _pending.clear();
+    }
+    bool    okSoFar{_sink->flush()};
+
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::JSONWriter::flush
+
+void
+nImO::JSONWriter::writeElement
+    (const Value &  aValue,
+     const bool     asKey)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(&aValue); //####
+    ODL_B1(asKey); //####
+    CPtr(String)    asString{aValue.asString()};
+
+    if (nullptr == asString)
+    {
+        CPtr(Array) asArray{aValue.asArray()};
+        CPtr(Set)   asSet{aValue.asSet()};
+
+        if ((nullptr != asArray) || (nullptr != asSet))
+        {
+            bool    first{true};
+            auto    writeMember{[this, &first]
+                                (const SpValue &    member)
+                                {
+                                    if (member)
+                                    {
+                                        if (! first)
+                                        {
+                                            appendChar(',');
+                                        }
+                                        if (! _squished)
+                                        {
+                                            appendChar(' ');
+                                        }
+                                        writeElement(*member, false);
+                                        first = false;
+                                    }
+                                }};
+
+            appendChar('[');
+            if (nullptr == asArray)
+            {
+                for (auto & walker : *asSet)
+                {
+                    writeMember(walker);
+                }
+            }
+            else
+            {
+                for (auto & walker : *asArray)
+                {
+                    writeMember(walker);
+                }
+            }
+            if (! _squished)
+            {
+                appendChar(' ');
+            }
+            appendChar(']');
+        }
+        else
+        {
+            CPtr(Map)   asMap{aValue.asMap()};
+
+            if (nullptr == asMap)
+            {
+                CPtr(Blob)  asBlob{aValue.asBlob()};
+
+                if (nullptr == asBlob)
+                {
+                    CPtr(Double)    asDouble{aValue.asDouble()};
+
+                    if ((nullptr != aValue.asFlaw()) || ((nullptr != asDouble) && (! std::isfinite(asDouble->getDoubleValue()))))
+                    {
+                        // JSON has no representation for these.
+                        appendText(kJSONNull.c_str(), kJSONNull.length());
+                    }
+                    else
+                    {
+                        _scratch.reset();
+                        aValue.printToStringBufferAsJSON(_scratch, asKey, _squished);
+                        auto    asText{_scratch.getString()};
+
+                        // The names in a JSON object must be strings.
+                        if (asKey && (kDoubleQuote != asText[0]))
+                        {
+                            appendChar(kDoubleQuote);
+                            appendText(asText.c_str(), asText.length());
+                            appendChar(kDoubleQuote);
+                        }
+                        else
+                        {
+                            appendText(asText.c_str(), asText.length());
+                        }
+                    }
+                }
+                else
+                {
+                    size_t          length;
+                    CPtr(uint8_t)   bytes{asBlob->getValue(length)};
+
+                    appendChar('[');
+                    for (size_t ii = 0; length > ii; ++ii)
+                    {
+                        std::string byteText{std::to_string(bytes[ii])};
+
+                        if (0 < ii)
+                        {
+                            appendChar(',');
+                        }
+                        if (! _squished)
+                        {
+                            appendChar(' ');
+                        }
+                        appendText(byteText.c_str(), byteText.length());
+                    }
+                    if (! _squished)
+                    {
+                        appendChar(' ');
+                    }
+                    appendChar(']');
+                }
+            }
+            else
+            {
+                bool    first{true};
+
+                appendChar('{');
+                for (auto & walker : *asMap)
+                {
+                    if (! first)
+                    {
+                        appendChar(',');
+                    }
+                    if (! _squished)
+                    {
+                        appendChar(' ');
+                    }
+                    writeElement(*walker.first, true);
+                    if (! _squished)
+                    {
+                        appendChar(' ');
+                    }
+                    appendChar(':');
+                    if (! _squished)
+                    {
+                        appendChar(' ');
+                    }
+                    writeElement(*walker.second, false);
+                    first = false;
+                }
+                if (! _squished)
+                {
+                    appendChar(' ');
+                }
+                appendChar('}');
+            }
+        }
+    }
+    else
+    {
+        writeString(asString->getValue());
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::JSONWriter::writeElement
+
+void
+nImO::JSONWriter::writeString
+    (const std::string &    aString)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s(aString); //####
+    static const char   hexDigits[]{"0123456789abcdef"};
+    CPtr(char)          asChars{aString.c_str()};
+    size_t              runStart{0};
+
+    appendChar(kDoubleQuote);
+    for (size_t ii = 0, len = aString.length(); len > ii; ++ii)
+    {
+        uint8_t aByte{StaticCast(uint8_t, asChars[ii])};
+
+        // Bytes with the high bit set are passed through, as part of UTF-8 sequences.
+        if ((0x20 > aByte) || (kDoubleQuote == aByte) || (kEscapeChar == aByte))
+        {
+            char    escape[]{kEscapeChar, 'u', '0', '0', hexDigits[aByte >> 4], hexDigits[aByte & 0x0F]};
+            size_t  escapeLength{2};
+
+            appendText(asChars + runStart, ii - runStart);
+            runStart = ii + 1;
+            switch (aByte)
+            {
+                case '\b' :
+                    escape[1] = 'b';
+                    break;
+
+                case '\f' :
+                    escape[1] = 'f';
+                    break;
+
+                case '\n' :
+                    escape[1] = 'n';
+                    break;
+
+                case '\r' :
+                    escape[1] = 'r';
+                    break;
+
+                case '\t' :
+                    escape[1] = 't';
+                    break;
+
+                case kDoubleQuote :
+                case kEscapeChar :
+                    escape[1] = StaticCast(char, aByte);
+                    break;
+
+                default :
+                    escapeLength = sizeof(escape);
+                    break;
+
+            }
+            appendText(escape, escapeLength);
+        }
+    }
+    appendText(asChars + runStart, aString.length() - runStart);
+    appendChar(kDoubleQuote);
+    ODL_OBJEXIT(); //####
+} // nImO::JSONWriter::writeString
+
+bool
+nImO::JSONWriter::writeValue
+    (const Value &  aValue)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(&aValue); //####
+    writeElement(aValue, false);
+    appendChar(kEndOfLine);
+    bool    result{flush()};
+
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // nImO::JSONWriter::writeValue
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
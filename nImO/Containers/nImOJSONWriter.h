@@ -0,0 +1,198 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOJSONWriter.h
+//
+//  Project:    nImO
+//
+//  Contains:   The class declaration for writing Values as JSON.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(nImOJSONWriter_H_))
+# define nImOJSONWriter_H_ /* Header guard */
+
+# include <Containers/nImOstringBuffer.h>
+# include <Containers/nImOtextSink.h>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for writing Values as JSON. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace nImO
+{
+    /*! @brief A class to write Values as JSON to a stream or a file descriptor.
+
+     Each Value is written as a single line of text. The text is sent to its destination in pieces
+     of bounded size as the Value is walked, rather than being collected in a StringBuffer first.
+     Arrays and Sets are written as JSON arrays, Maps as JSON objects with the keys converted to
+     strings, Blobs as arrays of byte values and Flaws as @c null. */
+    class JSONWriter final
+    {
+
+        public :
+            // Public type definitions.
+
+        protected :
+            // Protected type definitions.
+
+        private :
+            // Private type definitions.
+
+        public :
+            // Public methods.
+
+            /*! @brief The constructor.
+             @param[in] outStream The stream to be written to.
+             @param[in] squished @c true if the text is to be as compact as possible. */
+            explicit JSONWriter
+                (std::ostream & outStream,
+                 const bool     squished = false);
+
+            /*! @brief The constructor.
+             @param[in] outDescriptor The file descriptor to be written to.
+             @param[in] squished @c true if the text is to be as compact as possible. */
+            explicit JSONWriter
+                (const int  outDescriptor,
+                 const bool squished = false);
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            JSONWriter
+                (const JSONWriter & other) = delete;
+
+            /*! @brief The move constructor.
+             @param[in] other The object to be moved. */
+            JSONWriter
+                (JSONWriter &&  other)
+                noexcept = delete;
+
+            /*! @brief The destructor. */
+            ~JSONWriter
+                (void);
+
+            /*! @brief Send any text that has not been sent yet.
+             @return @c true if the text was sent. */
+            bool
+            flush
+                (void);
+
+            /*! @brief The copy assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            JSONWriter &
+            operator=
+                (const JSONWriter & other) = delete;
+
+            /*! @brief The move assignment operator.
+             @param[in] other The object to be moved.
+             @return The updated object. */
+            JSONWriter &
+            operator=
+                (JSONWriter &&  other)
+                noexcept = delete;
+
+            /*! @brief Write a Value as a line of JSON.
+             @param[in] aValue The Value to be written.
+             @return @c true if the Value was written. */
+            bool
+            writeValue
+                (const Value &  aValue);
+
+        protected :
+            // Protected methods.
+
+        private :
+            // Private methods.
+
+            /*! @brief Add some text to the output, sending it if enough has been collected.
+             @param[in] someText The text to be added.
+             @param[in] length The number of characters to be added. */
+            void
+            appendText
+                (CPtr(char)     someText,
+                 const size_t   length);
+
+            /*! @brief Add a character to the output.
+             @param[in] aChar The character to be added. */
+            inline void
+            appendChar
+                (const char aChar)
+            {
+                appendText(&aChar, 1);
+            }
+
+            /*! @brief Write a Value.
+             @param[in] aValue The Value to be written.
+             @param[in] asKey @c true if the Value is the key of a Map. */
+            void
+            writeElement
+                (const Value &  aValue,
+                 const bool     asKey);
+
+            /*! @brief Write a string as a JSON string, with JSON escapes.
+             @param[in] aString The string to be written. */
+            void
+            writeString
+                (const std::string &    aString);
+
+        public :
+            // Public fields.
+
+        protected :
+            // Protected fields.
+
+        private :
+            // Private fields.
+
+            /*! @brief The destination for the text. */
+            UpTextSink  _sink{};
+
+            /*! @brief The text that has not been sent yet. */
+            std::string _pending{};
+
+            /*! @brief A buffer for the text of simple Values. */
+            StringBuffer    _scratch{};
+
+            /*! @brief @c true if the text is to be as compact as possible. */
+            bool    _squished{false};
+
+    }; // JSONWriter
+
+} // nImO
+
+#endif // not defined(nImOJSONWriter_H_)
@@ -92,7 +92,7 @@ nImO::Array::Array
 
 nImO::Array::Array
     (const Array &  other) :
-        inherited1{}, inherited2{}
+        inherited1{}, inherited2{}, _singlePrecision{other._singlePrecision}
 {
     ODL_ENTER(); //####
     ODL_P1(&other); //####
@@ -103,7 +103,7 @@ nImO::Array::Array
 nImO::Array::Array
     (Array &&   other)
     noexcept :
-        inherited1{std::move(other)}, inherited2{std::move(other)}
+        inherited1{std::move(other)}, inherited2{std::move(other)}, _singlePrecision{other._singlePrecision}
 {
     ODL_ENTER(); //####
     ODL_P1(&other); //####
@@ -550,6 +550,7 @@ nImO::Array::operator=
         inherited1::operator=(std::move(other));
         inherited2::operator=(std::move(other));
         addEntries(other);
+        _singlePrecision = other._singlePrecision;
         other.clear();
     }
     ODL_OBJEXIT_P(this); //####
@@ -803,7 +804,7 @@ nImO::Array::writeToMessage
 
                 if (nullptr == doubleValue)
                 {
-                    Double::writeValuesToMessage(doublesSeen, outMessage);
+                    Double::writeValuesToMessage(doublesSeen, outMessage, _singlePrecision);
                     walker->writeToMessage(outMessage);
                 }
                 else
@@ -813,7 +814,7 @@ nImO::Array::writeToMessage
             }
         }
         // Write out any held Double values
-        Double::writeValuesToMessage(doublesSeen, outMessage);
+        Double::writeValuesToMessage(doublesSeen, outMessage, _singlePrecision);
         outMessage.appendBytes(&endArray, sizeof(endArray));
     }
     else
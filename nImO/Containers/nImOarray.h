@@ -283,6 +283,7 @@ namespace nImO
                 {
                     clear();
                     addEntries(other);
+                    _singlePrecision = other._singlePrecision;
                 }
                 return *this;
             }
@@ -339,6 +340,15 @@ namespace nImO
                 (const StringBuffer &   inBuffer,
                  size_t &               position);
 
+            /*! @brief Set whether the floating-point values in the Array are written as single-precision values.
+             @param[in] singlePrecision @c true if floating-point values are to be written as single-precision values. */
+            inline void
+            setSinglePrecision
+                (const bool singlePrecision)
+            {
+                _singlePrecision = singlePrecision;
+            }
+
             /*! @brief Returns the number of elements in the Array. */
             size_t
             size
@@ -346,6 +356,17 @@ namespace nImO
                 const
                 override;
 
+            /*! @brief Return @c true if the floating-point values in the Array are written as single-precision values.
+             Note that the Message can also require single-precision values.
+             @return @c true if the floating-point values in the Array are written as single-precision values. */
+            inline bool
+            usesSinglePrecision
+                (void)
+                const
+            {
+                return _singlePrecision;
+            }
+
             /*! @brief Add a binary representation of the object to the message.
              @param[in] outMessage The Message to be appended to. */
             void
@@ -399,6 +420,9 @@ namespace nImO
         private :
             // Private fields.
 
+            /*! @brief @c true if the floating-point values are written as single-precision values. */
+            bool    _singlePrecision{false};
+
     }; // Array
 
 } // nImO
@@ -81,17 +81,20 @@ const size_t nImO::BufferChunk::kBufferSize = 1000;
 #endif // defined(__APPLE__)
 
 nImO::BufferChunk::BufferChunk
-    (const bool addPadding) :
-        _buffer{std::make_unique<uint8_t[]>(kBufferSize + (addPadding ? 1 : 0))}, _bufferEnd{nullptr}, _write{nullptr}, _padded{addPadding}
+    (const bool     addPadding,
+     const size_t   capacity) :
+        _buffer{new uint8_t[capacity + (addPadding ? 1 : 0)]}, _bufferEnd{nullptr}, _write{nullptr}, _capacity{capacity},
+        _padded{addPadding}
 {
     ODL_ENTER(); //####
     ODL_B1(addPadding); //####
+    ODL_I1(capacity); //####
     ODL_P1(_buffer.get()); //####
     if (_buffer)
     {
         ODL_LOG("(_buffer)"); //####
         _write = _buffer.get();
-        _bufferEnd = _write + kBufferSize;
+        _bufferEnd = _write + _capacity;
         ODL_P2(_bufferEnd, _write); //####
         ODL_I1(getDataSize()); //####
         if (_padded)
@@ -106,11 +109,13 @@ nImO::BufferChunk::BufferChunk
 nImO::BufferChunk::BufferChunk
     (BufferChunk && other)
     noexcept :
-        _buffer{std::move(other._buffer)}, _bufferEnd{other._bufferEnd}, _write{other._write}, _padded{other._padded}
+        _buffer{std::move(other._buffer)}, _bufferEnd{other._bufferEnd}, _write{other._write}, _capacity{other._capacity},
+        _padded{other._padded}
 {
     ODL_ENTER(); //####
     ODL_P1(&other); //####
     other._bufferEnd = other._write = nullptr;
+    other._capacity = 0;
     other._padded = false;
     ODL_EXIT_P(this); //####
 } // nImO::BufferChunk::BufferChunk
@@ -159,8 +164,10 @@ nImO::BufferChunk::operator=
         _buffer = std::move(other._buffer);
         _bufferEnd = other._bufferEnd;
         _write = other._write;
+        _capacity = other._capacity;
         _padded = other._padded;
         other._bufferEnd = other._write = nullptr;
+        other._capacity = 0;
         other._padded = false;
     }
     ODL_OBJEXIT_P(this); //####
@@ -172,6 +179,13 @@ nImO::BufferChunk::reset
     (void)
 {
     ODL_OBJENTER(); //####
+    if (1 < _buffer.use_count())
+    {
+        ODL_LOG("(1 < _buffer.use_count())"); //####
+        // Some of the data is still referenced elsewhere, so leave it alone.
+        _buffer.reset(new uint8_t[_capacity + (_padded ? 1 : 0)]);
+        _bufferEnd = _buffer.get() + _capacity;
+    }
     _write = _buffer.get();
     if (_padded)
     {
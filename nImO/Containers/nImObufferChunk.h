@@ -72,9 +72,11 @@ namespace nImO
 
             /*! @brief The constructor.
              @param[in] addPadding @c true if a single byte of padding is added to each buffer.
-             The padding is to support direct access to a chunk as a @c NULL-terminated string. */
+             The padding is to support direct access to a chunk as a @c NULL-terminated string.
+             @param[in] capacity The number of bytes that the chunk can hold. */
             explicit BufferChunk
-                (const bool addPadding);
+                (const bool     addPadding,
+                 const size_t   capacity = kBufferSize);
 
             /*! @brief The copy constructor.
              @param[in] other The object to be copied. */
@@ -108,6 +110,16 @@ namespace nImO
                 return StaticCast(size_t, _bufferEnd - _write);
             }
 
+            /*! @brief Return the number of bytes that the chunk can hold.
+             @return The number of bytes that the chunk can hold. */
+            inline size_t
+            getCapacity
+                (void)
+                const
+            {
+                return _capacity;
+            }
+
             /*! @brief Return the stored data.
              @return A pointer to the stored data. */
             inline CPtr(uint8_t)
@@ -118,6 +130,17 @@ namespace nImO
                 return _buffer.get();
             }
 
+            /*! @brief Return the stored data, sharing ownership with the chunk.
+             Note that the chunk will not reuse storage that is still shared when it is reset.
+             @return A shared pointer to the stored data. */
+            inline SpAuint8_t
+            getSharedData
+                (void)
+                const
+            {
+                return _buffer;
+            }
+
             /*! @brief Return the number of bytes used in the chunk.
              @return The number of bytes used in the chunk. */
             inline size_t
@@ -168,7 +191,7 @@ namespace nImO
             // Private fields.
 
             /*! @brief The internal buffer used to hold the assembled data. */
-            UpAuint8_t  _buffer{};
+            SpAuint8_t  _buffer{};
 
             /*! @brief The byte just past the end of the internal buffer. */
             Ptr(uint8_t)    _bufferEnd{nullptr};
@@ -176,6 +199,9 @@ namespace nImO
             /*! @brief The next byte to write in the internal buffer. */
             Ptr(uint8_t)    _write{nullptr};
 
+            /*! @brief The number of bytes that the internal buffer can hold, not counting any padding. */
+            size_t  _capacity{0};
+
             /*! @brief @c true if the buffer has an extra byte. */
             bool    _padded{false};
 
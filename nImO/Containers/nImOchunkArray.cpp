@@ -39,6 +39,7 @@
 #include <Containers/nImOchunkArray.h>
 
 #include <Containers/nImObufferChunk.h>
+#include <Containers/nImOtextSink.h>
 
 #include <inttypes.h>
 #include <string>
@@ -85,7 +86,8 @@ using namespace nImO;
 
 nImO::ChunkArray::ChunkArray
     (const bool padWithNull) :
-        _buffers{new Ptr(BufferChunk)[1]}, _buffersArePadded{padWithNull}, _cachedString{}, _numChunks{1}
+        _buffers{new Ptr(BufferChunk)[1]}, _buffersArePadded{padWithNull}, _cachedString{}, _chunkSize{BufferChunk::kBufferSize},
+        _numChunks{1}
 {
     ODL_ENTER(); //####
     ODL_B1(padWithNull); //####
@@ -96,11 +98,23 @@ nImO::ChunkArray::ChunkArray
     ODL_EXIT_P(this); //####
 } // nImO::ChunkArray::ChunkArray
 
+nImO::ChunkArray::ChunkArray
+    (TextSink &     sink,
+     const bool     padWithNull) :
+        ChunkArray(padWithNull)
+{
+    ODL_ENTER(); //####
+    ODL_P1(&sink); //####
+    ODL_B1(padWithNull); //####
+    _sink = &sink;
+    ODL_EXIT_P(this); //####
+} // nImO::ChunkArray::ChunkArray
+
 nImO::ChunkArray::ChunkArray
     (ChunkArray &&  other)
     noexcept :
         _buffers{other._buffers}, _buffersArePadded{other._buffersArePadded}, _cachedString{other._cachedString},
-        _numChunks{other._numChunks}
+        _chunkSize{other._chunkSize}, _numChunks{other._numChunks}, _sink{other._sink}
 {
     ODL_ENTER(); //####
     ODL_P1(&other); //####
@@ -108,6 +122,7 @@ nImO::ChunkArray::ChunkArray
     other._buffersArePadded = false;
     other._cachedString = ""s;
     other._numChunks = 0;
+    other._sink = nullptr;
     ODL_EXIT_P(this); //####
 } // nImO::ChunkArray::ChunkArray
 
@@ -146,6 +161,16 @@ nImO::ChunkArray::appendBytes
 
         // Invalidate the cache.
         _cachedString.clear();
+        // A large block that starts the buffer, such as a received Message, is kept in a single chunk, so that the bytes can be
+        // shared without being gathered from several chunks.
+        if ((nullptr == _sink) && (1 == _numChunks) && (0 == _buffers[0]->getDataSize()) && (_chunkSize < numBytes))
+        {
+            ODL_LOG("((nullptr == _sink) && (1 == _numChunks) && (0 == _buffers[0]->getDataSize()) && (_chunkSize < numBytes))"); //####
+            delete _buffers[0];
+            _buffers[0] = new BufferChunk(_buffersArePadded, numBytes);
+            _chunkSize = numBytes;
+            ODL_I1(_chunkSize); //####
+        }
         for (size_t bytesLeft = numBytes; 0 < bytesLeft; )
         {
             Ptr(BufferChunk)    lastChunk{_buffers[_numChunks - 1]};
@@ -160,35 +185,63 @@ nImO::ChunkArray::appendBytes
             else
             {
                 ODL_LOG("! (bytesLeft <= available)"); //####
-                Ptr(BufferChunk)    prevChunk{lastChunk};
-
-                lastChunk = new BufferChunk(_buffersArePadded);
-                if (nullptr == lastChunk)
-                {
-                    ODL_LOG("(nullptr == lastChunk)"); //####
-                    bytesLeft = 0;
-                }
-                else
+                if (nullptr == _sink)
                 {
-                    auto    newBuffers{new Ptr(BufferChunk)[_numChunks + 1]};
+                    ODL_LOG("(nullptr == _sink)"); //####
+                    Ptr(BufferChunk)    prevChunk{lastChunk};
 
-                    if (nullptr == newBuffers)
+                    lastChunk = new BufferChunk(_buffersArePadded, _chunkSize);
+                    if (nullptr == lastChunk)
                     {
-                        ODL_LOG("(nullptr == newBuffers)"); //####
-                        delete lastChunk;
+                        ODL_LOG("(nullptr == lastChunk)"); //####
                         bytesLeft = 0;
                     }
                     else
                     {
-                        memcpy(newBuffers, _buffers, sizeof(*_buffers) * _numChunks);
-                        delete[] _buffers;
-                        _buffers = newBuffers;
-                        ODL_P1(_buffers); //####
-                        _buffers[_numChunks++] = lastChunk;
-                        ODL_I1(_numChunks); //####
-                        prevChunk->appendData(walker, available);
+                        auto    newBuffers{new Ptr(BufferChunk)[_numChunks + 1]};
+
+                        if (nullptr == newBuffers)
+                        {
+                            ODL_LOG("(nullptr == newBuffers)"); //####
+                            delete lastChunk;
+                            bytesLeft = 0;
+                        }
+                        else
+                        {
+                            memcpy(newBuffers, _buffers, sizeof(*_buffers) * _numChunks);
+                            delete[] _buffers;
+                            _buffers = newBuffers;
+                            ODL_P1(_buffers); //####
+                            _buffers[_numChunks++] = lastChunk;
+                            ODL_I1(_numChunks); //####
+                            prevChunk->appendData(walker, available);
+                            walker += available;
+                            bytesLeft -= available;
+                        }
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (nullptr == _sink)"); //####
+                    // Rather than growing, fill the chunk and send it on.
+                    if (0 < lastChunk->getDataSize())
+                    {
+                        ODL_LOG("(0 < lastChunk->getDataSize())"); //####
+                        lastChunk->appendData(walker, available);
                         walker += available;
                         bytesLeft -= available;
+                        _sink->write(lastChunk->getData(), lastChunk->getDataSize());
+                        lastChunk->reset();
+                    }
+                    else
+                    {
+                        ODL_LOG("! (0 < lastChunk->getDataSize())"); //####
+                        // There is more than a chunk's worth of data, so send it without copying.
+                        size_t  toSend{bytesLeft - (bytesLeft % available)};
+
+                        _sink->write(walker, toSend);
+                        walker += toSend;
+                        bytesLeft -= toSend;
                     }
                 }
             }
@@ -209,8 +262,8 @@ nImO::ChunkArray::atEnd
     if (nullptr != _buffers)
     {
         ODL_LOG("(nullptr != _buffers)"); //####
-        size_t  chunkNumber{index / BufferChunk::kBufferSize};
-        size_t  offset{index % BufferChunk::kBufferSize};
+        size_t  chunkNumber{index / _chunkSize};
+        size_t  offset{index % _chunkSize};
 
         ODL_I2(chunkNumber, offset); //####
         if (_numChunks > chunkNumber)
@@ -233,6 +286,33 @@ nImO::ChunkArray::atEnd
     return result;
 } // nImO::ChunkArray::atEnd
 
+bool
+nImO::ChunkArray::flush
+    (void)
+{
+    ODL_OBJENTER(); //####
+    bool    okSoFar{true};
+
+    if (nullptr != _sink)
+    {
+        ODL_LOG("(nullptr != _sink)"); //####
+        for (size_t ii = 0; _numChunks > ii; ++ii)
+        {
+            CPtr(BufferChunk)   aChunk{_buffers[ii]};
+
+            if ((nullptr != aChunk) && (0 < aChunk->getDataSize()))
+            {
+                ODL_LOG("((nullptr != aChunk) && (0 < aChunk->getDataSize()))"); //####
+                _sink->write(aChunk->getData(), aChunk->getDataSize());
+            }
+        }
+        reset();
+        okSoFar = _sink->flush();
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::ChunkArray::flush
+
 int
 nImO::ChunkArray::getByte
     (const size_t   index,
@@ -248,8 +328,8 @@ nImO::ChunkArray::getByte
     if (nullptr != _buffers)
     {
         ODL_LOG("(nullptr != _buffers)"); //####
-        size_t  chunkNumber{index / BufferChunk::kBufferSize};
-        size_t  offset{index % BufferChunk::kBufferSize};
+        size_t  chunkNumber{index / _chunkSize};
+        size_t  offset{index % _chunkSize};
 
         ODL_I2(chunkNumber, offset); //####
         if (_numChunks > chunkNumber)
@@ -276,6 +356,42 @@ nImO::ChunkArray::getByte
     return result;
 } // nImO::ChunkArray::getByte
 
+CPtr(uint8_t)
+nImO::ChunkArray::getContiguousBytes
+    (const size_t   index,
+     size_t &       numBytes)
+    const
+{
+    ODL_OBJENTER(); //####
+    ODL_I1(index); //####
+    ODL_P1(&numBytes); //####
+    CPtr(uint8_t)   result{nullptr};
+
+    numBytes = 0;
+    if (nullptr != _buffers)
+    {
+        ODL_LOG("(nullptr != _buffers)"); //####
+        size_t  chunkNumber{index / _chunkSize};
+        size_t  offset{index % _chunkSize};
+
+        ODL_I2(chunkNumber, offset); //####
+        if (_numChunks > chunkNumber)
+        {
+            ODL_LOG("(_numChunks > chunkNumber)"); //####
+            Ptr(BufferChunk)    aChunk{_buffers[chunkNumber]};
+
+            if ((nullptr != aChunk) && (offset < aChunk->getDataSize()))
+            {
+                ODL_LOG("((nullptr != aChunk) && (offset < aChunk->getDataSize()))"); //####
+                result = aChunk->getData() + offset;
+                numBytes = aChunk->getDataSize() - offset;
+            }
+        }
+    }
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // nImO::ChunkArray::getContiguousBytes
+
 size_t
 nImO::ChunkArray::getLength
     (void)
@@ -289,7 +405,7 @@ nImO::ChunkArray::getLength
         ODL_LOG("(nullptr != _buffers)"); //####
         CPtr(BufferChunk)   aChunk{_buffers[_numChunks - 1]};
 
-        totalLength = ((_numChunks - 1) * BufferChunk::kBufferSize);
+        totalLength = ((_numChunks - 1) * _chunkSize);
         if (nullptr != aChunk)
         {
             ODL_LOG("(nullptr != aChunk)"); //####
@@ -300,6 +416,52 @@ nImO::ChunkArray::getLength
     return totalLength;
 } // nImO::ChunkArray::getLength
 
+nImO::SpAuint8_t
+nImO::ChunkArray::getSharedBytes
+    (const size_t   index,
+     const size_t   numBytes)
+    const
+{
+    ODL_OBJENTER(); //####
+    ODL_I2(index, numBytes); //####
+    SpAuint8_t  result{};
+
+    if ((nullptr != _buffers) && (0 < numBytes) && (! atEnd(index + numBytes - 1)))
+    {
+        ODL_LOG("((nullptr != _buffers) && (0 < numBytes) && (! atEnd(index + numBytes - 1)))"); //####
+        size_t  chunkNumber{index / _chunkSize};
+        size_t  offset{index % _chunkSize};
+
+        ODL_I2(chunkNumber, offset); //####
+        if ((offset + numBytes) <= _chunkSize)
+        {
+            ODL_LOG("((offset + numBytes) <= _chunkSize)"); //####
+            auto    chunkData{_buffers[chunkNumber]->getSharedData()};
+
+            result = SpAuint8_t{chunkData, chunkData.get() + offset};
+        }
+        else
+        {
+            ODL_LOG("! ((offset + numBytes) <= _chunkSize)"); //####
+            SpAuint8_t      holder{new uint8_t[numBytes]};
+            Ptr(uint8_t)    walker{holder.get()};
+
+            // All the chunks but the last are full, so the bytes are contiguous within each chunk.
+            for (size_t bytesLeft = numBytes; 0 < bytesLeft; ++chunkNumber, offset = 0)
+            {
+                size_t  count{std::min(bytesLeft, _chunkSize - offset)};
+
+                memcpy(walker, _buffers[chunkNumber]->getData() + offset, count);
+                walker += count;
+                bytesLeft -= count;
+            }
+            result = holder;
+        }
+    }
+    ODL_OBJEXIT_P(result.get()); //####
+    return result;
+} // nImO::ChunkArray::getSharedBytes
+
 std::string
 nImO::ChunkArray::getString
     (void)
@@ -328,6 +490,7 @@ nImO::ChunkArray::getString
     ODL_I2(length, walker); //####
     if (index < length)
     {
+        result.reserve(length - index);
         for (size_t ii = 0; _numChunks > ii; ++ii)
         {
             CPtr(BufferChunk)   aChunk{_buffers[ii]};
@@ -335,16 +498,19 @@ nImO::ChunkArray::getString
             if (nullptr != aChunk)
             {
                 ODL_LOG("(nullptr != aChunk)"); //####
-                auto    data{aChunk->getData()};
+                auto    data{ReinterpretCast(CPtr(char), aChunk->getData())};
+                size_t  nn{aChunk->getDataSize()};
 
-                for (size_t jj = 0, nn = aChunk->getDataSize(); nn > jj; ++jj, ++data)
+                // Copy the part of the chunk at or after the index in one step.
+                if (index < (walker + nn))
                 {
-                    if (walker++ >= index)
-                    {
-                        result += *data;
-                    }
-                    ODL_I2(walker, jj); //####
+                    ODL_LOG("(index < (walker + nn))"); //####
+                    size_t  skip{(index > walker) ? (index - walker) : 0};
+
+                    result.append(data + skip, nn - skip);
                 }
+                walker += nn;
+                ODL_I1(walker); //####
             }
         }
     }
@@ -364,11 +530,14 @@ nImO::ChunkArray::operator=
         _buffers = other._buffers;
         _buffersArePadded = other._buffersArePadded;
         _cachedString = other._cachedString;
+        _chunkSize = other._chunkSize;
         _numChunks = other._numChunks;
+        _sink = other._sink;
         other._buffers = nullptr;
         other._buffersArePadded = false;
         other._cachedString = ""s;
         other._numChunks = 0;
+        other._sink = nullptr;
     }
     ODL_OBJEXIT_P(this); //####
     return *this;
@@ -398,8 +567,20 @@ nImO::ChunkArray::reset
         delete[] _buffers;
         _buffers = new Ptr(BufferChunk)[1];
         *_buffers = firstChunk;
+        _numChunks = 1;
+    }
+    if (BufferChunk::kBufferSize == _chunkSize)
+    {
+        _buffers[0]->reset();
+    }
+    else
+    {
+        ODL_LOG("! (BufferChunk::kBufferSize == _chunkSize)"); //####
+        // Go back to normal-sized chunks; any bytes of the large chunk that are still shared stay with their holders.
+        delete _buffers[0];
+        _buffers[0] = new BufferChunk(_buffersArePadded);
+        _chunkSize = BufferChunk::kBufferSize;
     }
-    _buffers[0]->reset();
     ODL_OBJEXIT_P(this); //####
     return *this;
 } // nImO::ChunkArray::reset
@@ -75,6 +75,15 @@ namespace nImO
             explicit ChunkArray
                 (const bool padWithNull = false);
 
+            /*! @brief The constructor for a buffer that sends its contents to a TextSink.
+             Rather than growing, the buffer hands a chunk to the sink each time that it fills up;
+             the remaining contents are sent when the buffer is flushed.
+             @param[in] sink The destination for the contents of the buffer.
+             @param[in] padWithNull @c true if the data needs to be @c NULL-terminated. */
+            explicit ChunkArray
+                (TextSink &     sink,
+                 const bool     padWithNull = false);
+
             /*! @brief The copy constructor.
             @param[in] other The object to be copied. */
             ChunkArray
@@ -141,6 +150,13 @@ namespace nImO
                 (const size_t   index)
                 const;
 
+            /*! @brief Send the contents of the buffer to the TextSink and prepare the buffer for reuse.
+             Nothing is done if the buffer is not attached to a TextSink.
+             @return @c true if the contents were sent. */
+            bool
+            flush
+                (void);
+
             /*! @brief Return the byte found at a particular index.
             @param[in] index The zero-based location in the buffer.
             @param[out] atEnd @c true if the index is past the end of the buffer.
@@ -151,6 +167,18 @@ namespace nImO
                  bool &         atEnd)
                 const;
 
+            /*! @brief Return the bytes that follow a particular index and are stored contiguously.
+             This allows the buffer to be scanned a chunk at a time, rather than a byte at a time.
+             @param[in] index The zero-based location in the buffer.
+             @param[out] numBytes The number of bytes that can be read from the returned position.
+             @return The position of the byte at the provided index or @c nullptr if the index is past
+             the end of the buffer. */
+            CPtr(uint8_t)
+            getContiguousBytes
+                (const size_t   index,
+                 size_t &       numBytes)
+                const;
+
             /*! @brief Return the number of valid bytes in the buffer.
             @return The number of valid bytes in the buffer. */
             virtual size_t
@@ -158,7 +186,23 @@ namespace nImO
                 (void)
                 const;
 
+            /*! @brief Return a sequence of bytes from the buffer, without copying if possible.
+             If the bytes are all within one chunk, the result shares the storage of the chunk;
+             otherwise, the bytes are gathered into new storage. A block of bytes that is larger than a
+             chunk and is added to an empty buffer, as a received Message is, is kept in a single chunk,
+             so that any part of it can be shared.
+             @param[in] index The zero-based location in the buffer of the first byte.
+             @param[in] numBytes The number of bytes to return.
+             @return The bytes or @c nullptr if the buffer does not hold all of the bytes. */
+            SpAuint8_t
+            getSharedBytes
+                (const size_t   index,
+                 const size_t   numBytes)
+                const;
+
             /*! @brief Return a copy of the bytes in the buffer.
+             Note that, for a buffer attached to a TextSink, only the bytes that have not yet been sent
+             are returned.
              @return A copy of the bytes in the buffer. */
             virtual std::string
             getString
@@ -239,9 +283,17 @@ namespace nImO
             /*! @brief The cached value of the buffer. */
             std::string _cachedString{};
 
+            /*! @brief The number of bytes in each chunk; it is only larger than normal when the buffer was started with a large
+             block of bytes. */
+            size_t  _chunkSize{0};
+
             /*! @brief The number of buffer chunks being used. */
             size_t  _numChunks{0};
 
+            /*! @brief The destination for the contents of the buffer or @c nullptr if the buffer
+             grows to hold all of its contents. */
+            Ptr(TextSink)   _sink{nullptr};
+
     }; // ChunkArray
 
 } // nImO
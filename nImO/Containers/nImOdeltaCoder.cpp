@@ -0,0 +1,437 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOdeltaCoder.cpp
+//
+//  Project:    nImO
+//
+//  Contains:   The class definition for delta encoding of successive Values on a channel.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include <Containers/nImOdeltaCoder.h>
+
+#include <BasicTypes/nImOinteger.h>
+#include <BasicTypes/nImOlogical.h>
+#include <Containers/nImOarray.h>
+#include <Containers/nImOmap.h>
+#include <Containers/nImOset.h>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for delta encoding of successive Values on a channel. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace nImO;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+const std::string   nImO::kDeltaKeyframeRequest{"nImO keyframe"};
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return a new Map formed by applying a delta to a Map.
+ @param[in] previous The Map that the delta is relative to.
+ @param[in] delta The delta to be applied.
+ @return The new Map or @c nullptr if the delta is not valid for the Map. */
+static SpMap
+applyMapDelta
+    (const Map &    previous,
+     const Array &  delta)
+{
+    ODL_ENTER(); //####
+    ODL_P2(&previous, &delta); //####
+    SpMap   result;
+
+    if (3 == delta.size())
+    {
+        auto    replaced{delta.at(0)->asMap()};
+        auto    changed{delta.at(1)->asMap()};
+        auto    removed{delta.at(2)->asSet()};
+
+        if ((nullptr != replaced) && (nullptr != changed) && (nullptr != removed))
+        {
+            // The new Map shares the unchanged entries with the previous Map.
+            result = std::make_shared<Map>(previous);
+            for (auto & walker : *removed)
+            {
+                result->erase(walker);
+            }
+            for (auto & walker : *replaced)
+            {
+                result->erase(walker.first);
+                result->addValue(walker.first, walker.second);
+            }
+            for (auto & walker : *changed)
+            {
+                auto    match{result->find(walker.first)};
+                SpMap   newValue;
+
+                if (result->end() != match)
+                {
+                    auto    previousValue{match->second->asMap()};
+                    auto    nestedDelta{walker.second->asArray()};
+
+                    if ((nullptr != previousValue) && (nullptr != nestedDelta))
+                    {
+                        newValue = applyMapDelta(*previousValue, *nestedDelta);
+                    }
+                }
+                if (newValue)
+                {
+                    match->second = newValue;
+                }
+                else
+                {
+                    ODL_LOG("! (newValue)"); //####
+                    result.reset();
+                    break;
+                }
+            }
+        }
+    }
+    ODL_EXIT_P(result.get()); //####
+    return result;
+} // applyMapDelta
+
+/*! @brief Return the delta between two Maps.
+ The delta is an Array of a Map of the entries that were added or replaced, a Map of the entries
+ whose Map values were changed, as deltas, and a Set of the keys that were removed.
+ @param[in] previous The Map that the delta is relative to.
+ @param[in] current The Map to be described.
+ @return The delta or @c nullptr if every entry of the current Map would be in the delta. */
+static SpArray
+createMapDelta
+    (const Map &    previous,
+     const Map &    current)
+{
+    ODL_ENTER(); //####
+    ODL_P2(&previous, &current); //####
+    SpArray result;
+    auto    replaced{std::make_shared<Map>()};
+    auto    changed{std::make_shared<Map>()};
+    auto    removed{std::make_shared<Set>()};
+
+    for (auto & walker : current)
+    {
+        auto    match{previous.find(walker.first)};
+
+        if (previous.end() == match)
+        {
+            replaced->addValue(walker.first, walker.second);
+        }
+        else
+        {
+            if (! walker.second->deeplyEqualTo(*match->second))
+            {
+                auto    previousValue{match->second->asMap()};
+                auto    currentValue{walker.second->asMap()};
+                SpArray nestedDelta;
+
+                if ((nullptr != previousValue) && (nullptr != currentValue))
+                {
+                    nestedDelta = createMapDelta(*previousValue, *currentValue);
+                }
+                if (nestedDelta)
+                {
+                    changed->addValue(walker.first, nestedDelta);
+                }
+                else
+                {
+                    replaced->addValue(walker.first, walker.second);
+                }
+            }
+        }
+    }
+    for (auto & walker : previous)
+    {
+        if (current.end() == current.find(walker.first))
+        {
+            removed->addValue(walker.first);
+        }
+    }
+    // If nothing is carried over from the previous Map, the delta can't be smaller than the Map; otherwise, the
+    // caller compares the encoded sizes.
+    if (replaced->size() < current.size())
+    {
+        result = std::make_shared<Array>();
+        result->addValue(replaced);
+        result->addValue(changed);
+        result->addValue(removed);
+    }
+    ODL_EXIT_P(result.get()); //####
+    return result;
+} // createMapDelta
+
+/*! @brief Return the number of bytes needed to write a Value to a Message.
+ @param[in,out] scratch A Message used to hold the encoded Value, which is closed on return.
+ @param[in] aValue The Value of interest.
+ @return The number of bytes needed to write the Value. */
+static size_t
+encodedLength
+    (Message &      scratch,
+     const Value &  aValue)
+{
+    ODL_ENTER(); //####
+    ODL_P2(&scratch, &aValue); //####
+    size_t  result;
+
+    scratch.open(true);
+    aValue.writeToMessage(scratch);
+    // Message::getLength() reports zero until the Message is closed, so ask the underlying buffer.
+    result = scratch.ChunkArray::getLength();
+    scratch.close();
+    ODL_EXIT_I(result); //####
+    return result;
+} // encodedLength
+
+/*! @brief Extract the parts of an envelope.
+ @param[in] envelope The envelope to be examined.
+ @param[out] sequence The sequence number of the envelope.
+ @param[out] isKeyframe @c true if the envelope holds a keyframe.
+ @param[out] payload The payload of the envelope.
+ @return @c true if the envelope is valid. */
+static bool
+unpackEnvelope
+    (SpValue    envelope,
+     int64_t &  sequence,
+     bool &     isKeyframe,
+     SpValue &  payload)
+{
+    ODL_ENTER(); //####
+    ODL_P4(envelope.get(), &sequence, &isKeyframe, &payload); //####
+    bool    okSoFar{false};
+
+    if (envelope)
+    {
+        auto    asArray{envelope->asArray()};
+
+        if ((nullptr != asArray) && (3 == asArray->size()))
+        {
+            auto    sequenceValue{asArray->at(0)->asInteger()};
+            auto    keyframeValue{asArray->at(1)->asLogical()};
+
+            if ((nullptr != sequenceValue) && (nullptr != keyframeValue))
+            {
+                sequence = sequenceValue->getIntegerValue();
+                isKeyframe = keyframeValue->getValue();
+                payload = asArray->at(2);
+                okSoFar = (isKeyframe || (nullptr != payload->asArray()));
+            }
+        }
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // unpackEnvelope
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+nImO::DeltaCoder::DeltaCoder
+    (const size_t   keyframeInterval) :
+        _keyframeInterval{keyframeInterval}
+{
+    ODL_ENTER(); //####
+    ODL_I1(keyframeInterval); //####
+    ODL_EXIT_P(this); //####
+} // nImO::DeltaCoder::DeltaCoder
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+SpValue
+nImO::DeltaCoder::decodeValue
+    (SpValue    envelope)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(envelope.get()); //####
+    SpValue result;
+    int64_t sequence;
+    bool    isKeyframe;
+    SpValue payload;
+
+    if (unpackEnvelope(envelope, sequence, isKeyframe, payload))
+    {
+        if (isKeyframe)
+        {
+            result = payload;
+        }
+        else
+        {
+            // A delta can only be applied to the Value that it was made from.
+            if (_previousValue && ((_sequence + 1) == sequence))
+            {
+                auto    previousMap{_previousValue->asMap()};
+
+                if (nullptr != previousMap)
+                {
+                    result = applyMapDelta(*previousMap, *payload->asArray());
+                }
+            }
+        }
+    }
+    if (result)
+    {
+        _previousValue = result;
+        _sequence = sequence;
+        _keyframeNeeded = false;
+    }
+    else
+    {
+        ODL_LOG("! (result)"); //####
+        _keyframeNeeded = true;
+    }
+    ODL_OBJEXIT_P(result.get()); //####
+    return result;
+} // nImO::DeltaCoder::decodeValue
+
+SpValue
+nImO::DeltaCoder::encodeValue
+    (SpValue    value,
+     const bool singlePrecision)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(value.get()); //####
+    ODL_B1(singlePrecision); //####
+    auto    result{std::make_shared<Array>()};
+    SpArray delta;
+    bool    keyframeRequested{_keyframeNeeded.exchange(false)};
+
+    if ((! keyframeRequested) && _previousValue && ((_sentSinceKeyframe + 1) < _keyframeInterval))
+    {
+        auto    previousMap{_previousValue->asMap()};
+        auto    currentMap{value->asMap()};
+
+        if ((nullptr != previousMap) && (nullptr != currentMap))
+        {
+            delta = createMapDelta(*previousMap, *currentMap);
+        }
+        if (delta)
+        {
+            // Only send the delta if it takes fewer bytes than the Value, as the Value would be written.
+            _scratch.setSinglePrecision(singlePrecision);
+            if (encodedLength(_scratch, *delta) >= encodedLength(_scratch, *value))
+            {
+                ODL_LOG("(encodedLength(_scratch, *delta) >= encodedLength(_scratch, *value))"); //####
+                delta.reset();
+            }
+        }
+    }
+    result->addValue(std::make_shared<Integer>(++_sequence));
+    if (delta)
+    {
+        ++_sentSinceKeyframe;
+        result->addValue(std::make_shared<Logical>(false));
+        result->addValue(delta);
+    }
+    else
+    {
+        _sentSinceKeyframe = 0;
+        result->addValue(std::make_shared<Logical>(true));
+        result->addValue(value);
+    }
+    ODL_OBJEXIT_P(result.get()); //####
+    return result;
+} // nImO::DeltaCoder::encodeValue
+
+void
+nImO::DeltaCoder::recordSentMessage
+    (Message &  sentMessage)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(&sentMessage); //####
+    int64_t sequence;
+    bool    isKeyframe;
+    SpValue payload;
+    SpValue sentValue;
+
+    // Read back what was sent, so that the base for the next delta is not shared with the caller, who may modify
+    // the Value after sending it, and so that rounding done while writing the Message is seen by both ends.
+    if (unpackEnvelope(sentMessage.getValue(true), sequence, isKeyframe, payload))
+    {
+        if (isKeyframe)
+        {
+            sentValue = payload;
+        }
+        else
+        {
+            if (_previousValue)
+            {
+                auto    previousMap{_previousValue->asMap()};
+
+                if (nullptr != previousMap)
+                {
+                    sentValue = applyMapDelta(*previousMap, *payload->asArray());
+                }
+            }
+        }
+    }
+    _previousValue = sentValue;
+    ODL_OBJEXIT(); //####
+} // nImO::DeltaCoder::recordSentMessage
+
+void
+nImO::DeltaCoder::reset
+    (void)
+{
+    ODL_OBJENTER(); //####
+    _previousValue.reset();
+    _sequence = 0;
+    _sentSinceKeyframe = 0;
+    _keyframeNeeded = true;
+    ODL_OBJEXIT(); //####
+} // nImO::DeltaCoder::reset
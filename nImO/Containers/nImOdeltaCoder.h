@@ -0,0 +1,204 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOdeltaCoder.h
+//
+//  Project:    nImO
+//
+//  Contains:   The class declaration for delta encoding of successive Values on a channel.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(nImOdeltaCoder_H_))
+# define nImOdeltaCoder_H_ /* Header guard */
+
+# include <Containers/nImOmessage.h>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for delta encoding of successive Values on a channel. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace nImO
+{
+    /*! @brief The datagram sent by a receiver to ask for a keyframe. */
+    extern const std::string    kDeltaKeyframeRequest;
+
+    /*! @brief A class to provide delta encoding of successive Values on a channel.
+
+     Each Value is sent as an Array holding a sequence number, a Logical that is @c true for a
+     keyframe and the payload. The payload of a keyframe is the Value itself; otherwise, the payload
+     is the difference between the Value and the one before it, which is an Array of a Map of the
+     entries that were added or replaced, a Map of the entries whose Map values were changed, as
+     deltas, and a Set of the keys that were removed. Only Maps are sent as deltas; anything else is
+     always sent as a keyframe.
+     The receiver only accepts a delta that follows the last Value that it reconstructed; after a
+     gap, it drops deltas until the next keyframe. Note that the reconstructed Values share their
+     unchanged parts with the Values that came before them, so they should not be modified. */
+    class DeltaCoder final
+    {
+
+        public :
+            // Public type definitions.
+
+        protected :
+            // Protected type definitions.
+
+        private :
+            // Private type definitions.
+
+        public :
+            // Public methods.
+
+            /*! @brief The constructor.
+             @param[in] keyframeInterval The number of Values sent for each keyframe; this is ignored by receivers. */
+            explicit DeltaCoder
+                (const size_t   keyframeInterval);
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            DeltaCoder
+                (const DeltaCoder & other) = delete;
+
+            /*! @brief The move constructor.
+             @param[in] other The object to be moved. */
+            DeltaCoder
+                (DeltaCoder &&  other)
+                noexcept = delete;
+
+            /*! @brief Reconstruct a Value from a received envelope.
+             @param[in] envelope The received Value.
+             @return The reconstructed Value or @c nullptr if it could not be reconstructed, in which
+             case a keyframe is needed. */
+            SpValue
+            decodeValue
+                (SpValue    envelope);
+
+            /*! @brief Return the envelope to be sent for a Value.
+             A delta is only sent if its encoding is smaller than that of the Value.
+             @param[in] value The Value to be sent.
+             @param[in] singlePrecision @c true if floating-point values are sent as single-precision values.
+             @return The envelope to be sent. */
+            SpValue
+            encodeValue
+                (SpValue    value,
+                 const bool singlePrecision);
+
+            /*! @brief Return @c true if a keyframe is needed to continue reconstructing Values.
+             @return @c true if a keyframe is needed to continue reconstructing Values. */
+            inline bool
+            isKeyframeNeeded
+                (void)
+                const
+            {
+                return _keyframeNeeded;
+            }
+
+            /*! @brief The copy assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            DeltaCoder &
+            operator=
+                (const DeltaCoder & other) = delete;
+
+            /*! @brief The move assignment operator.
+             @param[in] other The object to be moved.
+             @return The updated object. */
+            DeltaCoder &
+            operator=
+                (DeltaCoder &&  other)
+                noexcept = delete;
+
+            /*! @brief Record the Message that was sent for the last envelope.
+             The Value that the receiver will reconstruct is recovered from the Message and becomes the
+             base for the next delta, so that both ends have the same base even if floating-point values
+             were rounded or the caller modifies the Value after sending it.
+             @param[in] sentMessage The closed Message holding the last envelope. */
+            void
+            recordSentMessage
+                (Message &  sentMessage);
+
+            /*! @brief Force the next Value to be sent as a keyframe. */
+            inline void
+            requestKeyframe
+                (void)
+            {
+                _keyframeNeeded = true;
+            }
+
+            /*! @brief Forget the previous Value, so that the next Value is sent or expected as a keyframe. */
+            void
+            reset
+                (void);
+
+        protected :
+            // Protected methods.
+
+        private :
+            // Private methods.
+
+        public :
+            // Public fields.
+
+        protected :
+            // Protected fields.
+
+        private :
+            // Private fields.
+
+            /*! @brief The last Value that was sent or reconstructed. */
+            SpValue _previousValue{};
+
+            /*! @brief A Message used to compare the encoded sizes of deltas and Values. */
+            Message _scratch{};
+
+            /*! @brief The sequence number of the last envelope that was sent or accepted. */
+            int64_t _sequence{0};
+
+            /*! @brief The number of Values sent for each keyframe. */
+            size_t  _keyframeInterval{0};
+
+            /*! @brief The number of Values sent since the last keyframe. */
+            size_t  _sentSinceKeyframe{0};
+
+            /*! @brief @c true if the next Value must be a keyframe. */
+            std::atomic_bool    _keyframeNeeded{true};
+
+    }; // DeltaCoder
+
+} // nImO
+
+#endif // not defined(nImOdeltaCoder_H_)
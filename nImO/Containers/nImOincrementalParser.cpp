@@ -0,0 +1,289 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOincrementalParser.cpp
+//
+//  Project:    nImO
+//
+//  Contains:   The class definition for reading a stream of text as a sequence of Values.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include <Containers/nImOincrementalParser.h>
+
+#include <BasicTypes/nImOinvalid.h>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for reading a stream of text as a sequence of Values. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace nImO;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+nImO::IncrementalParser::IncrementalParser
+    (void)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // nImO::IncrementalParser::IncrementalParser
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+nImO::IncrementalParser::addLine
+    (const std::string &    aLine)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s(aLine); //####
+    addLine(aLine.c_str(), aLine.length());
+    ODL_OBJEXIT(); //####
+} // nImO::IncrementalParser::addLine
+
+void
+nImO::IncrementalParser::addLine
+    (CPtr(char)     aLine,
+     const size_t   length)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(aLine); //####
+    ODL_I1(length); //####
+    char    endOfLine{kEndOfLine};
+
+    scanCharacters(aLine, length);
+    scanCharacters(&endOfLine, 1);
+    ODL_OBJEXIT(); //####
+} // nImO::IncrementalParser::addLine
+
+void
+nImO::IncrementalParser::addString
+    (const std::string &    aString)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s(aString); //####
+    scanCharacters(aString.c_str(), aString.length());
+    ODL_OBJEXIT(); //####
+} // nImO::IncrementalParser::addString
+
+void
+nImO::IncrementalParser::completeValue
+    (void)
+{
+    ODL_OBJENTER(); //####
+    auto    aValue{_pending.convertToValue()};
+
+    if (aValue)
+    {
+        _values.push_back(aValue);
+    }
+    else
+    {
+        ODL_LOG("! (aValue)"); //####
+        _values.push_back(std::make_shared<Invalid>("Text could not be parsed as a Value"));
+    }
+    resetScan();
+    ODL_OBJEXIT(); //####
+} // nImO::IncrementalParser::completeValue
+
+nImO::SpValue
+nImO::IncrementalParser::getNextValue
+    (void)
+{
+    ODL_OBJENTER(); //####
+    SpValue result;
+
+    if (! _values.empty())
+    {
+        result = _values.front();
+        _values.pop_front();
+    }
+    ODL_OBJEXIT_P(result.get()); //####
+    return result;
+} // nImO::IncrementalParser::getNextValue
+
+void
+nImO::IncrementalParser::reset
+    (void)
+{
+    ODL_OBJENTER(); //####
+    _values.clear();
+    resetScan();
+    ODL_OBJEXIT(); //####
+} // nImO::IncrementalParser::reset
+
+void
+nImO::IncrementalParser::resetScan
+    (void)
+{
+    ODL_OBJENTER(); //####
+    _pending.reset();
+    _depth = 0;
+    _quoteChar = kEndOfString;
+    _inComment = _inEscape = _inString = _sawContent = false;
+    ODL_OBJEXIT(); //####
+} // nImO::IncrementalParser::resetScan
+
+void
+nImO::IncrementalParser::scanCharacters
+    (CPtr(char)     someText,
+     const size_t   length)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(someText); //####
+    ODL_I1(length); //####
+    size_t  segmentStart{0};
+
+    // Each character is examined once; the text is collected in segments, rather than a character at a time.
+    for (size_t ii = 0; length > ii; ++ii)
+    {
+        char    aChar{someText[ii]};
+
+        if (_inString)
+        {
+            if (_inEscape)
+            {
+                _inEscape = false;
+            }
+            else
+            {
+                if (kEscapeChar == aChar)
+                {
+                    _inEscape = true;
+                }
+                else
+                {
+                    _inString = (_quoteChar != aChar);
+                }
+            }
+        }
+        else
+        {
+            if (kEndOfLine == aChar)
+            {
+                _inComment = false;
+                if (0 >= _depth)
+                {
+                    if (_sawContent)
+                    {
+                        _pending.appendBytes(someText + segmentStart, ii + 1 - segmentStart);
+                        completeValue();
+                    }
+                    else
+                    {
+                        // Only whitespace and comments have been seen, so there's nothing to keep.
+                        resetScan();
+                    }
+                    segmentStart = ii + 1;
+                }
+            }
+            else
+            {
+                if (! _inComment)
+                {
+                    switch (aChar)
+                    {
+                        case kDoubleQuote :
+                        case kSingleQuote :
+                            _inString = true;
+                            _quoteChar = aChar;
+                            break;
+
+                        case kCommentChar :
+                            _inComment = true;
+                            break;
+
+                        case kStartArrayChar :
+                        case kStartMapChar :
+                        case kStartSetChar :
+                            ++_depth;
+                            break;
+
+                        case kEndArrayChar :
+                        case kEndMapChar :
+                        case kEndSetChar :
+                            --_depth;
+                            break;
+
+                        default :
+                            break;
+
+                    }
+                    if (! isspace(aChar))
+                    {
+                        _sawContent = (_sawContent || (kCommentChar != aChar));
+                    }
+                }
+            }
+        }
+    }
+    if (length > segmentStart)
+    {
+        _pending.appendBytes(someText + segmentStart, length - segmentStart);
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::IncrementalParser::scanCharacters
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,215 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOincrementalParser.h
+//
+//  Project:    nImO
+//
+//  Contains:   The class declaration for reading a stream of text as a sequence of Values.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(nImOincrementalParser_H_))
+# define nImOincrementalParser_H_ /* Header guard */
+
+# include <Containers/nImOstringBuffer.h>
+
+# include <deque>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for reading a stream of text as a sequence of Values. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace nImO
+{
+    /*! @brief A class to read a stream of text as a sequence of Values.
+
+     The text can be added in pieces of any size. A Value is complete at the end of a line that is
+     not within a String and that closes all the Arrays, Maps and Sets that were opened before it;
+     several Values on one line form an implicit Array, as with StringBuffer::convertToValue. Only the
+     text that is added is scanned and each complete Value is parsed once, so the time taken is
+     proportional to the length of the text rather than to the square of the number of lines in
+     each Value. */
+    class IncrementalParser final
+    {
+
+        public :
+            // Public type definitions.
+
+        protected :
+            // Protected type definitions.
+
+        private :
+            // Private type definitions.
+
+        public :
+            // Public methods.
+
+            /*! @brief The constructor. */
+            IncrementalParser
+                (void);
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            IncrementalParser
+                (const IncrementalParser &  other) = delete;
+
+            /*! @brief The move constructor.
+             @param[in] other The object to be moved. */
+            IncrementalParser
+                (IncrementalParser &&   other)
+                noexcept = delete;
+
+            /*! @brief Add a line of text, followed by an end-of-line.
+             @param[in] aLine The text to be added. */
+            void
+            addLine
+                (const std::string &    aLine);
+
+            /*! @brief Add a line of text, followed by an end-of-line.
+             @param[in] aLine The text to be added.
+             @param[in] length The number of characters in the line. */
+            void
+            addLine
+                (CPtr(char)     aLine,
+                 const size_t   length);
+
+            /*! @brief Add some text.
+             @param[in] aString The text to be added. */
+            void
+            addString
+                (const std::string &    aString);
+
+            /*! @brief Return the next complete Value.
+             @return The next complete Value, an Invalid if the text for the Value could not be parsed,
+             or @c nullptr if there are no complete Values. */
+            SpValue
+            getNextValue
+                (void);
+
+            /*! @brief Return @c true if there is text that is not yet part of a complete Value.
+             @return @c true if there is text that is not yet part of a complete Value. */
+            inline bool
+            hasPartialValue
+                (void)
+                const
+            {
+                return _sawContent;
+            }
+
+            /*! @brief The copy assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            IncrementalParser &
+            operator=
+                (const IncrementalParser &  other) = delete;
+
+            /*! @brief The move assignment operator.
+             @param[in] other The object to be moved.
+             @return The updated object. */
+            IncrementalParser &
+            operator=
+                (IncrementalParser &&   other)
+                noexcept = delete;
+
+            /*! @brief Discard any text and Values that have not been retrieved. */
+            void
+            reset
+                (void);
+
+        protected :
+            // Protected methods.
+
+        private :
+            // Private methods.
+
+            /*! @brief Parse the collected text as a Value and prepare for the next Value. */
+            void
+            completeValue
+                (void);
+
+            /*! @brief Clear the scanning state and the collected text. */
+            void
+            resetScan
+                (void);
+
+            /*! @brief Scan some text, collecting it and parsing each Value that it completes.
+             @param[in] someText The text to be scanned.
+             @param[in] length The number of characters to be scanned. */
+            void
+            scanCharacters
+                (CPtr(char)     someText,
+                 const size_t   length);
+
+        public :
+            // Public fields.
+
+        protected :
+            // Protected fields.
+
+        private :
+            // Private fields.
+
+            /*! @brief The text of the Value being collected. */
+            StringBuffer    _pending{};
+
+            /*! @brief The Values that are complete but have not been retrieved. */
+            std::deque<SpValue> _values{};
+
+            /*! @brief The number of Arrays, Maps and Sets that are open. */
+            int _depth{0};
+
+            /*! @brief The character that will end the String being scanned. */
+            char    _quoteChar{kEndOfString};
+
+            /*! @brief @c true if the scan is within a comment. */
+            bool    _inComment{false};
+
+            /*! @brief @c true if the next character is escaped. */
+            bool    _inEscape{false};
+
+            /*! @brief @c true if the scan is within a String. */
+            bool    _inString{false};
+
+            /*! @brief @c true if something other than whitespace and comments has been collected. */
+            bool    _sawContent{false};
+
+    }; // IncrementalParser
+
+} // nImO
+
+#endif // not defined(nImOincrementalParser_H_)
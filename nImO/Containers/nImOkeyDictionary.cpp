@@ -0,0 +1,178 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOkeyDictionary.cpp
+//
+//  Project:    nImO
+//
+//  Contains:   The class definition for per-connection Map key dictionaries.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include <Containers/nImOkeyDictionary.h>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for per-connection Map key dictionaries. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+nImO::KeyDictionary::KeyDictionary
+    (void)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // nImO::KeyDictionary::KeyDictionary
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+nImO::KeyDictionary::addKey
+    (const std::string &    key)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s(key); //####
+    std::lock_guard<std::mutex> guard{_lock};
+    bool                        result{false};
+
+    if ((kKeyDictionaryMaxSize > _keys.size()) && (_indices.end() == _indices.find(key)))
+    {
+        ODL_LOG("((kKeyDictionaryMaxSize > _keys.size()) && (_indices.end() == _indices.find(key)))"); //####
+        _indices.emplace(key, StaticCast(int64_t, _keys.size()));
+        _keys.push_back(key);
+        result = true;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // nImO::KeyDictionary::addKey
+
+int64_t
+nImO::KeyDictionary::findIndex
+    (const std::string &    key)
+    const
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s(key); //####
+    std::lock_guard<std::mutex> guard{_lock};
+    int64_t                     result{-1};
+    auto                        match{_indices.find(key)};
+
+    if (_indices.end() != match)
+    {
+        ODL_LOG("(_indices.end() != match)"); //####
+        result = match->second;
+    }
+    ODL_OBJEXIT_I(result); //####
+    return result;
+} // nImO::KeyDictionary::findIndex
+
+bool
+nImO::KeyDictionary::findKey
+    (const int64_t  index,
+     std::string &  key)
+    const
+{
+    ODL_OBJENTER(); //####
+    ODL_I1(index); //####
+    ODL_P1(&key); //####
+    std::lock_guard<std::mutex> guard{_lock};
+    bool                        result{(0 <= index) && (StaticCast(int64_t, _keys.size()) > index)};
+
+    if (result)
+    {
+        ODL_LOG("(result)"); //####
+        key = _keys[StaticCast(size_t, index)];
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // nImO::KeyDictionary::findKey
+
+void
+nImO::KeyDictionary::reset
+    (void)
+{
+    ODL_OBJENTER(); //####
+    std::lock_guard<std::mutex> guard{_lock};
+
+    _indices.clear();
+    _keys.clear();
+    ODL_OBJEXIT(); //####
+} // nImO::KeyDictionary::reset
+
+size_t
+nImO::KeyDictionary::size
+    (void)
+    const
+{
+    ODL_OBJENTER(); //####
+    std::lock_guard<std::mutex> guard{_lock};
+    size_t                      result{_keys.size()};
+
+    ODL_OBJEXIT_I(result); //####
+    return result;
+} // nImO::KeyDictionary::size
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,183 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOkeyDictionary.h
+//
+//  Project:    nImO
+//
+//  Contains:   The class declaration for per-connection Map key dictionaries.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(nImOkeyDictionary_H_))
+# define nImOkeyDictionary_H_ /* Header guard */
+
+# include <nImOcommon.h>
+
+# include <unordered_map>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for per-connection Map key dictionaries. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace nImO
+{
+    /*! @brief The maximum number of keys held by a KeyDictionary. */
+    constexpr size_t    kKeyDictionaryMaxSize{4096};
+
+    /*! @brief A class to provide a table of the String Map keys that have been seen on a connection.
+
+     The sending and the receiving ends of a connection each have a KeyDictionary. The first time
+     that a String key is seen in a Map, it is sent in full and both ends assign it the next index;
+     after that, the sender can send the index in place of the key. As both ends must see the keys
+     in the same order, this is only suitable for reliable, ordered transports, and both ends must
+     be reset whenever the connection is re-established. */
+    class KeyDictionary final
+    {
+
+        public :
+            // Public type definitions.
+
+        protected :
+            // Protected type definitions.
+
+        private :
+            // Private type definitions.
+
+            /*! @brief The mapping from keys to indices. */
+            using IndexMap = std::unordered_map<std::string, int64_t>;
+
+        public :
+            // Public methods.
+
+            /*! @brief The constructor. */
+            KeyDictionary
+                (void);
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            KeyDictionary
+                (const KeyDictionary &  other) = delete;
+
+            /*! @brief The move constructor.
+             @param[in] other The object to be moved. */
+            KeyDictionary
+                (KeyDictionary &&   other)
+                noexcept = delete;
+
+            /*! @brief Record a key, if it is not already present and there is room for it.
+             @param[in] key The key to be recorded.
+             @return @c true if the key was added and @c false if it was already present or the
+             dictionary is full. */
+            bool
+            addKey
+                (const std::string &    key);
+
+            /*! @brief Return the index of a key.
+             @param[in] key The key of interest.
+             @return The index of the key or @c -1 if the key has not been recorded. */
+            int64_t
+            findIndex
+                (const std::string &    key)
+                const;
+
+            /*! @brief Return the key with the given index.
+             @param[in] index The index of the key.
+             @param[out] key The key with the given index.
+             @return @c true if there is a key with the given index and @c false otherwise. */
+            bool
+            findKey
+                (const int64_t  index,
+                 std::string &  key)
+                const;
+
+            /*! @brief The copy assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            KeyDictionary &
+            operator=
+                (const KeyDictionary &  other) = delete;
+
+            /*! @brief The move assignment operator.
+             @param[in] other The object to be moved.
+             @return The updated object. */
+            KeyDictionary &
+            operator=
+                (KeyDictionary &&   other)
+                noexcept = delete;
+
+            /*! @brief Remove all the keys. */
+            void
+            reset
+                (void);
+
+            /*! @brief Return the number of keys.
+             @return The number of keys. */
+            size_t
+            size
+                (void)
+                const;
+
+        protected :
+            // Protected methods.
+
+        private :
+            // Private methods.
+
+        public :
+            // Public fields.
+
+        protected :
+            // Protected fields.
+
+        private :
+            // Private fields.
+
+            /*! @brief Mutual-exclusion protection. */
+            mutable std::mutex  _lock;
+
+            /*! @brief The indices of the keys. */
+            IndexMap    _indices{};
+
+            /*! @brief The keys, in the order that they were recorded. */
+            StdStringVector _keys{};
+
+    }; // KeyDictionary
+
+} // nImO
+
+#endif // not defined(nImOkeyDictionary_H_)
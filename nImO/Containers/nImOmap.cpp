@@ -40,7 +40,9 @@
 
 #include <BasicTypes/nImOinteger.h>
 #include <BasicTypes/nImOinvalid.h>
+#include <BasicTypes/nImOstring.h>
 #include <Containers/nImOarray.h>
+#include <Containers/nImOkeyDictionary.h>
 #include <Containers/nImOmessage.h>
 #include <Containers/nImOstringBuffer.h>
 
@@ -160,9 +162,12 @@ nImO::Map::addValue
         }
         if (newKey->enumerationType() == _keyKind)
         {
-            MapValue keyValue{newKey, newValue};
+            MapValue    keyValue{newKey, newValue};
+            size_t      oldSize{inherited2::size()};
 
-            result = inherited2::emplace(keyValue);
+            // Keys usually arrive in order, so try the end of the storage first.
+            result.first = inherited2::emplace_hint(inherited2::end(), keyValue);
+            result.second = (oldSize < inherited2::size());
         }
         else
         {
@@ -416,6 +421,8 @@ nImO::Map::extractValue
                     {
                         bool    okSoFar{true};
 
+                        // Each entry occupies at least two bytes, which bounds the count from a damaged Message.
+                        aMap->reserve(StaticCast(size_t, std::min(elementCount, StaticCast(int64_t, theMessage.getLength() / 2))));
                         for ( ; okSoFar && (elementCount > StaticCast(int64_t, aMap->size())); )
                         {
                             aByte = theMessage.getByte(position, atEnd);
@@ -444,6 +451,14 @@ nImO::Map::extractValue
                                     else
                                     {
                                         ODL_LOG("! (keyValue->asFlaw())"); //####
+                                        auto    keys{theMessage.getKeyDictionary()};
+                                        auto    keyString{keyValue->asString()};
+
+                                        // Mirror the sender, which adds each new key to its dictionary.
+                                        if (keys && (nullptr != keyString))
+                                        {
+                                            keys->addKey(keyString->getValue());
+                                        }
                                         aByte = theMessage.getByte(position, atEnd);
                                         ODL_X1(aByte); //####
                                         ODL_B1(atEnd); //####
@@ -876,10 +891,7 @@ nImO::Map::random
 
     if (0 < howMany)
     {
-        for (size_t ii = 0, keyNumber = (nImO::RandomUnsigned() % howMany); ii < keyNumber; ++ii)
-        {
-            ++result;
-        }
+        result += (nImO::RandomUnsigned() % howMany);
     }
     ODL_OBJEXIT(); //####
     return result;
@@ -895,10 +907,7 @@ nImO::Map::random
 
     if (0 < howMany)
     {
-        for (size_t ii = 0, keyNumber = (nImO::RandomUnsigned() % howMany); ii < keyNumber; ++ii)
-        {
-            ++result;
-        }
+        result += (nImO::RandomUnsigned() % howMany);
     }
     ODL_OBJEXIT(); //####
     return result;
@@ -1069,7 +1078,16 @@ nImO::Map::writeToMessage
         writeInt64ToMessage(outMessage, StaticCast(int, inherited2::size()) + kDataKindIntegerShortValueMinValue - 1);
         for (auto & walker : *this)
         {
-            walker.first->writeToMessage(outMessage);
+            auto    keyString{walker.first->asString()};
+
+            if (nullptr == keyString)
+            {
+                walker.first->writeToMessage(outMessage);
+            }
+            else
+            {
+                keyString->writeKeyToMessage(outMessage);
+            }
             walker.second->writeToMessage(outMessage);
         }
         outMessage.appendBytes(&endMap, sizeof(endMap));
@@ -56,8 +56,10 @@
 
 namespace nImO
 {
-    /*! @brief The standard class on which Array is based. */
-    using MapBase = std::map<SpValue, SpValue, CompareValues>;
+    /*! @brief The standard class on which Map is based.
+     Note that a sorted vector is used rather than a node-based tree, as Maps are most often
+     built from already-ordered data and then scanned. */
+    using MapBase = boost::container::flat_map<SpValue, SpValue, CompareValues>;
 
     /*! @brief A class to provide collections with hashtable-like behaviour.
 
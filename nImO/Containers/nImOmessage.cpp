@@ -45,6 +45,7 @@
 #include <Containers/nImObufferChunk.h>
 #include <nImOMIMESupport.h>
 
+#include <algorithm>
 #include <inttypes.h>
 #include <string>
 
@@ -99,6 +100,17 @@ static const DataKind   kInitNonEmptyMessageValue{nImO::DataKind::StartOfMessage
 /*! @brief The trailing byte for a non-empty Message. */
 static const DataKind   kTermNonEmptyMessageValue{nImO::DataKind::EndOfMessageValue | nImO::DataKind::OtherMessageNonEmptyValue};
 
+/*! @brief The released transmission buffers that are available for reuse. */
+struct TransmissionBufferPool
+{
+    /*! @brief Mutual-exclusion protection. */
+    std::mutex  _lock{};
+
+    /*! @brief The available buffers. */
+    std::vector<Ptr(std::string)>   _buffers{};
+
+}; // TransmissionBufferPool
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -109,6 +121,41 @@ const std::string   nImO::kMessageSentinel{kMiMeMessageTerminator};
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Return the pool of released transmission buffers.
+ The pool is never destroyed, so that buffers released during program termination can still be returned to it.
+ @return The pool of released transmission buffers. */
+static TransmissionBufferPool &
+getTransmissionBufferPool
+    (void)
+{
+    static auto pool{new TransmissionBufferPool};
+
+    return *pool;
+} // getTransmissionBufferPool
+
+/*! @brief Return a transmission buffer to the pool, or free it if the pool is full or the buffer is too large.
+ @param[in] buffer The buffer being released. */
+static void
+releaseTransmissionBuffer
+    (Ptr(std::string)   buffer)
+{
+    ODL_ENTER(); //####
+    ODL_P1(buffer); //####
+    if (nImO::kTransmissionBufferMaximumCapacity >= buffer->capacity())
+    {
+        auto &                      pool{getTransmissionBufferPool()};
+        std::lock_guard<std::mutex> guard{pool._lock};
+
+        if (nImO::kTransmissionBufferPoolSize > pool._buffers.size())
+        {
+            pool._buffers.push_back(buffer);
+            buffer = nullptr;
+        }
+    }
+    delete buffer;
+    ODL_EXIT(); //####
+} // releaseTransmissionBuffer
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -131,7 +178,8 @@ nImO::Message::Message
     (Message && other)
     noexcept :
         inherited{std::move(other)}, _lock{}, _cachedTransmissionString{std::move(other._cachedTransmissionString)},
-        _readPosition{other._readPosition}, _state{other._state}, _headerAdded{other._headerAdded}
+        _keyDictionary{std::move(other._keyDictionary)}, _readPosition{other._readPosition}, _state{other._state},
+        _headerAdded{other._headerAdded}, _singlePrecision{other._singlePrecision}
 {
     ODL_ENTER(); //####
     ODL_P1(&other); //####
@@ -196,6 +244,34 @@ nImO::Message::close
     return *this;
 } // nImO::Message::close
 
+bool
+nImO::Message::copyBytesTo
+    (std::string &  outString)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(&outString); //####
+    bool    okSoFar{false};
+
+    if (MessageState::Closed == _state)
+    {
+        ODL_LOG("(MessageState::Closed == _state)"); //####
+        std::lock_guard<std::mutex> guard{_lock};
+        size_t                      position{0};
+        size_t                      numBytes;
+
+        outString.reserve(outString.length() + inherited::getLength());
+        for (auto data{getContiguousBytes(position, numBytes)}; nullptr != data; data = getContiguousBytes(position, numBytes))
+        {
+            outString.append(ReinterpretCast(CPtr(char), data), numBytes);
+            position += numBytes;
+        }
+        okSoFar = true;
+        ODL_B1(okSoFar); //####
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::Message::copyBytesTo
+
 size_t
 nImO::Message::getLength
     (void)
@@ -420,6 +496,8 @@ nImO::Message::operator=
         _readPosition = other._readPosition;
         _state = other._state;
         _headerAdded = other._headerAdded;
+        _singlePrecision = other._singlePrecision;
+        _keyDictionary = std::move(other._keyDictionary);
         other._readPosition = 0;
         other._state = MessageState::Unknown;
         other._headerAdded = false;
@@ -446,6 +524,32 @@ nImO::Message::reset
     return *this;
 } // nImO::Message::reset
 
+nImO::Message &
+nImO::Message::setEncodedValue
+    (CPtr(uint8_t)  data,
+     const size_t   numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(data); //####
+    ODL_I1(numBytes); //####
+    reset();
+    if ((MessageState::OpenForWriting == _state) && (nullptr != data) && (0 < numBytes))
+    {
+        ODL_LOG("((MessageState::OpenForWriting == _state) && (nullptr != data) && (0 < numBytes))"); //####
+        std::lock_guard<std::mutex> guard{_lock};
+
+        appendBytes(data, numBytes);
+        _headerAdded = true;
+        ODL_B1(_headerAdded); //####
+    }
+    else
+    {
+        ODL_LOG("! ((MessageState::OpenForWriting == _state) && (nullptr != data) && (0 < numBytes))"); //####
+    }
+    ODL_OBJEXIT_P(this); //####
+    return *this;
+} // nImO::Message::setEncodedValue
+
 nImO::Message &
 nImO::Message::setValue
     (SpValue    theValue)
@@ -479,23 +583,124 @@ nImO::Message::setValue
 # pragma mark Global functions
 #endif // defined(__APPLE__)
 
+uint32_t
+nImO::ComputeFrameChecksum
+    (CPtr(uint8_t)  data,
+     const size_t   numBytes)
+{
+    // This is Adler-32; the sums are reduced only as often as is needed to avoid overflow.
+    const uint32_t  kModulus{65521};
+    const size_t    kLongestRun{5552};
+    uint32_t        lowSum{1};
+    uint32_t        highSum{0};
+
+    for (size_t ii = 0; ii < numBytes; )
+    {
+        size_t  runEnd{std::min(numBytes, ii + kLongestRun)};
+
+        for ( ; ii < runEnd; ++ii)
+        {
+            lowSum += data[ii];
+            highSum += lowSum;
+        }
+        lowSum %= kModulus;
+        highSum %= kModulus;
+    }
+    return ((highSum << 16) | lowSum);
+} // nImO::ComputeFrameChecksum
+
+bool
+nImO::FillInFrameHeader
+    (std::string &  buffer,
+     const bool     addChecksum)
+{
+    ODL_ENTER(); //####
+    ODL_P1(&buffer); //####
+    ODL_B1(addChecksum); //####
+    bool    okSoFar{false};
+    size_t  bodyStart{FrameHeaderLength(addChecksum)};
+
+    // The receiver rejects a header with a larger length and cannot find the next frame after it.
+    if ((bodyStart <= buffer.length()) && (kFrameMaximumLength >= (buffer.length() - bodyStart)))
+    {
+        size_t          length{buffer.length() - bodyStart};
+        Ptr(uint8_t)    header{ReinterpretCast(Ptr(uint8_t), &buffer[0])};
+
+        header[0] = kFrameMarker;
+        header[1] = (addChecksum ? kFrameChecksumFlag : 0);
+        for (size_t ii = 2, shift = 24; ii < kFrameHeaderSize; ++ii, shift -= 8)
+        {
+            header[ii] = StaticCast(uint8_t, (length >> shift) & 0x00FF);
+        }
+        if (addChecksum)
+        {
+            auto    checksum{ComputeFrameChecksum(header + bodyStart, length)};
+
+            for (size_t ii = kFrameHeaderSize, shift = 24; ii < bodyStart; ++ii, shift -= 8)
+            {
+                header[ii] = StaticCast(uint8_t, (checksum >> shift) & 0x00FF);
+            }
+        }
+        okSoFar = true;
+        ODL_B1(okSoFar); //####
+    }
+    else
+    {
+        ODL_LOG("! ((bodyStart <= buffer.length()) && (kFrameMaximumLength >= (buffer.length() - bodyStart)))"); //####
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::FillInFrameHeader
+
+nImO::SpStdString
+nImO::GetTransmissionBuffer
+    (const size_t   capacity)
+{
+    ODL_ENTER(); //####
+    ODL_I1(capacity); //####
+    Ptr(std::string)    buffer{nullptr};
+
+    {
+        auto &                      pool{getTransmissionBufferPool()};
+        std::lock_guard<std::mutex> guard{pool._lock};
+
+        if (! pool._buffers.empty())
+        {
+            buffer = pool._buffers.back();
+            pool._buffers.pop_back();
+        }
+    }
+    if (nullptr == buffer)
+    {
+        buffer = new std::string;
+    }
+    else
+    {
+        buffer->clear();
+    }
+    buffer->reserve(capacity);
+    SpStdString result{buffer, releaseTransmissionBuffer};
+
+    ODL_EXIT_P(result.get()); //####
+    return result;
+} // nImO::GetTransmissionBuffer
+
 std::pair<BufferIterator, bool>
 nImO::MatchMessageSeparator
     (BufferIterator begin,
      BufferIterator end)
 {
-    auto    ii{begin};
+    auto    sentinelLength{StaticCast(std::ptrdiff_t, kMessageSentinel.length())};
+    auto    found{std::search(begin, end, kMessageSentinel.begin(), kMessageSentinel.end())};
 
-    for ( ; ii != end; )
+    if (found == end)
     {
-        std::string checker{ii++, end};
+        // Resume the next scan where a partial sentinel could start, so that no byte is examined repeatedly.
+        auto    unexamined{std::max(StaticCast(std::ptrdiff_t, 0), (end - begin) - (sentinelLength - 1))};
 
-        if (kMiMeMessageTerminator == checker)
-        {
-            return std::make_pair(ii, true);
-        }
+        return std::make_pair(begin + unexamined, false);
     }
-    return std::make_pair(ii, false);
+    return std::make_pair(found + sentinelLength, true);
 } // nImO::MatchMessageSeparator
 
 nImO::SpStdString
@@ -505,9 +710,175 @@ nImO::PackageMessage
     return std::make_shared<std::string>(boost::algorithm::join(outVec, "\n"s) + "\n"s + kMessageSentinel);
 } // nImO::PackageMessage
 
+nImO::SpStdString
+nImO::PackageMessage
+    (CPtr(uint8_t)  messageBytes,
+     const size_t   numBytes,
+     const bool     addSentinel)
+{
+    ODL_ENTER(); //####
+    ODL_P1(messageBytes); //####
+    ODL_I1(numBytes); //####
+    ODL_B1(addSentinel); //####
+    size_t  encodedLength{MIMEEncodedLength(numBytes)};
+    size_t  totalLength{encodedLength + (addSentinel ? (1 + kMessageSentinel.length()) : 0)};
+    auto    result{GetTransmissionBuffer(totalLength)};
+
+    result->resize(totalLength);
+    EncodeBytesAsMIME(&(*result)[0], messageBytes, numBytes);
+    if (addSentinel)
+    {
+        (*result)[encodedLength] = '\n';
+        result->replace(encodedLength + 1, kMessageSentinel.length(), kMessageSentinel);
+    }
+    ODL_EXIT_P(result.get()); //####
+    return result;
+} // nImO::PackageMessage
+
+nImO::SpStdString
+nImO::PackageMessageAsFrame
+    (const std::string &    messageBytes,
+     const bool             addChecksum)
+{
+    ODL_ENTER(); //####
+    ODL_B1(addChecksum); //####
+    size_t  bodyStart{FrameHeaderLength(addChecksum)};
+    auto    result{GetTransmissionBuffer(bodyStart + messageBytes.length())};
+
+    result->resize(bodyStart);
+    result->append(messageBytes);
+    if (! FillInFrameHeader(*result, addChecksum))
+    {
+        ODL_LOG("(! FillInFrameHeader(*result, addChecksum))"); //####
+        result.reset();
+    }
+    ODL_EXIT_P(result.get()); //####
+    return result;
+} // nImO::PackageMessageAsFrame
+
+bool
+nImO::UnpackageFrame
+    (CPtr(uint8_t)      data,
+     const size_t       numBytes,
+     CPtr(uint8_t) &    body,
+     size_t &           bodyLength)
+{
+    ODL_ENTER(); //####
+    ODL_P1(data); //####
+    ODL_I1(numBytes); //####
+    bool    okSoFar{false};
+    size_t  remainingLength;
+
+    body = nullptr;
+    bodyLength = 0;
+    if ((kFrameHeaderSize <= numBytes) && UnpackageFrameHeader(data, remainingLength))
+    {
+        if ((kFrameHeaderSize + remainingLength) == numBytes)
+        {
+            CPtr(uint8_t)   walker{data + kFrameHeaderSize};
+
+            if (0 == (data[1] & kFrameChecksumFlag))
+            {
+                okSoFar = true;
+                ODL_B1(okSoFar); //####
+            }
+            else
+            {
+                uint32_t    expected{0};
+
+                for (size_t ii = 0; ii < kFrameChecksumSize; ++ii)
+                {
+                    expected = ((expected << 8) | *walker++);
+                }
+                remainingLength -= kFrameChecksumSize;
+                okSoFar = (ComputeFrameChecksum(walker, remainingLength) == expected);
+                ODL_B1(okSoFar); //####
+            }
+            if (okSoFar)
+            {
+                body = walker;
+                bodyLength = remainingLength;
+            }
+        }
+        else
+        {
+            ODL_LOG("! ((kFrameHeaderSize + remainingLength) == numBytes)"); //####
+        }
+    }
+    else
+    {
+        ODL_LOG("! ((kFrameHeaderSize <= numBytes) && UnpackageFrameHeader(data, remainingLength))"); //####
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::UnpackageFrame
+
+bool
+nImO::UnpackageFrameHeader
+    (CPtr(uint8_t)  header,
+     size_t &       remainingLength)
+{
+    ODL_ENTER(); //####
+    ODL_P1(header); //####
+    bool    okSoFar{false};
+
+    remainingLength = 0;
+    if ((kFrameMarker == header[0]) && (0 == (header[1] & ~kFrameChecksumFlag)))
+    {
+        size_t  length{0};
+
+        for (size_t ii = 2; ii < kFrameHeaderSize; ++ii)
+        {
+            length = ((length << 8) | header[ii]);
+        }
+        if (kFrameMaximumLength >= length)
+        {
+            remainingLength = length + ((0 == (header[1] & kFrameChecksumFlag)) ? 0 : kFrameChecksumSize);
+            okSoFar = true;
+            ODL_B1(okSoFar); //####
+        }
+        else
+        {
+            ODL_LOG("! (kFrameMaximumLength >= length)"); //####
+        }
+    }
+    else
+    {
+        ODL_LOG("! ((kFrameMarker == header[0]) && (0 == (header[1] & ~kFrameChecksumFlag)))"); //####
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::UnpackageFrameHeader
+
 std::string
 nImO::UnpackageMessage
     (const std::string &    inString)
 {
     return inString.substr(0, inString.length() - (kMessageSentinel.length() + 1));
 } // nImO::UnpackageMessage
+
+bool
+nImO::UnpackageMessage
+    (CPtr(char)     inChars,
+     const size_t   numChars,
+     ByteVector &   outBytes)
+{
+    ODL_ENTER(); //####
+    ODL_P2(inChars, &outBytes); //####
+    ODL_I1(numChars); //####
+    bool    okSoFar{false};
+    size_t  sentinelLength{kMessageSentinel.length() + 1};
+
+    if (sentinelLength <= numChars)
+    {
+        okSoFar = DecodeMIMEToBytes(inChars, numChars - sentinelLength, outBytes);
+        ODL_B1(okSoFar); //####
+    }
+    else
+    {
+        ODL_LOG("! (sentinelLength <= numChars)"); //####
+        outBytes.clear();
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::UnpackageMessage
@@ -121,6 +121,13 @@ namespace nImO
             close
                 (void);
 
+            /*! @brief Append the bytes of a closed Message to a string, copying them directly from the chunks of the buffer.
+             @param[in,out] outString The string to be added to.
+             @return @c true if the Message is closed and its bytes were added. */
+            bool
+            copyBytesTo
+                (std::string &  outString);
+
             /*! @brief Return the number of valid bytes in the buffer.
             @return The number of valid bytes in the buffer. */
             size_t
@@ -136,6 +143,16 @@ namespace nImO
                 (void)
                 override;
 
+            /*! @brief Return the dictionary used for Map keys.
+             @return The dictionary used for Map keys or @c nullptr if keys are always sent in full. */
+            inline SpKeyDictionary
+            getKeyDictionary
+                (void)
+                const
+            {
+                return _keyDictionary;
+            }
+
             /*! @brief Return the next Value in the Message.
             @param[in] allowClosed @c true if the state can be closed @c false if the Message must be
             opened for reading
@@ -145,6 +162,16 @@ namespace nImO
             getValue
                 (const bool allowClosed = false);
 
+            /*! @brief Return @c true if the Message is open for writing.
+            @return @c true if the Message is open for writing. */
+            inline bool
+            isOpenForWriting
+                (void)
+                const
+            {
+                return (MessageState::OpenForWriting == _state);
+            }
+
             /*! @brief Open the Message, so that data can be read or written.
             @param[in] forWriting @c true if the Message is being written to and @c false if it's being
             read.
@@ -185,6 +212,36 @@ namespace nImO
                 (void)
                 override;
 
+            /*! @brief Set the contents of the Message from an already-encoded Value.
+            @param[in] data The encoded Value, including the Message header and trailer bytes.
+            @param[in] numBytes The number of bytes in the encoded Value.
+            @return The Message object so that cascading can be done. */
+            Message &
+            setEncodedValue
+                (CPtr(uint8_t)  data,
+                 const size_t   numBytes);
+
+            /*! @brief Set the dictionary used for Map keys.
+            Note that this setting is kept when the Message is reset or reopened.
+            @param[in] keyDictionary The dictionary for the connection that the Message is sent or received on,
+            or @c nullptr if keys are always sent in full. */
+            inline void
+            setKeyDictionary
+                (SpKeyDictionary    keyDictionary)
+            {
+                _keyDictionary = keyDictionary;
+            }
+
+            /*! @brief Set whether floating-point values are written as single-precision values.
+            Note that this setting is kept when the Message is reset or reopened.
+            @param[in] singlePrecision @c true if floating-point values are to be written as single-precision values. */
+            inline void
+            setSinglePrecision
+                (const bool singlePrecision)
+            {
+                _singlePrecision = singlePrecision;
+            }
+
             /*! @brief Set the contents of the Message.
             @param[in] theValue The value to be put in the Message.
             @return The Message object so that cascading can be done. */
@@ -192,6 +249,16 @@ namespace nImO
             setValue
                 (SpValue    theValue);
 
+            /*! @brief Return @c true if floating-point values are written as single-precision values.
+            @return @c true if floating-point values are written as single-precision values. */
+            inline bool
+            usesSinglePrecision
+                (void)
+                const
+            {
+                return _singlePrecision;
+            }
+
         protected :
             // Protected methods.
 
@@ -213,6 +280,9 @@ namespace nImO
             /*! @brief The cached value of the buffer for transmission. */
             std::string _cachedTransmissionString{};
 
+            /*! @brief The dictionary used for Map keys. */
+            SpKeyDictionary _keyDictionary{};
+
             /*! @brief The position of the next byte being read. */
             size_t  _readPosition{0};
 
@@ -222,12 +292,56 @@ namespace nImO
             /*! @brief @c true if the initial header bytes are present in the buffer. */
             bool    _headerAdded{false};
 
+            /*! @brief @c true if floating-point values are written as single-precision values. */
+            bool    _singlePrecision{false};
+
     }; // Message
 
-    /*! @brief Scan the received characters and indicate then the Message sentinel has appeared.
+    /*! @brief Compute the checksum that can be attached to a binary-framed Message.
+     @param[in] data The bytes to be checked.
+     @param[in] numBytes The number of bytes to be checked.
+     @return The Adler-32 checksum of the bytes. */
+    uint32_t
+    ComputeFrameChecksum
+        (CPtr(uint8_t)  data,
+         const size_t   numBytes);
+
+    /*! @brief Fill in the header of a binary frame whose Message bytes are already in place.
+     The Message bytes must start FrameHeaderLength(addChecksum) bytes into the buffer and run to its end,
+     so that a Message can be framed without being copied again.
+     @param[in,out] buffer The buffer holding room for the header followed by the Message bytes.
+     @param[in] addChecksum @c true if a checksum of the Message bytes is to be included.
+     @return @c false if the Message is longer than kFrameMaximumLength. */
+    bool
+    FillInFrameHeader
+        (std::string &  buffer,
+         const bool     addChecksum = false);
+
+    /*! @brief Return the number of bytes that precede the Message bytes in a binary frame.
+     @param[in] addChecksum @c true if the frame includes a checksum.
+     @return The number of bytes in the header and the optional checksum. */
+    inline size_t
+    FrameHeaderLength
+        (const bool addChecksum)
+    {
+        return (kFrameHeaderSize + (addChecksum ? kFrameChecksumSize : 0));
+    }
+
+    /*! @brief Return an empty buffer for an outgoing transmission, taken from a pool of released buffers.
+     The buffer is returned to the pool when the last reference to it is released.
+     @param[in] capacity The number of characters that the buffer will need to hold.
+     @return An empty buffer with at least the requested capacity. */
+    SpStdString
+    GetTransmissionBuffer
+        (const size_t   capacity);
+
+    /*! @brief Scan the received characters and indicate when the Message sentinel has appeared.
+     The scan is linear in the number of characters; when the sentinel is not found, the returned position is
+     where a partial sentinel could start, so that the next scan does not re-examine earlier characters.
      @param[in] begin Where in the buffer to start scanning.
      @param[in] end Where in the buffer to stop scanning.
-     @return The position past the Message sentinel and @c true if the Message sentinel was found or the position where scanning stopped and @c false. */
+     @return The position past the first Message sentinel and @c true if the Message sentinel was found or the
+     position where the next scan should start and @c false. */
     std::pair<BufferIterator, bool>
     MatchMessageSeparator
         (BufferIterator begin,
@@ -240,6 +354,64 @@ namespace nImO
     PackageMessage
         (StdStringVector &  outVec);
 
+    /*! @brief MIME-encode the bytes of a Message into a single buffer, optionally followed by the message sentinel.
+     The result is the same as encoding the bytes with EncodeBytesAsMIME and then joining the lines with
+     newlines, but the lines are written directly into a pre-sized buffer taken from the transmission buffer pool.
+     @param[in] messageBytes The bytes of the Message.
+     @param[in] numBytes The number of bytes in the Message.
+     @param[in] addSentinel @c true if the message sentinel is to be appended, as for stream connections.
+     @return The encoded Message. */
+    SpStdString
+    PackageMessage
+        (CPtr(uint8_t)  messageBytes,
+         const size_t   numBytes,
+         const bool     addSentinel = true);
+
+    /*! @brief MIME-encode the bytes of a Message into a single buffer, optionally followed by the message sentinel.
+     @param[in] messageBytes The bytes of the Message.
+     @param[in] addSentinel @c true if the message sentinel is to be appended, as for stream connections.
+     @return The encoded Message. */
+    inline SpStdString
+    PackageMessage
+        (const std::string &    messageBytes,
+         const bool             addSentinel = true)
+    {
+        return PackageMessage(ReinterpretCast(CPtr(uint8_t), messageBytes.data()), messageBytes.length(), addSentinel);
+    }
+
+    /*! @brief Wrap the bytes of a Message in a binary frame.
+     The frame consists of a marker byte, a flags byte, the length of the Message as four big-endian
+     bytes, an optional four-byte checksum and then the unencoded Message bytes.
+     @param[in] messageBytes The bytes of the Message.
+     @param[in] addChecksum @c true if a checksum of the Message bytes is to be included.
+     @return The framed Message or @c nullptr if the Message is longer than kFrameMaximumLength. */
+    SpStdString
+    PackageMessageAsFrame
+        (const std::string &    messageBytes,
+         const bool             addChecksum = false);
+
+    /*! @brief Locate the Message bytes in a complete binary frame, verifying the checksum if there is one.
+     @param[in] data The binary frame.
+     @param[in] numBytes The number of bytes in the binary frame.
+     @param[out] body Set to the start of the Message bytes within the frame.
+     @param[out] bodyLength Set to the number of Message bytes.
+     @return @c true if the frame is well-formed and its checksum, if present, matches. */
+    bool
+    UnpackageFrame
+        (CPtr(uint8_t)      data,
+         const size_t       numBytes,
+         CPtr(uint8_t) &    body,
+         size_t &           bodyLength);
+
+    /*! @brief Check the header of a binary frame and determine how many bytes follow it.
+     @param[in] header The first kFrameHeaderSize bytes of the binary frame.
+     @param[out] remainingLength Set to the number of bytes, including any checksum, that follow the header.
+     @return @c true if the header is well-formed. */
+    bool
+    UnpackageFrameHeader
+        (CPtr(uint8_t)  header,
+         size_t &       remainingLength);
+
     /*! @brief Remove the message sentinel from encoded data.
      @param[in] inString The data with the attached sentinel.
      @return The data with the sentinel removed. */
@@ -247,6 +419,17 @@ namespace nImO
     UnpackageMessage
         (const std::string &    inString);
 
+    /*! @brief Decode a received Message, ignoring its message sentinel, without copying the encoded data.
+     @param[in] inChars The encoded data with the attached sentinel, such as the contents of a receive buffer.
+     @param[in] numChars The number of characters in the encoded data, including the sentinel.
+     @param[out] outBytes The bytes of the Message; its storage is reused if it is large enough.
+     @return @c true if the encoded data could be decoded. */
+    bool
+    UnpackageMessage
+        (CPtr(char)     inChars,
+         const size_t   numChars,
+         ByteVector &   outBytes);
+
 } // nImO
 
 #endif // not defined(nImOmessage_H_)
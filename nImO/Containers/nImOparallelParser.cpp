@@ -0,0 +1,290 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOparallelParser.cpp
+//
+//  Project:    nImO
+//
+//  Contains:   The function definitions for parsing text with several threads.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+#include <Containers/nImOparallelParser.h>
+
+#include <Containers/nImOincrementalParser.h>
+
+#include <atomic>
+#include <boost/thread.hpp>
+#include <cstring>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The function definitions for parsing text with several threads. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace nImO;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief A piece of the text being parsed. */
+struct ParseSegment final
+{
+    /*! @brief The first character of the piece. */
+    CPtr(char)  _start{nullptr};
+
+    /*! @brief The number of characters in the piece. */
+    size_t  _length{0};
+
+    /*! @brief The number of lines in the piece. */
+    size_t  _numLines{0};
+
+    /*! @brief The Values found in the piece, with line numbers relative to the start of the piece. */
+    ParsedValueVector   _values{};
+
+    /*! @brief @c true if the piece did not end partway through a Value. */
+    bool    _endedCleanly{true};
+
+    /*! @brief The constructor.
+     @param[in] start The first character of the piece.
+     @param[in] length The number of characters in the piece. */
+    inline ParseSegment
+        (CPtr(char)     start,
+         const size_t   length) :
+            _start{start}, _length{length}
+    {
+    }
+
+}; // ParseSegment
+
+/*! @brief The number of pieces to make for each thread, so that the threads finish at similar times. */
+static const size_t kSegmentsPerThread{4};
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Find the first comment line that starts after a position in the text.
+ @param[in] text The text to be searched.
+ @param[in] length The number of characters in the text.
+ @param[in] position Where to start searching.
+ @return The position of the start of the comment line or @c length if there is none. */
+static size_t
+findSplitPoint
+    (CPtr(char)     text,
+     const size_t   length,
+     const size_t   position)
+{
+    ODL_ENTER(); //####
+    ODL_P1(text); //####
+    ODL_I2(length, position); //####
+    size_t  result{length};
+
+    for (size_t walker = position; walker < length; )
+    {
+        auto    endOfLine{StaticCast(CPtr(char), memchr(text + walker, kEndOfLine, length - walker))};
+
+        if (nullptr == endOfLine)
+        {
+            ODL_LOG("(nullptr == endOfLine)"); //####
+            break;
+
+        }
+        walker = StaticCast(size_t, endOfLine - text) + 1;
+        if ((walker < length) && (kCommentChar == text[walker]))
+        {
+            ODL_LOG("((walker < length) && (kCommentChar == text[walker]))"); //####
+            result = walker;
+            break;
+
+        }
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // findSplitPoint
+
+/*! @brief Parse a piece of the text.
+ @param[in,out] aSegment The piece to be parsed. */
+static void
+parseSegment
+    (ParseSegment & aSegment)
+{
+    ODL_ENTER(); //####
+    ODL_P1(&aSegment); //####
+    IncrementalParser   parser;
+    CPtr(char)          walker{aSegment._start};
+    CPtr(char)          pastEnd{aSegment._start + aSegment._length};
+
+    aSegment._numLines = 0;
+    aSegment._values.clear();
+    for ( ; walker < pastEnd; )
+    {
+        auto    endOfLine{StaticCast(CPtr(char), memchr(walker, kEndOfLine, StaticCast(size_t, pastEnd - walker)))};
+        auto    lineEnd{(nullptr == endOfLine) ? pastEnd : endOfLine};
+
+        parser.addLine(walker, StaticCast(size_t, lineEnd - walker));
+        ++aSegment._numLines;
+        for (auto readValue{parser.getNextValue()}; readValue; readValue = parser.getNextValue())
+        {
+            aSegment._values.emplace_back(readValue, aSegment._numLines);
+        }
+        walker = lineEnd + 1;
+    }
+    aSegment._endedCleanly = (! parser.hasPartialValue());
+    ODL_EXIT(); //####
+} // parseSegment
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+nImO::ParsedValueVector
+nImO::ParseValuesInParallel
+    (CPtr(char)     text,
+     const size_t   length,
+     const size_t   numThreads,
+     const size_t   minimumSegment)
+{
+    ODL_ENTER(); //####
+    ODL_P1(text); //####
+    ODL_I3(length, numThreads, minimumSegment); //####
+    ParsedValueVector           result;
+    std::vector<ParseSegment>   segments;
+    size_t                      threadCount{numThreads};
+    size_t                      start{0};
+
+    if (0 == threadCount)
+    {
+        ODL_LOG("(0 == threadCount)"); //####
+        threadCount = std::max(StaticCast(size_t, boost::thread::hardware_concurrency()), StaticCast(size_t, 1));
+    }
+    size_t  numPieces{std::min(threadCount * kSegmentsPerThread, length / std::max(minimumSegment, StaticCast(size_t, 1)))};
+
+    ODL_I2(threadCount, numPieces); //####
+    // Split the text into pieces of about the same size, at the starts of comment lines.
+    for (size_t ii = 1; ii < numPieces; ++ii)
+    {
+        size_t  splitPoint{findSplitPoint(text, length, std::max(start + 1, (length / numPieces) * ii))};
+
+        if (splitPoint >= length)
+        {
+            ODL_LOG("(splitPoint >= length)"); //####
+            break;
+
+        }
+        segments.emplace_back(text + start, splitPoint - start);
+        start = splitPoint;
+    }
+    segments.emplace_back(text + start, length - start);
+    ODL_I1(segments.size()); //####
+    if ((1 < segments.size()) && (1 < threadCount))
+    {
+        ODL_LOG("((1 < segments.size()) && (1 < threadCount))"); //####
+        std::atomic<size_t> nextSegment{0};
+        boost::thread_group workers;
+
+        for (size_t ii = 0, nn = std::min(threadCount, segments.size()); nn > ii; ++ii)
+        {
+            workers.create_thread([&segments, &nextSegment]
+                                  (void)
+                                  {
+                                      for (size_t which = nextSegment++; which < segments.size(); which = nextSegment++)
+                                      {
+                                          parseSegment(segments[which]);
+                                      }
+                                  });
+        }
+        workers.join_all();
+    }
+    else
+    {
+        ODL_LOG("! ((1 < segments.size()) && (1 < threadCount))"); //####
+        for (auto & aSegment : segments)
+        {
+            parseSegment(aSegment);
+        }
+    }
+    // A piece that ends partway through a Value means that the comment line was inside the Value, so
+    // the rest of the text must be parsed in sequence.
+    for (size_t ii = 0, nn = segments.size() - 1; nn > ii; ++ii)
+    {
+        if (! segments[ii]._endedCleanly)
+        {
+            ODL_LOG("(! segments[ii]._endedCleanly)"); //####
+            ODL_I1(ii); //####
+            segments[ii]._length = StaticCast(size_t, (text + length) - segments[ii]._start);
+            segments.erase(segments.begin() + ii + 1, segments.end());
+            parseSegment(segments[ii]);
+            break;
+
+        }
+    }
+    size_t  lineBase{0};
+
+    for (auto & aSegment : segments)
+    {
+        for (auto & aValue : aSegment._values)
+        {
+            result.emplace_back(aValue._value, aValue._lineNumber + lineBase);
+        }
+        lineBase += aSegment._numLines;
+    }
+    ODL_EXIT_I(result.size()); //####
+    return result;
+} // nImO::ParseValuesInParallel
@@ -0,0 +1,100 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOparallelParser.h
+//
+//  Project:    nImO
+//
+//  Contains:   The function declarations for parsing text with several threads.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+#if (! defined(nImOparallelParser_H_))
+# define nImOparallelParser_H_ /* Header guard */
+
+# include <nImOcommon.h>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The function declarations for parsing text with several threads. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace nImO
+{
+    /*! @brief A Value that was parsed from a sequence of lines. */
+    struct ParsedValue final
+    {
+        /*! @brief The Value, or an Invalid if the text could not be parsed. */
+        SpValue _value{};
+
+        /*! @brief The one-based number of the line where the text of the Value ended. */
+        size_t  _lineNumber{0};
+
+        /*! @brief The constructor.
+         @param[in] aValue The Value.
+         @param[in] lineNumber The line where the text of the Value ended. */
+        inline ParsedValue
+            (SpValue        aValue,
+             const size_t   lineNumber) :
+                _value{aValue}, _lineNumber{lineNumber}
+        {
+        }
+
+    }; // ParsedValue
+
+    /*! @brief A sequence of parsed Values. */
+    using ParsedValueVector = std::vector<ParsedValue>;
+
+    /*! @brief Parse text holding a sequence of Values, such as a recording, using several threads.
+
+     The text is split at comment lines, such as the separators written between Values by Record,
+     the pieces are parsed at the same time and the Values are returned in the order of the text.
+     If a piece turns out to end partway through a Value, the text from that piece onwards is
+     parsed again in sequence, so the result is always the same as parsing the text in one pass.
+     @param[in] text The text to be parsed.
+     @param[in] length The number of characters in the text.
+     @param[in] numThreads The number of threads to use, or @c 0 to use one per processor.
+     @param[in] minimumSegment The smallest amount of text to give to a thread.
+     @return The Values, in the order that they appear in the text. */
+    ParsedValueVector
+    ParseValuesInParallel
+        (CPtr(char)     text,
+         const size_t   length,
+         const size_t   numThreads = 0,
+         const size_t   minimumSegment = kParallelParseMinimumSegment);
+
+} // nImO
+
+#endif // not defined(nImOparallelParser_H_)
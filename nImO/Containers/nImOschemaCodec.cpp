@@ -0,0 +1,555 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOschemaCodec.cpp
+//
+//  Project:    nImO
+//
+//  Contains:   The class definition for schema-compiled Message codecs.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include <Containers/nImOschemaCodec.h>
+
+#include <BasicTypes/nImOdouble.h>
+#include <BasicTypes/nImOinteger.h>
+#include <BasicTypes/nImOstring.h>
+#include <Containers/nImOarray.h>
+#include <Containers/nImOmap.h>
+#include <Containers/nImOstringBuffer.h>
+
+#include <algorithm>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for schema-compiled Message codecs. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace nImO;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+nImO::SchemaCodec::CodecMap nImO::SchemaCodec::gCodecs;
+
+std::mutex  nImO::SchemaCodec::gCodecsLock;
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Copy bytes from a Message, a chunk at a time.
+ @param[in] aMessage The Message of interest.
+ @param[in] position The position of the first byte to be copied.
+ @param[out] destination Where to place the bytes.
+ @param[in] numBytes The number of bytes to be copied.
+ @return @c true if the bytes were present and @c false otherwise. */
+static bool
+copyBytes
+    (const Message &    aMessage,
+     size_t             position,
+     Ptr(uint8_t)       destination,
+     size_t             numBytes)
+{
+    ODL_ENTER(); //####
+    ODL_P2(&aMessage, destination); //####
+    ODL_I2(position, numBytes); //####
+    bool    okSoFar{true};
+
+    while (okSoFar && (0 < numBytes))
+    {
+        size_t          available{0};
+        CPtr(uint8_t)   source{aMessage.getContiguousBytes(position, available)};
+
+        if ((nullptr == source) || (0 == available))
+        {
+            ODL_LOG("((nullptr == source) || (0 == available))"); //####
+            okSoFar = false;
+        }
+        else
+        {
+            ODL_LOG("! ((nullptr == source) || (0 == available))"); //####
+            size_t  toCopy{std::min(available, numBytes)};
+
+            memcpy(destination, source, toCopy);
+            destination += toCopy;
+            position += toCopy;
+            numBytes -= toCopy;
+        }
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // copyBytes
+
+/*! @brief Return the number of bytes written to a Message that is still open.
+ @param[in] aMessage The Message of interest.
+ @return The number of bytes written to the Message. */
+static size_t
+currentLength
+    (const Message &    aMessage)
+{
+    ODL_ENTER(); //####
+    ODL_P1(&aMessage); //####
+    // Message::getLength() reports zero until the Message is closed, so ask the underlying buffer.
+    size_t  result{aMessage.ChunkArray::getLength()};
+
+    ODL_EXIT_I(result); //####
+    return result;
+} // currentLength
+
+/*! @brief Return a readable form of a Map key, for use in field names.
+ @param[in] aKey The key of interest.
+ @return A readable form of the key. */
+static std::string
+keyName
+    (const Value &  aKey)
+{
+    ODL_ENTER(); //####
+    ODL_P1(&aKey); //####
+    std::string result;
+    auto        asString{aKey.asString()};
+
+    if (nullptr == asString)
+    {
+        ODL_LOG("(nullptr == asString)"); //####
+        StringBuffer    buff;
+
+        aKey.printToStringBuffer(buff, true);
+        result = buff.getString();
+    }
+    else
+    {
+        ODL_LOG("! (nullptr == asString)"); //####
+        result = asString->getValue();
+    }
+    ODL_EXIT_s(result); //####
+    return result;
+} // keyName
+
+/*! @brief Return @c true if a range of bytes in a Message matches the expected bytes.
+ The Message is compared a chunk at a time, so that the bytes are not copied.
+ @param[in] aMessage The Message of interest.
+ @param[in] position The position of the first byte to be compared.
+ @param[in] expected The expected bytes.
+ @param[in] numBytes The number of bytes to be compared.
+ @return @c true if the bytes match and @c false otherwise. */
+static bool
+matchBytes
+    (const Message &    aMessage,
+     size_t             position,
+     CPtr(uint8_t)      expected,
+     size_t             numBytes)
+{
+    ODL_ENTER(); //####
+    ODL_P2(&aMessage, expected); //####
+    ODL_I2(position, numBytes); //####
+    bool    okSoFar{true};
+
+    while (okSoFar && (0 < numBytes))
+    {
+        size_t          available{0};
+        CPtr(uint8_t)   received{aMessage.getContiguousBytes(position, available)};
+
+        if ((nullptr == received) || (0 == available))
+        {
+            ODL_LOG("((nullptr == received) || (0 == available))"); //####
+            okSoFar = false;
+        }
+        else
+        {
+            ODL_LOG("! ((nullptr == received) || (0 == available))"); //####
+            size_t  toCompare{std::min(available, numBytes)};
+
+            okSoFar = (0 == memcmp(received, expected, toCompare));
+            expected += toCompare;
+            position += toCompare;
+            numBytes -= toCompare;
+        }
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // matchBytes
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+nImO::SchemaCodec::SchemaCodec
+    (SpValue    schema)
+{
+    ODL_ENTER(); //####
+    ODL_P1(schema.get()); //####
+    if (schema && (! schema->asFlaw()))
+    {
+        ODL_LOG("(schema && (! schema->asFlaw()))"); //####
+        Message     scratch;
+        DataKind    typeTag{schema->getTypeTag()};
+        DataKind    headerByte{DataKind::StartOfMessageValue | DataKind::OtherMessageNonEmptyValue | typeTag};
+        DataKind    trailerByte{DataKind::EndOfMessageValue | DataKind::OtherMessageNonEmptyValue | typeTag};
+
+        scratch.open(true);
+        scratch.appendBytes(&headerByte, sizeof(headerByte));
+        compileValue(scratch, *schema, ""s);
+        scratch.appendBytes(&trailerByte, sizeof(trailerByte));
+        size_t  length{currentLength(scratch)};
+        auto    bytes{scratch.getSharedBytes(0, length)};
+
+        if (bytes)
+        {
+            ODL_LOG("(bytes)"); //####
+            Message reference;
+
+            _encoding.assign(bytes.get(), bytes.get() + length);
+            // Make sure that the compiled form matches what the schema itself produces.
+            reference.open(true);
+            reference.setValue(schema);
+            reference.close();
+            auto    referenceBytes{reference.getString()};
+
+            _valid = ((referenceBytes.length() == _encoding.size()) &&
+                      (0 == memcmp(referenceBytes.data(), _encoding.data(), _encoding.size())));
+            ODL_B1(_valid); //####
+        }
+    }
+    if (! _valid)
+    {
+        ODL_LOG("(! _valid)"); //####
+        _encoding.clear();
+        _names.clear();
+        _offsets.clear();
+    }
+    ODL_EXIT_P(this); //####
+} // nImO::SchemaCodec::SchemaCodec
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+nImO::SchemaCodec::compileDoubles
+    (Message &              scratch,
+     std::queue<double> &   values,
+     StdStringVector &      names)
+{
+    ODL_OBJENTER(); //####
+    ODL_P3(&scratch, &values, &names); //####
+    size_t  numValues{values.size()};
+
+    if (0 < numValues)
+    {
+        ODL_LOG("(0 < numValues)"); //####
+        Double::writeValuesToMessage(values, scratch);
+        // The values are the last bytes written.
+        for (size_t ii = 0, offset = currentLength(scratch) - (numValues * sizeof(NumberAsBytes)); numValues > ii;
+             ++ii, offset += sizeof(NumberAsBytes))
+        {
+            _offsets.push_back(offset);
+            _names.push_back(names[ii]);
+        }
+        names.clear();
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::SchemaCodec::compileDoubles
+
+void
+nImO::SchemaCodec::compileValue
+    (Message &              scratch,
+     const Value &          aValue,
+     const std::string &    name)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2(&scratch, &aValue); //####
+    ODL_S1s(name); //####
+    auto    asDouble{aValue.asDouble()};
+    auto    asArray{aValue.asArray()};
+    auto    asMap{aValue.asMap()};
+
+    if (nullptr != asDouble)
+    {
+        ODL_LOG("(nullptr != asDouble)"); //####
+        std::queue<double>  values;
+        StdStringVector     names{name};
+
+        values.push(asDouble->getDoubleValue());
+        compileDoubles(scratch, values, names);
+    }
+    else
+    {
+        if ((nullptr != asArray) && (! asArray->empty()))
+        {
+            ODL_LOG("((nullptr != asArray) && (! asArray->empty()))"); //####
+            // This follows Array::writeToMessage(), which gathers adjacent Double values.
+            static const DataKind   startArray{DataKind::Other | DataKind::OtherContainerStart |
+                                                DataKind::OtherContainerTypeArray |
+                                                DataKind::OtherContainerNonEmptyValue};
+            static const DataKind   endArray{DataKind::Other | DataKind::OtherContainerEnd |
+                                                DataKind::OtherContainerTypeArray |
+                                                DataKind::OtherContainerNonEmptyValue};
+            std::queue<double>      doublesSeen;
+            StdStringVector         doubleNames;
+            Integer                 count{StaticCast(int, asArray->size()) + kDataKindIntegerShortValueMinValue - 1};
+
+            scratch.appendBytes(&startArray, sizeof(startArray));
+            count.writeToMessage(scratch);
+            for (size_t ii = 0, nn = asArray->size(); nn > ii; ++ii)
+            {
+                auto    element{asArray->at(ii)};
+
+                if (element)
+                {
+                    auto    elementName{name + "["s + std::to_string(ii) + "]"s};
+                    auto    elementAsDouble{element->asDouble()};
+
+                    if (nullptr == elementAsDouble)
+                    {
+                        compileDoubles(scratch, doublesSeen, doubleNames);
+                        compileValue(scratch, *element, elementName);
+                    }
+                    else
+                    {
+                        doublesSeen.push(elementAsDouble->getDoubleValue());
+                        doubleNames.push_back(elementName);
+                    }
+                }
+            }
+            compileDoubles(scratch, doublesSeen, doubleNames);
+            scratch.appendBytes(&endArray, sizeof(endArray));
+        }
+        else
+        {
+            if ((nullptr != asMap) && (! asMap->empty()))
+            {
+                ODL_LOG("((nullptr != asMap) && (! asMap->empty()))"); //####
+                // This follows Map::writeToMessage().
+                static const DataKind   startMap{DataKind::Other | DataKind::OtherContainerStart |
+                                                    DataKind::OtherContainerTypeMap |
+                                                    DataKind::OtherContainerNonEmptyValue};
+                static const DataKind   endMap{DataKind::Other | DataKind::OtherContainerEnd |
+                                                DataKind::OtherContainerTypeMap |
+                                                DataKind::OtherContainerNonEmptyValue};
+                Integer                 count{StaticCast(int, asMap->size()) + kDataKindIntegerShortValueMinValue - 1};
+
+                scratch.appendBytes(&startMap, sizeof(startMap));
+                count.writeToMessage(scratch);
+                for (auto & walker : *asMap)
+                {
+                    auto    entryName{keyName(*walker.first)};
+
+                    walker.first->writeToMessage(scratch);
+                    compileValue(scratch, *walker.second, name.empty() ? entryName : (name + "."s + entryName));
+                }
+                scratch.appendBytes(&endMap, sizeof(endMap));
+            }
+            else
+            {
+                ODL_LOG("! ((nullptr != asMap) && (! asMap->empty()))"); //####
+                // Anything else is a constant.
+                aValue.writeToMessage(scratch);
+            }
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::SchemaCodec::compileValue
+
+bool
+nImO::SchemaCodec::decode
+    (const Message &    inMessage,
+     Ptr(double)        values)
+    const
+{
+    ODL_OBJENTER(); //####
+    ODL_P2(&inMessage, values); //####
+    bool    okSoFar{false};
+
+    if (_valid && (nullptr != values) && inMessage.atEnd(_encoding.size()))
+    {
+        ODL_LOG("(_valid && (nullptr != values) && inMessage.atEnd(_encoding.size()))"); //####
+        size_t  numFields{_offsets.size()};
+
+        okSoFar = true;
+        // Check the constant bytes before and between the fields, directly against the received chunks.
+        for (size_t ii = 0, start = 0; okSoFar && (numFields >= ii); ++ii)
+        {
+            size_t  end{(numFields > ii) ? _offsets[ii] : _encoding.size()};
+
+            okSoFar = matchBytes(inMessage, start, _encoding.data() + start, end - start);
+            start = end + sizeof(NumberAsBytes);
+        }
+        ODL_B1(okSoFar); //####
+        if (okSoFar)
+        {
+            NumberAsBytes   holder;
+
+            for (size_t ii = 0; okSoFar && (numFields > ii); ++ii)
+            {
+                okSoFar = copyBytes(inMessage, _offsets[ii], holder, sizeof(holder));
+                if (okSoFar)
+                {
+                    values[ii] = B2D(holder);
+                }
+            }
+        }
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::SchemaCodec::decode
+
+nImO::Message &
+nImO::SchemaCodec::encode
+    (Message &      outMessage,
+     CPtr(double)   values)
+    const
+{
+    ODL_OBJENTER(); //####
+    ODL_P2(&outMessage, values); //####
+    if (_valid && (nullptr != values))
+    {
+        ODL_LOG("(_valid && (nullptr != values))"); //####
+        ByteVector      encoded{_encoding};
+        NumberAsBytes   holder;
+
+        for (size_t ii = 0, numFields = _offsets.size(); numFields > ii; ++ii)
+        {
+            D2B(values[ii], holder);
+            memcpy(encoded.data() + _offsets[ii], holder, sizeof(holder));
+        }
+        outMessage.setEncodedValue(encoded.data(), encoded.size());
+    }
+    ODL_OBJEXIT_P(&outMessage); //####
+    return outMessage;
+} // nImO::SchemaCodec::encode
+
+nImO::SpSchemaCodec
+nImO::SchemaCodec::findCodec
+    (const std::string &    dataType)
+{
+    ODL_ENTER(); //####
+    ODL_S1s(dataType); //####
+    SpSchemaCodec               result;
+    std::lock_guard<std::mutex> guard{gCodecsLock};
+    auto                        match{gCodecs.find(dataType)};
+
+    if (gCodecs.end() != match)
+    {
+        ODL_LOG("(gCodecs.end() != match)"); //####
+        result = match->second;
+    }
+    ODL_EXIT_P(result.get()); //####
+    return result;
+} // nImO::SchemaCodec::findCodec
+
+int
+nImO::SchemaCodec::getFieldIndex
+    (const std::string &    name)
+    const
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s(name); //####
+    int     result{-1};
+    auto    match{std::find(_names.begin(), _names.end(), name)};
+
+    if (_names.end() != match)
+    {
+        ODL_LOG("(_names.end() != match)"); //####
+        result = StaticCast(int, match - _names.begin());
+    }
+    ODL_OBJEXIT_I(result); //####
+    return result;
+} // nImO::SchemaCodec::getFieldIndex
+
+std::string
+nImO::SchemaCodec::getFieldName
+    (const size_t   index)
+    const
+{
+    ODL_OBJENTER(); //####
+    ODL_I1(index); //####
+    std::string result;
+
+    if (_names.size() > index)
+    {
+        ODL_LOG("(_names.size() > index)"); //####
+        result = _names[index];
+    }
+    ODL_OBJEXIT_s(result); //####
+    return result;
+} // nImO::SchemaCodec::getFieldName
+
+nImO::SpSchemaCodec
+nImO::SchemaCodec::registerCodec
+    (const std::string &    dataType,
+     SpValue                schema)
+{
+    ODL_ENTER(); //####
+    ODL_S1s(dataType); //####
+    ODL_P1(schema.get()); //####
+    auto    result{std::make_shared<SchemaCodec>(schema)};
+
+    if (result->isValid())
+    {
+        ODL_LOG("(result->isValid())"); //####
+        std::lock_guard<std::mutex> guard{gCodecsLock};
+
+        gCodecs[dataType] = result;
+    }
+    else
+    {
+        ODL_LOG("! (result->isValid())"); //####
+        result.reset();
+    }
+    ODL_EXIT_P(result.get()); //####
+    return result;
+} // nImO::SchemaCodec::registerCodec
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,252 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOschemaCodec.h
+//
+//  Project:    nImO
+//
+//  Contains:   The class declaration for schema-compiled Message codecs.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(nImOschemaCodec_H_))
+# define nImOschemaCodec_H_ /* Header guard */
+
+# include <Containers/nImOmessage.h>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for schema-compiled Message codecs. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace nImO
+{
+    /*! @brief A class to provide an encoder and decoder for Messages with a fixed shape.
+
+     The schema is a Value, such as a Map with fixed keys whose values are Doubles or Arrays of
+     Doubles. Each Double in the schema becomes a field of the codec and everything else in the
+     schema is treated as a constant. As the fields of such a Message are at fixed offsets, a Message
+     is checked once against the encoded schema and the fields are then read or written directly,
+     without building any Values. The Messages are identical to those produced by Message::setValue()
+     for the equivalent Value, so receivers that do not use the codec are unaffected.
+     A channel uses the codec that is registered for the data type of its connection, when it is set up.
+     An output channel sends fields with OutChannel::sendFields() and an input channel delivers the fields
+     of each Message with the shape of the schema as ReceivedData::_receivedFields, without building a Value. */
+    class SchemaCodec final
+    {
+
+        public :
+            // Public type definitions.
+
+        protected :
+            // Protected type definitions.
+
+        private :
+            // Private type definitions.
+
+            /*! @brief The table of registered codecs. */
+            using CodecMap = std::map<std::string, SpSchemaCodec>;
+
+            /*! @brief A sequence of offsets in an encoded Message. */
+            using OffsetVector = std::vector<size_t>;
+
+        public :
+            // Public methods.
+
+            /*! @brief The constructor.
+             @param[in] schema The Value that describes the shape of the Messages. */
+            explicit SchemaCodec
+                (SpValue    schema);
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            SchemaCodec
+                (const SchemaCodec &    other) = delete;
+
+            /*! @brief The move constructor.
+             @param[in] other The object to be moved. */
+            SchemaCodec
+                (SchemaCodec && other)
+                noexcept = delete;
+
+            /*! @brief Extract the fields of a Message.
+             @param[in] inMessage The Message to be decoded.
+             @param[out] values The fields of the Message; there must be room for getFieldCount() values.
+             @return @c true if the Message has the shape of the schema and @c false otherwise. */
+            bool
+            decode
+                (const Message &    inMessage,
+                 Ptr(double)        values)
+                const;
+
+            /*! @brief Set the contents of a Message from the fields.
+             @param[in,out] outMessage The Message to be filled, which must be open for writing.
+             @param[in] values The fields to be written; there must be getFieldCount() values.
+             @return The Message object so that cascading can be done. */
+            Message &
+            encode
+                (Message &      outMessage,
+                 CPtr(double)   values)
+                const;
+
+            /*! @brief Return the codec registered for a data type.
+             @param[in] dataType The data type of interest.
+             @return The codec for the data type or @c nullptr if there is none. */
+            static SpSchemaCodec
+            findCodec
+                (const std::string &    dataType);
+
+            /*! @brief Return the number of fields.
+             @return The number of fields. */
+            inline size_t
+            getFieldCount
+                (void)
+                const
+            {
+                return _offsets.size();
+            }
+
+            /*! @brief Return the position of a field.
+             Fields are named by their path within the schema, with Map keys separated by periods and
+             Array positions in square brackets, such as 'pose.position[2]'.
+             @param[in] name The name of the field.
+             @return The position of the field or @c -1 if there is no field with the given name. */
+            int
+            getFieldIndex
+                (const std::string &    name)
+                const;
+
+            /*! @brief Return the name of a field.
+             @param[in] index The position of the field.
+             @return The name of the field or an empty string if the position is out of range. */
+            std::string
+            getFieldName
+                (const size_t   index)
+                const;
+
+            /*! @brief Return @c true if the schema was successfully compiled.
+             @return @c true if the schema was successfully compiled and @c false otherwise. */
+            inline bool
+            isValid
+                (void)
+                const
+            {
+                return _valid;
+            }
+
+            /*! @brief The copy assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            SchemaCodec &
+            operator=
+                (const SchemaCodec &    other) = delete;
+
+            /*! @brief The move assignment operator.
+             @param[in] other The object to be moved.
+             @return The updated object. */
+            SchemaCodec &
+            operator=
+                (SchemaCodec && other)
+                noexcept = delete;
+
+            /*! @brief Compile a schema and record the codec for a data type.
+             Note that a codec that is already registered for the data type is replaced.
+             @param[in] dataType The data type, as given when adding a channel or a connection.
+             @param[in] schema The Value that describes the shape of the Messages.
+             @return The codec or @c nullptr if the schema could not be compiled. */
+            static SpSchemaCodec
+            registerCodec
+                (const std::string &    dataType,
+                 SpValue                schema);
+
+        protected :
+            // Protected methods.
+
+        private :
+            // Private methods.
+
+            /*! @brief Add a sequence of Double values to a Message, recording them as fields.
+             @param[in,out] scratch The Message being assembled.
+             @param[in,out] values The values to be added; this is empty on return.
+             @param[in,out] names The names of the values; this is empty on return. */
+            void
+            compileDoubles
+                (Message &              scratch,
+                 std::queue<double> &   values,
+                 StdStringVector &      names);
+
+            /*! @brief Add the encoding of a part of the schema to a Message.
+             @param[in,out] scratch The Message being assembled.
+             @param[in] aValue The part of the schema to be added.
+             @param[in] name The path of the part within the schema. */
+            void
+            compileValue
+                (Message &              scratch,
+                 const Value &          aValue,
+                 const std::string &    name);
+
+        public :
+            // Public fields.
+
+        protected :
+            // Protected fields.
+
+        private :
+            // Private fields.
+
+            /*! @brief The encoded schema, which holds the constant parts of each Message. */
+            ByteVector  _encoding{};
+
+            /*! @brief The names of the fields. */
+            StdStringVector _names{};
+
+            /*! @brief The offsets of the fields in the encoded schema. */
+            OffsetVector    _offsets{};
+
+            /*! @brief @c true if the schema was successfully compiled. */
+            bool    _valid{false};
+
+            /*! @brief The registered codecs. */
+            static CodecMap gCodecs;
+
+            /*! @brief Mutual-exclusion protection for the registered codecs. */
+            static std::mutex   gCodecsLock;
+
+    }; // SchemaCodec
+
+} // nImO
+
+#endif // not defined(nImOschemaCodec_H_)
@@ -156,7 +156,11 @@ nImO::Set::addValue
         }
         if (val->enumerationType() == _keyKind)
         {
-            result = inherited2::emplace(val);
+            size_t  oldSize{inherited2::size()};
+
+            // Values usually arrive in order, so try the end of the storage first.
+            result.first = inherited2::emplace_hint(inherited2::end(), val);
+            result.second = (oldSize < inherited2::size());
         }
         else
         {
@@ -396,6 +400,8 @@ nImO::Set::extractValue
                     {
                         bool    okSoFar{true};
 
+                        // Each element occupies at least one byte, which bounds the count from a damaged Message.
+                        aSet->reserve(StaticCast(size_t, std::min(elementCount, StaticCast(int64_t, theMessage.getLength()))));
                         for ( ; okSoFar && (elementCount > StaticCast(int64_t, aSet->size())); )
                         {
                             aByte = theMessage.getByte(position, atEnd);
@@ -791,10 +797,7 @@ nImO::Set::random
 
     if (0 < howMany)
     {
-        for (size_t ii = 0, keyNumber = (nImO::RandomUnsigned() % howMany); ii < keyNumber; ++ii)
-        {
-            ++result;
-        }
+        result += (nImO::RandomUnsigned() % howMany);
     }
     ODL_OBJEXIT(); //####
     return result;
@@ -810,10 +813,7 @@ nImO::Set::random
 
     if (0 < howMany)
     {
-        for (size_t ii = 0, keyNumber = (nImO::RandomUnsigned() % howMany); ii < keyNumber; ++ii)
-        {
-            ++result;
-        }
+        result += (nImO::RandomUnsigned() % howMany);
     }
     ODL_OBJEXIT(); //####
     return result;
@@ -55,8 +55,10 @@
 
 namespace nImO
 {
-    /*! @brief The standard class on which Array is based. */
-    using SetBase = std::set<SpValue, CompareValues>;
+    /*! @brief The standard class on which Set is based.
+     Note that a sorted vector is used rather than a node-based tree, as Sets are most often
+     built from already-ordered data and then scanned. */
+    using SetBase = boost::container::flat_set<SpValue, CompareValues>;
 
     /*! @brief A class to provide collections with set-like behaviour.
 
@@ -43,7 +43,14 @@
 #include <Containers/nImOarray.h>
 #include <Containers/nImObufferChunk.h>
 
+#include <charconv>
 #include <inttypes.h>
+#if defined(__AVX2__)
+# include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (2 <= _M_IX86_FP))
+# include <emmintrin.h>
+# define nImO_USE_SSE2_ /* */
+#endif // defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (2 <= _M_IX86_FP))
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -114,6 +121,94 @@ static CPtr(char)   kCanonicalControl[]
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Return @c true if a byte can be copied into a quoted string without change.
+ @param[in] aByte The byte to be checked.
+ @param[in] quote1 A quote character that must be escaped.
+ @param[in] quote2 Another quote character that must be escaped.
+ @return @c true if the byte is not a control character, does not have the high bit set and is not
+ a quote character or the escape character. */
+static inline bool
+isPlainByte
+    (const uint8_t  aByte,
+     const uint8_t  quote1,
+     const uint8_t  quote2)
+{
+    return ((0x20 <= aByte) && (0 == (aByte & 0x80)) && (quote1 != aByte) && (quote2 != aByte) &&
+            (kEscapeChar != aByte));
+} // isPlainByte
+
+/*! @brief Return the position of the first byte that cannot be copied into a quoted string without
+ change.
+ Blocks of bytes are checked together, where the processor supports it, and only the block that
+ contains a byte that needs attention is checked a byte at a time.
+ @param[in] data The bytes to be checked.
+ @param[in] start The position of the first byte to be checked.
+ @param[in] length The number of bytes in the data.
+ @param[in] quote1 A quote character that must be escaped.
+ @param[in] quote2 Another quote character that must be escaped.
+ @return The position of the first byte that needs attention or @c length if there is none. */
+static size_t
+skipPlainBytes
+    (CPtr(uint8_t)  data,
+     const size_t   start,
+     const size_t   length,
+     const uint8_t  quote1,
+     const uint8_t  quote2)
+{
+    ODL_ENTER(); //####
+    ODL_P1(data); //####
+    ODL_I2(start, length); //####
+    size_t  ii{start};
+
+#if defined(__AVX2__)
+    // Bytes that are less than a space, as signed values, are control characters or have the high bit set.
+    const __m256i   limit{_mm256_set1_epi8(0x20)};
+    const __m256i   firstQuote{_mm256_set1_epi8(StaticCast(char, quote1))};
+    const __m256i   secondQuote{_mm256_set1_epi8(StaticCast(char, quote2))};
+    const __m256i   escape{_mm256_set1_epi8(kEscapeChar)};
+
+    for ( ; (ii + sizeof(__m256i)) <= length; ii += sizeof(__m256i))
+    {
+        __m256i block{_mm256_loadu_si256(ReinterpretCast(CPtr(__m256i), data + ii))};
+        __m256i special{_mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi8(limit, block),
+                                                        _mm256_cmpeq_epi8(block, escape)),
+                                        _mm256_or_si256(_mm256_cmpeq_epi8(block, firstQuote),
+                                                        _mm256_cmpeq_epi8(block, secondQuote)))};
+
+        if (0 != _mm256_movemask_epi8(special))
+        {
+            break;
+
+        }
+    }
+#elif defined(nImO_USE_SSE2_)
+    // Bytes that are less than a space, as signed values, are control characters or have the high bit set.
+    const __m128i   limit{_mm_set1_epi8(0x20)};
+    const __m128i   firstQuote{_mm_set1_epi8(StaticCast(char, quote1))};
+    const __m128i   secondQuote{_mm_set1_epi8(StaticCast(char, quote2))};
+    const __m128i   escape{_mm_set1_epi8(kEscapeChar)};
+
+    for ( ; (ii + sizeof(__m128i)) <= length; ii += sizeof(__m128i))
+    {
+        __m128i block{_mm_loadu_si128(ReinterpretCast(CPtr(__m128i), data + ii))};
+        __m128i special{_mm_or_si128(_mm_or_si128(_mm_cmplt_epi8(block, limit), _mm_cmpeq_epi8(block, escape)),
+                                     _mm_or_si128(_mm_cmpeq_epi8(block, firstQuote),
+                                                  _mm_cmpeq_epi8(block, secondQuote)))};
+
+        if (0 != _mm_movemask_epi8(special))
+        {
+            break;
+
+        }
+    }
+#endif // defined(nImO_USE_SSE2_)
+    for ( ; (length > ii) && isPlainByte(data[ii], quote1, quote2); ++ii)
+    {
+    }
+    ODL_EXIT_I(ii); //####
+    return ii;
+} // skipPlainBytes
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -130,6 +225,15 @@ nImO::StringBuffer::StringBuffer
     ODL_EXIT_P(this); //####
 } // nImO::StringBuffer::StringBuffer
 
+nImO::StringBuffer::StringBuffer
+    (TextSink & sink) :
+        inherited{sink, true}
+{
+    ODL_ENTER(); //####
+    ODL_P1(&sink); //####
+    ODL_EXIT_P(this); //####
+} // nImO::StringBuffer::StringBuffer
+
 nImO::StringBuffer::StringBuffer
     (StringBuffer &&    other)
     noexcept :
@@ -184,6 +288,35 @@ nImO::StringBuffer::addBytes
     return *this;
 } // nImO::StringBuffer::addBytes
 
+nImO::StringBuffer &
+nImO::StringBuffer::addDouble
+    (const double   aDouble)
+{
+    ODL_OBJENTER(); //####
+    ODL_D1(aDouble); //####
+    // Format directly into the buffer, rather than going through a temporary string.
+    std::array<char, kNumberTextLength> holder;
+    auto                                textEnd{ConvertDoubleToChars(holder.data(), holder.data() + holder.size(), aDouble)};
+
+    inherited::appendBytes(ReinterpretCast(CPtr(uint8_t), holder.data()), StaticCast(size_t, textEnd - holder.data()));
+    ODL_OBJEXIT_P(this); //####
+    return *this;
+} // nImO::StringBuffer::addDouble
+
+nImO::StringBuffer &
+nImO::StringBuffer::addLong
+    (const int64_t  aLong)
+{
+    ODL_OBJENTER(); //####
+    ODL_I1(aLong); //####
+    std::array<char, kNumberTextLength> holder;
+    auto                                converted{std::to_chars(holder.data(), holder.data() + holder.size(), aLong)};
+
+    inherited::appendBytes(ReinterpretCast(CPtr(uint8_t), holder.data()), StaticCast(size_t, converted.ptr - holder.data()));
+    ODL_OBJEXIT_P(this); //####
+    return *this;
+} // nImO::StringBuffer::addLong
+
 nImO::StringBuffer &
 nImO::StringBuffer::addString
     (CPtr(char) aString,
@@ -329,11 +462,14 @@ nImO::StringBuffer::processCharacters
     size_t  numDoubleQuotes{0};
     size_t  numEscapes{0};
 
+    CPtr(uint8_t)   asBytes{ReinterpretCast(CPtr(uint8_t), aString)};
+
     // First, determine how many of each kind of quote character there are, and if there are
     // 'special' characters - control characters or characters with the high bit set
-    for (size_t ii = 0; length > ii; ++ii)
+    for (size_t ii = skipPlainBytes(asBytes, 0, length, kSingleQuote, kDoubleQuote); length > ii;
+         ii = skipPlainBytes(asBytes, ii + 1, length, kSingleQuote, kDoubleQuote))
     {
-        uint8_t aByte{StaticCast(uint8_t, aString[ii])};
+        uint8_t aByte{asBytes[ii]};
 
         if ((0x20 > aByte) || (0 != (aByte &0x80)))
         {
@@ -368,7 +504,20 @@ nImO::StringBuffer::processCharacters
         inherited::appendBytes(&delimiter, sizeof(delimiter));
         for (size_t ii = 0; length > ii; ++ii)
         {
-            uint8_t aByte{StaticCast(uint8_t, aString[ii])};
+            size_t  runEnd{skipPlainBytes(asBytes, ii, length, delimiter, delimiter)};
+
+            // Copy the bytes that don't need attention all at once.
+            if (ii < runEnd)
+            {
+                inherited::appendBytes(asBytes + ii, runEnd - ii);
+                ii = runEnd;
+                if (length == ii)
+                {
+                    break;
+
+                }
+            }
+            uint8_t aByte{asBytes[ii]};
 
             if ((0x20 > aByte) || (0 != (aByte &0x80)))
             {
@@ -77,6 +77,13 @@ namespace nImO
             StringBuffer
                 (void);
 
+            /*! @brief The constructor for a buffer that sends its text to a TextSink as it is added.
+             This allows a Value to be printed directly to its destination, without first collecting
+             all of its text; the buffer must be flushed to send the text that remains.
+             @param[in] sink The destination for the text. */
+            explicit StringBuffer
+                (TextSink & sink);
+
             /*! @brief The copy constructor.
              @param[in] other The object to be copied. */
             StringBuffer
@@ -107,24 +114,16 @@ namespace nImO
             /*! @brief Add a character string representation of a floating-point value to the buffer.
              @param[in] aDouble The value to add.
              @return The StringBuffer object so that cascading can be done. */
-            inline StringBuffer &
+            StringBuffer &
             addDouble
-                (const double   aDouble)
-            {
-                addString(ConvertDoubleToString(aDouble));
-                return *this;
-            }
+                (const double   aDouble);
 
             /*! @brief Add a character string representation of an integer value to the buffer.
              @param[in] aLong The value to add.
              @return The StringBuffer object so that cascading can be done. */
-            inline StringBuffer &
+            StringBuffer &
             addLong
-                (const int64_t  aLong)
-            {
-                addString(std::to_string(aLong));
-                return *this;
-            }
+                (const int64_t  aLong);
 
             /*! @brief Add a character string to the buffer.
              @param[in] aString The value to add.
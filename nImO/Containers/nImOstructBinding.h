@@ -0,0 +1,1126 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOstructBinding.h
+//
+//  Project:    nImO
+//
+//  Contains:   The template declarations for binding C++ structs to Messages.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(nImOstructBinding_H_))
+# define nImOstructBinding_H_ /* Header guard */
+
+# include <BasicTypes/nImOdouble.h>
+# include <Containers/nImOkeyDictionary.h>
+# include <Containers/nImOmessage.h>
+
+# include <algorithm>
+# include <array>
+# include <cstring>
+# include <tuple>
+# include <utility>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The template declarations for binding C++ structs to Messages.
+
+ A struct is bound by listing its fields with NIMO_BIND_STRUCT and NIMO_BIND_FIELD, at global scope:
+
+ @code
+ struct Pose
+ {
+     std::string         frame;
+     std::vector<double> position;
+     int64_t             sequence;
+ };
+
+ NIMO_BIND_STRUCT(Pose, NIMO_BIND_FIELD(Pose, frame), NIMO_BIND_FIELD(Pose, position),
+                  NIMO_BIND_FIELD(Pose, sequence));
+ @endcode
+
+ EncodeBoundValue() and DecodeBoundValue() then write and read the struct directly, without building
+ any Values. A bound struct is written as a Map with a String key for each field, so the Messages are
+ identical to those produced by Message::setValue() for the equivalent Map and can be read by any
+ receiver; the keys are sent as references when the Message has a dictionary for Map keys. Fields can
+ be bool, integral, floating-point, std::string, std::vector of a supported type or another bound struct.
+
+ OutChannel::sendBoundValue() sends a bound struct on a connection and an InChannel that is set to deliver
+ Messages, with InChannel::setDeliverMessages(), queues the received Messages for DecodeBoundValue(). */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace nImO
+{
+    /*! @brief The fields of a struct that can be written to and read from Messages.
+     Each specialization has a static constexpr member, 'kFields', which is a std::tuple of BoundField values.
+     Note that the field names must be unique within the struct.
+     @tparam Type_ The type of the struct. */
+    template
+        <typename   Type_>
+    struct StructBinding;
+
+    /*! @brief A field of a bound struct.
+     @tparam Struct_ The type of the struct.
+     @tparam Field_ The type of the field. */
+    template
+        <typename   Struct_,
+         typename   Field_>
+    struct BoundField
+    {
+        /*! @brief The type of the field. */
+        using FieldType = Field_;
+
+        /*! @brief The name of the field, which is the Map key for the field. */
+        CPtr(char)  _name;
+
+        /*! @brief The location of the field within the struct. */
+        Field_ Struct_::*   _member;
+
+    }; // BoundField
+
+    /*! @brief Return the description of a field of a bound struct.
+     @tparam Struct_ The type of the struct.
+     @tparam Field_ The type of the field.
+     @param[in] name The name of the field.
+     @param[in] member The location of the field within the struct.
+     @return The description of the field. */
+    template
+        <typename   Struct_,
+         typename   Field_>
+    constexpr BoundField<Struct_, Field_>
+    BindField
+        (CPtr(char)         name,
+         Field_ Struct_::*  member)
+        noexcept
+    {
+        return BoundField<Struct_, Field_>{name, member};
+    }
+
+    namespace internal_
+    {
+        /*! @brief Indicate that a type is not a bound struct.
+         @tparam Type_ The type of interest. */
+        template
+            <typename   Type_,
+             typename   = void>
+        struct IsBoundStruct : std::false_type
+        {
+        }; // IsBoundStruct
+
+        /*! @brief Indicate that a type is a bound struct.
+         @tparam Type_ The type of interest. */
+        template
+            <typename   Type_>
+        struct IsBoundStruct<Type_, std::void_t<decltype(StructBinding<Type_>::kFields)>> : std::true_type
+        {
+        }; // IsBoundStruct
+
+        /*! @brief A class to read encoded values, in order, from a Message. */
+        class BoundReader final
+        {
+
+            public :
+                // Public methods.
+
+                /*! @brief The constructor.
+                 @param[in] inMessage The Message to be read. */
+                explicit BoundReader
+                    (const Message &    inMessage) :
+                        _message{inMessage}
+                {
+                }
+
+                /*! @brief Return @c true if the entire Message has been read.
+                 @return @c true if the entire Message has been read. */
+                inline bool
+                atEnd
+                    (void)
+                    const
+                {
+                    return _message.atEnd(_position);
+                }
+
+                /*! @brief Read a specific byte.
+                 @param[in] expected The byte that should be next. */
+                inline void
+                expectByte
+                    (const DataKind expected)
+                {
+                    if (_okSoFar && (0 == _doublesLeft))
+                    {
+                        _okSoFar = (toUType(expected) == nextByte());
+                    }
+                    else
+                    {
+                        _okSoFar = false;
+                    }
+                }
+
+                /*! @brief Indicate that something unexpected was read. */
+                inline void
+                fail
+                    (void)
+                {
+                    _okSoFar = false;
+                }
+
+                /*! @brief Return the number of bytes that have not yet been read.
+                 This bounds any size that is read from the Message, so that damaged input cannot cause large
+                 allocations.
+                 @return The number of bytes that have not yet been read. */
+                inline size_t
+                getRemaining
+                    (void)
+                    const
+                {
+                    // Message::getLength() reports zero for a Message that is still open, so ask the underlying buffer.
+                    size_t  length{_message.ChunkArray::getLength()};
+
+                    return ((length > _position) ? (length - _position) : 0);
+                }
+
+                /*! @brief Return @c true if everything read so far was as expected.
+                 @return @c true if everything read so far was as expected. */
+                inline bool
+                isOK
+                    (void)
+                    const
+                {
+                    return _okSoFar;
+                }
+
+                /*! @brief Read the start of a Container.
+                 Note that an empty Container is read completely.
+                 @param[in] containerType The type of Container that is expected.
+                 @return The number of elements in the Container. */
+                inline size_t
+                readContainerStart
+                    (const DataKind containerType)
+                {
+                    size_t  result{0};
+                    int     leadByte{(0 == _doublesLeft) ? peekByte() : 0};
+
+                    if (_okSoFar && (0 == _doublesLeft))
+                    {
+                        DataKind    startBits{DataKind::Other | DataKind::OtherContainerStart | containerType};
+
+                        if (toUType(startBits | DataKind::OtherContainerEmptyValue) == leadByte)
+                        {
+                            ++_position;
+                            expectByte(DataKind::Other | DataKind::OtherContainerEnd | containerType |
+                                       DataKind::OtherContainerEmptyValue);
+                        }
+                        else
+                        {
+                            if (toUType(startBits | DataKind::OtherContainerNonEmptyValue) == leadByte)
+                            {
+                                ++_position;
+                                int64_t count{readInt64()};
+
+                                // The count is stored as by Array::writeToMessage() and Map::writeToMessage().
+                                count -= (kDataKindIntegerShortValueMinValue - 1);
+                                if (_okSoFar && (0 < count))
+                                {
+                                    result = StaticCast(size_t, count);
+                                }
+                                else
+                                {
+                                    _okSoFar = false;
+                                }
+                            }
+                            else
+                            {
+                                _okSoFar = false;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        _okSoFar = false;
+                    }
+                    return result;
+                }
+
+                /*! @brief Read a floating-point value, which may be part of a sequence of values.
+                 @return The floating-point value or zero if it could not be read. */
+                inline double
+                readDouble
+                    (void)
+                {
+                    double  result{0};
+
+                    if (_okSoFar && (0 == _doublesLeft))
+                    {
+                        int leadByte{nextByte()};
+
+                        if (_okSoFar && (DataKind::Double == (leadByte & DataKind::Mask)))
+                        {
+                            if (DataKind::DoubleShortCount == (DataKind::DoubleCountMask & leadByte))
+                            {
+                                _doublesLeft = toUType(DataKind::DoubleShortCountMask & leadByte) + 1;
+                                _singlePrecision = false;
+                            }
+                            else
+                            {
+                                size_t  size{StaticCast(size_t, toUType(DataKind::DoubleLongCountMask & leadByte) + 1)};
+                                int64_t count{readBytesAsInt64(size)};
+
+                                _doublesLeft = ((0 < count) ? StaticCast(size_t, count) : 0);
+                                _okSoFar = (_okSoFar && (0 < _doublesLeft));
+                                _singlePrecision = (DataKind::DoubleLongCountSinglePrecisionValue ==
+                                                    (DataKind::DoubleLongCountSinglePrecisionValue & leadByte));
+                            }
+                        }
+                        else
+                        {
+                            _okSoFar = false;
+                        }
+                    }
+                    if (_okSoFar)
+                    {
+                        NumberAsBytes   holder;
+                        size_t          valueSize{_singlePrecision ? sizeof(float) : sizeof(double)};
+
+                        for (size_t ii = 0; _okSoFar && (valueSize > ii); ++ii)
+                        {
+                            holder[ii] = StaticCast(uint8_t, nextByte());
+                        }
+                        if (_okSoFar)
+                        {
+                            // Single-precision values are widened.
+                            result = (_singlePrecision ? B2F(holder) : B2D(holder));
+                            --_doublesLeft;
+                        }
+                    }
+                    return result;
+                }
+
+                /*! @brief Read an integer value.
+                 @return The integer value or zero if it could not be read. */
+                inline int64_t
+                readInt64
+                    (void)
+                {
+                    int64_t result{0};
+                    int     leadByte{(0 == _doublesLeft) ? peekByte() : 0};
+
+                    if (_okSoFar && (0 == _doublesLeft) && (DataKind::Integer == (leadByte & DataKind::Mask)))
+                    {
+                        IntStatus   status;
+
+                        result = Value::extractInt64FromMessage(_message, leadByte, _position, status);
+                        _okSoFar = (IntStatus::Successful == status);
+                    }
+                    else
+                    {
+                        _okSoFar = false;
+                    }
+                    return result;
+                }
+
+                /*! @brief Read a Map key, as done by Map::extractValue().
+                 A key that is sent in full is added to the dictionary for Map keys of the Message, if it has one, and a
+                 key that is sent as a reference is looked up in that dictionary.
+                 @param[out] outValue The key. */
+                inline void
+                readKey
+                    (std::string &  outValue)
+                {
+                    int leadByte{(0 == _doublesLeft) ? peekByte() : 0};
+                    int referenceBits{toUType(DataKind::StringOrBlob | DataKind::StringOrBlobStringValue |
+                                              DataKind::StringOrBlobLongLengthValue |
+                                              DataKind::StringOrBlobLongLengthKeyReferenceValue)};
+                    auto    keys{_message.getKeyDictionary()};
+
+                    if (referenceBits == (leadByte & (~ toUType(DataKind::StringOrBlobLongLengthMask))))
+                    {
+                        ++_position;
+                        int64_t index{readBytesAsInt64(StaticCast(size_t,
+                                                                  toUType(DataKind::StringOrBlobLongLengthMask & leadByte) + 1))};
+
+                        outValue.clear();
+                        if (! (_okSoFar && keys && keys->findKey(index, outValue)))
+                        {
+                            _okSoFar = false;
+                        }
+                    }
+                    else
+                    {
+                        readString(outValue);
+                        // Mirror the sender, which adds each new key to its dictionary.
+                        if (_okSoFar && keys)
+                        {
+                            keys->addKey(outValue);
+                        }
+                    }
+                }
+
+                /*! @brief Read a logical value.
+                 @return The logical value or @c false if it could not be read. */
+                inline bool
+                readLogical
+                    (void)
+                {
+                    bool    result{false};
+                    int     leadByte{(0 == _doublesLeft) ? nextByte() : 0};
+
+                    if (_okSoFar && (0 == _doublesLeft) &&
+                        (toUType(DataKind::Other | DataKind::OtherMiscellaneous | DataKind::OtherMiscellaneousTypeLogical) ==
+                         (leadByte & (~ toUType(DataKind::OtherMiscellaneousLogicalValueMask)))))
+                    {
+                        result = (DataKind::OtherMiscellaneousLogicalTrueValue ==
+                                  (DataKind::OtherMiscellaneousLogicalValueMask & leadByte));
+                    }
+                    else
+                    {
+                        _okSoFar = false;
+                    }
+                    return result;
+                }
+
+                /*! @brief Read a string value.
+                 @param[out] outValue The string value. */
+                inline void
+                readString
+                    (std::string &  outValue)
+                {
+                    int leadByte{(0 == _doublesLeft) ? nextByte() : 0};
+
+                    outValue.clear();
+                    if (_okSoFar && (0 == _doublesLeft) && (DataKind::StringOrBlob == (leadByte & DataKind::Mask)) &&
+                        (DataKind::StringOrBlobStringValue == (DataKind::StringOrBlobTypeMask & leadByte)))
+                    {
+                        int64_t length;
+
+                        if (DataKind::StringOrBlobShortLengthValue == (DataKind::StringOrBlobLengthMask & leadByte))
+                        {
+                            length = toUType(DataKind::StringOrBlobShortLengthMask & leadByte);
+                        }
+                        else
+                        {
+                            // Key references are only valid for Map keys, which are read with readKey().
+                            _okSoFar = (DataKind::StringOrBlobLongLengthKeyReferenceValue !=
+                                        (DataKind::StringOrBlobLongLengthKeyReferenceValue & leadByte));
+                            length = readBytesAsInt64(StaticCast(size_t,
+                                                                 toUType(DataKind::StringOrBlobLongLengthMask & leadByte) + 1));
+                        }
+                        if (_okSoFar && (0 <= length) && (getRemaining() >= StaticCast(size_t, length)))
+                        {
+                            outValue.reserve(StaticCast(size_t, length));
+                            for (int64_t ii = 0; _okSoFar && (length > ii); ++ii)
+                            {
+                                outValue += StaticCast(char, nextByte());
+                            }
+                        }
+                        else
+                        {
+                            _okSoFar = false;
+                        }
+                    }
+                    else
+                    {
+                        _okSoFar = false;
+                    }
+                }
+
+            protected :
+                // Protected methods.
+
+            private :
+                // Private methods.
+
+                /*! @brief Read the next byte.
+                 @return The next byte or zero if there are no more bytes. */
+                inline int
+                nextByte
+                    (void)
+                {
+                    int result{peekByte()};
+
+                    if (_okSoFar)
+                    {
+                        ++_position;
+                    }
+                    return result;
+                }
+
+                /*! @brief Return the next byte without consuming it.
+                 @return The next byte or zero if there are no more bytes. */
+                inline int
+                peekByte
+                    (void)
+                {
+                    int result{0};
+
+                    if (_okSoFar)
+                    {
+                        bool    atEnd;
+
+                        result = _message.getByte(_position, atEnd);
+                        if (atEnd)
+                        {
+                            _okSoFar = false;
+                            result = 0;
+                        }
+                    }
+                    return result;
+                }
+
+                /*! @brief Read a big-endian integer value.
+                 @param[in] numBytes The number of bytes in the value.
+                 @return The integer value or zero if it could not be read. */
+                inline int64_t
+                readBytesAsInt64
+                    (const size_t   numBytes)
+                {
+                    NumberAsBytes   holder;
+
+                    for (size_t ii = 0; _okSoFar && (numBytes > ii); ++ii)
+                    {
+                        holder[ii] = StaticCast(uint8_t, nextByte());
+                    }
+                    return (_okSoFar ? B2I(holder, numBytes) : 0);
+                }
+
+            public :
+                // Public fields.
+
+            protected :
+                // Protected fields.
+
+            private :
+                // Private fields.
+
+                /*! @brief The Message being read. */
+                const Message & _message;
+
+                /*! @brief The position of the next byte to be read. */
+                size_t  _position{0};
+
+                /*! @brief The number of floating-point values remaining in the current sequence. */
+                size_t  _doublesLeft{0};
+
+                /*! @brief @c true if everything read so far was as expected. */
+                bool    _okSoFar{true};
+
+                /*! @brief @c true if the current sequence of floating-point values is single-precision. */
+                bool    _singlePrecision{false};
+
+        }; // BoundReader
+
+        /*! @brief Add the encoding of a string to a Message, as done by String::writeToMessage().
+         @param[in,out] outMessage The Message to be appended to.
+         @param[in] data The characters of the string.
+         @param[in] length The number of characters in the string. */
+        inline void
+        WriteBoundString
+            (Message &      outMessage,
+             CPtr(char)     data,
+             const size_t   length)
+        {
+            if (kDataKindStringOrBlobShortLengthMaxValue < length)
+            {
+                NumberAsBytes   numBuff;
+                size_t          numBytes{I2B(length, numBuff)};
+                DataKind        stuff{DataKind::StringOrBlob | DataKind::StringOrBlobStringValue |
+                                        DataKind::StringOrBlobLongLengthValue |
+                                        (DataKind::StringOrBlobLongLengthMask & StaticCast(DataKind, numBytes - 1))};
+
+                outMessage.appendBytes(&stuff, sizeof(stuff));
+                outMessage.appendBytes(numBuff + sizeof(numBuff) - numBytes, numBytes);
+            }
+            else
+            {
+                DataKind    stuff{DataKind::StringOrBlob | DataKind::StringOrBlobStringValue |
+                                    DataKind::StringOrBlobShortLengthValue |
+                                    (DataKind::StringOrBlobShortLengthMask & StaticCast(DataKind, length))};
+
+                outMessage.appendBytes(&stuff, sizeof(stuff));
+            }
+            if (0 < length)
+            {
+                outMessage.appendBytes(ReinterpretCast(CPtr(uint8_t), data), length);
+            }
+        }
+
+        /*! @brief Add the encoding of a Map key to a Message, as done by String::writeKeyToMessage().
+         A key that is in the dictionary for Map keys of the Message is sent as a reference, if that is shorter.
+         @param[in,out] outMessage The Message to be appended to.
+         @param[in] key The key. */
+        inline void
+        WriteBoundKey
+            (Message &      outMessage,
+             CPtr(char)     key)
+        {
+            auto    keys{outMessage.getKeyDictionary()};
+            size_t  length{strlen(key)};
+            bool    sentAsReference{false};
+
+            if (keys)
+            {
+                std::string keyString{key, length};
+                int64_t     index{keys->findIndex(keyString)};
+
+                if (0 > index)
+                {
+                    // The receiver adds the key to its dictionary when it sees it in full.
+                    keys->addKey(keyString);
+                }
+                else
+                {
+                    NumberAsBytes   numBuff;
+                    // The first index has no significant bytes, but at least one byte must be sent.
+                    size_t          numBytes{std::max(I2B(index, numBuff), StaticCast(size_t, 1))};
+
+                    if (length > numBytes)
+                    {
+                        DataKind    stuff{DataKind::StringOrBlob | DataKind::StringOrBlobStringValue |
+                                            DataKind::StringOrBlobLongLengthValue |
+                                            DataKind::StringOrBlobLongLengthKeyReferenceValue |
+                                            (DataKind::StringOrBlobLongLengthMask & StaticCast(DataKind, numBytes - 1))};
+
+                        outMessage.appendBytes(&stuff, sizeof(stuff));
+                        outMessage.appendBytes(numBuff + sizeof(numBuff) - numBytes, numBytes);
+                        sentAsReference = true;
+                    }
+                }
+            }
+            if (! sentAsReference)
+            {
+                WriteBoundString(outMessage, key, length);
+            }
+        }
+
+        /*! @brief The encoding and decoding of a bound struct.
+         @tparam Type_ The type of value. */
+        template
+            <typename   Type_,
+             typename   = void>
+        struct BoundValue
+        {
+            static_assert(IsBoundStruct<Type_>::value, "The type is not bound with NIMO_BIND_STRUCT");
+
+            /*! @brief The fields of the struct. */
+            using Fields = std::remove_cv_t<decltype(StructBinding<Type_>::kFields)>;
+
+            /*! @brief The number of fields of the struct. */
+            static constexpr size_t kFieldCount{std::tuple_size<Fields>::value};
+
+            /*! @brief The type tag for Messages. */
+            static constexpr DataKind   kTypeTag{DataKind::OtherMessageExpectedOtherValue};
+
+            /*! @brief The operations for a single field of the struct. */
+            struct FieldEntry
+            {
+                /*! @brief The name of the field. */
+                CPtr(char)  _name;
+
+                /*! @brief The function to read the field. */
+                void (* _reader) (BoundReader &, Type_ &);
+
+                /*! @brief The function to write the field. */
+                void (* _writer) (Message &, const Type_ &);
+
+            }; // FieldEntry
+
+            /*! @brief The operations for the fields, ordered by name. */
+            using FieldTable = std::array<FieldEntry, kFieldCount>;
+
+            /*! @brief Return the operations for the fields, in the order that a Map would hold them.
+             @return The operations for the fields. */
+            static const FieldTable &
+            getFieldTable
+                (void)
+            {
+                static const FieldTable table{makeFieldTable(std::make_index_sequence<kFieldCount>{})};
+
+                return table;
+            }
+
+            /*! @brief Build the operations for the fields, in the order that a Map would hold them.
+             @tparam Indices_ The positions of the fields.
+             @return The operations for the fields. */
+            template
+                <size_t...  Indices_>
+            static FieldTable
+            makeFieldTable
+                (std::index_sequence<Indices_...>)
+            {
+                FieldTable  result{{FieldEntry{std::get<Indices_>(StructBinding<Type_>::kFields)._name,
+                                               &readField<Indices_>, &writeField<Indices_>}...}};
+
+                // String keys are ordered as std::string orders them, which is the same as strcmp().
+                std::sort(result.begin(), result.end(), [] (const FieldEntry & left, const FieldEntry & right)
+                                                        {
+                                                            return (0 > strcmp(left._name, right._name));
+                                                        });
+                return result;
+            }
+
+            /*! @brief Read a struct.
+             @param[in,out] reader The source of the encoded values.
+             @param[out] outValue The struct to be filled in. */
+            static void
+            read
+                (BoundReader &  reader,
+                 Type_ &        outValue)
+            {
+                size_t  count{reader.readContainerStart(DataKind::OtherContainerTypeMap)};
+
+                if (reader.isOK() && (kFieldCount == count))
+                {
+                    if (0 < count)
+                    {
+                        const FieldTable &  table{getFieldTable()};
+                        std::string         key;
+
+                        for (size_t ii = 0; reader.isOK() && (count > ii); ++ii)
+                        {
+                            reader.readKey(key);
+                            auto    match{std::lower_bound(table.begin(), table.end(), key,
+                                                           [] (const FieldEntry & entry, const std::string & name)
+                                                           {
+                                                               return (0 > strcmp(entry._name, name.c_str()));
+                                                           })};
+
+                            if (reader.isOK() && (table.end() != match) && (key == match->_name))
+                            {
+                                match->_reader(reader, outValue);
+                            }
+                            else
+                            {
+                                reader.fail();
+                            }
+                        }
+                        reader.expectByte(DataKind::Other | DataKind::OtherContainerEnd | DataKind::OtherContainerTypeMap |
+                                          DataKind::OtherContainerNonEmptyValue);
+                    }
+                }
+                else
+                {
+                    reader.fail();
+                }
+            }
+
+            /*! @brief Read a single field.
+             @tparam Index_ The position of the field.
+             @param[in,out] reader The source of the encoded values.
+             @param[out] outValue The struct containing the field. */
+            template
+                <size_t Index_>
+            static void
+            readField
+                (BoundReader &  reader,
+                 Type_ &        outValue)
+            {
+                const auto &    field{std::get<Index_>(StructBinding<Type_>::kFields)};
+
+                BoundValue<typename std::remove_cv_t<std::remove_reference_t<decltype(field)>>::FieldType>::read(reader,
+                                                                                                                    outValue.*(field._member));
+            }
+
+            /*! @brief Write a struct, as done by Map::writeToMessage().
+             @param[in,out] outMessage The Message to be appended to.
+             @param[in] inValue The struct to be written. */
+            static void
+            write
+                (Message &      outMessage,
+                 const Type_ &  inValue)
+            {
+                if (0 < kFieldCount)
+                {
+                    static const DataKind   startMap{DataKind::Other | DataKind::OtherContainerStart |
+                                                        DataKind::OtherContainerTypeMap |
+                                                        DataKind::OtherContainerNonEmptyValue};
+                    static const DataKind   endMap{DataKind::Other | DataKind::OtherContainerEnd |
+                                                    DataKind::OtherContainerTypeMap |
+                                                    DataKind::OtherContainerNonEmptyValue};
+
+                    outMessage.appendBytes(&startMap, sizeof(startMap));
+                    Value::writeInt64ToMessage(outMessage, StaticCast(int, kFieldCount) + kDataKindIntegerShortValueMinValue - 1);
+                    for (auto & walker : getFieldTable())
+                    {
+                        walker._writer(outMessage, inValue);
+                    }
+                    outMessage.appendBytes(&endMap, sizeof(endMap));
+                }
+                else
+                {
+                    static const DataKind   stuff[]
+                    {
+                        DataKind::Other | DataKind::OtherContainerStart | DataKind::OtherContainerTypeMap |
+                          DataKind::OtherContainerEmptyValue,
+                        DataKind::Other | DataKind::OtherContainerEnd | DataKind::OtherContainerTypeMap |
+                          DataKind::OtherContainerEmptyValue
+                    };
+
+                    outMessage.appendBytes(stuff, sizeof(stuff));
+                }
+            }
+
+            /*! @brief Write a single field, preceded by its key.
+             @tparam Index_ The position of the field.
+             @param[in,out] outMessage The Message to be appended to.
+             @param[in] inValue The struct containing the field. */
+            template
+                <size_t Index_>
+            static void
+            writeField
+                (Message &      outMessage,
+                 const Type_ &  inValue)
+            {
+                const auto &    field{std::get<Index_>(StructBinding<Type_>::kFields)};
+
+                WriteBoundKey(outMessage, field._name);
+                BoundValue<typename std::remove_cv_t<std::remove_reference_t<decltype(field)>>::FieldType>::write(outMessage,
+                                                                                                                     inValue.*(field._member));
+            }
+
+        }; // BoundValue
+
+        /*! @brief The encoding and decoding of a logical value. */
+        template
+            <>
+        struct BoundValue<bool>
+        {
+            /*! @brief The type tag for Messages. */
+            static constexpr DataKind   kTypeTag{DataKind::OtherMessageExpectedOtherValue};
+
+            /*! @brief Read a logical value.
+             @param[in,out] reader The source of the encoded values.
+             @param[out] outValue The value that was read. */
+            static void
+            read
+                (BoundReader &  reader,
+                 bool &         outValue)
+            {
+                outValue = reader.readLogical();
+            }
+
+            /*! @brief Write a logical value, as done by Logical::writeToMessage().
+             @param[in,out] outMessage The Message to be appended to.
+             @param[in] inValue The value to be written. */
+            static void
+            write
+                (Message &      outMessage,
+                 const bool     inValue)
+            {
+                DataKind    stuff{DataKind::Other | DataKind::OtherMiscellaneous | DataKind::OtherMiscellaneousTypeLogical |
+                                    (inValue ? DataKind::OtherMiscellaneousLogicalTrueValue :
+                                     DataKind::OtherMiscellaneousLogicalFalseValue)};
+
+                outMessage.appendBytes(&stuff, sizeof(stuff));
+            }
+
+        }; // BoundValue<bool>
+
+        /*! @brief The encoding and decoding of an integer value.
+         @tparam Type_ The type of value. */
+        template
+            <typename   Type_>
+        struct BoundValue<Type_, std::enable_if_t<std::is_integral<Type_>::value && (! std::is_same<Type_, bool>::value)>>
+        {
+            /*! @brief The type tag for Messages. */
+            static constexpr DataKind   kTypeTag{DataKind::OtherMessageExpectedIntegerValue};
+
+            /*! @brief Read an integer value.
+             @param[in,out] reader The source of the encoded values.
+             @param[out] outValue The value that was read. */
+            static void
+            read
+                (BoundReader &  reader,
+                 Type_ &        outValue)
+            {
+                outValue = StaticCast(Type_, reader.readInt64());
+            }
+
+            /*! @brief Write an integer value, as done by Integer::writeToMessage().
+             @param[in,out] outMessage The Message to be appended to.
+             @param[in] inValue The value to be written. */
+            static void
+            write
+                (Message &      outMessage,
+                 const Type_    inValue)
+            {
+                Value::writeInt64ToMessage(outMessage, StaticCast(int64_t, inValue));
+            }
+
+        }; // BoundValue<integral>
+
+        /*! @brief The encoding and decoding of a floating-point value.
+         @tparam Type_ The type of value. */
+        template
+            <typename   Type_>
+        struct BoundValue<Type_, std::enable_if_t<std::is_floating_point<Type_>::value>>
+        {
+            /*! @brief The type tag for Messages. */
+            static constexpr DataKind   kTypeTag{DataKind::OtherMessageExpectedDoubleValue};
+
+            /*! @brief Read a floating-point value.
+             @param[in,out] reader The source of the encoded values.
+             @param[out] outValue The value that was read. */
+            static void
+            read
+                (BoundReader &  reader,
+                 Type_ &        outValue)
+            {
+                outValue = StaticCast(Type_, reader.readDouble());
+            }
+
+            /*! @brief Write a floating-point value, as done by Double::writeToMessage().
+             @param[in,out] outMessage The Message to be appended to.
+             @param[in] inValue The value to be written. */
+            static void
+            write
+                (Message &      outMessage,
+                 const Type_    inValue)
+            {
+                if (outMessage.usesSinglePrecision())
+                {
+                    std::queue<double>  values;
+
+                    values.push(StaticCast(double, inValue));
+                    Double::writeValuesToMessage(values, outMessage);
+                }
+                else
+                {
+                    NumberAsBytes   numBuff;
+                    DataKind        stuff{DataKind::Double | DataKind::DoubleShortCount |
+                                            ((1 - kDataKindDoubleShortCountMinValue) & DataKind::DoubleShortCountMask)};
+
+                    D2B(StaticCast(double, inValue), numBuff);
+                    outMessage.appendBytes(&stuff, sizeof(stuff));
+                    outMessage.appendBytes(numBuff, sizeof(numBuff));
+                }
+            }
+
+        }; // BoundValue<floating-point>
+
+        /*! @brief The encoding and decoding of a string value. */
+        template
+            <>
+        struct BoundValue<std::string>
+        {
+            /*! @brief The type tag for Messages. */
+            static constexpr DataKind   kTypeTag{DataKind::OtherMessageExpectedStringOrBlobValue};
+
+            /*! @brief Read a string value.
+             @param[in,out] reader The source of the encoded values.
+             @param[out] outValue The value that was read. */
+            static void
+            read
+                (BoundReader &  reader,
+                 std::string &  outValue)
+            {
+                reader.readString(outValue);
+            }
+
+            /*! @brief Write a string value, as done by String::writeToMessage().
+             @param[in,out] outMessage The Message to be appended to.
+             @param[in] inValue The value to be written. */
+            static void
+            write
+                (Message &              outMessage,
+                 const std::string &    inValue)
+            {
+                WriteBoundString(outMessage, inValue.data(), inValue.length());
+            }
+
+        }; // BoundValue<std::string>
+
+        /*! @brief The encoding and decoding of a sequence of values.
+         @tparam Element_ The type of the elements of the sequence. */
+        template
+            <typename   Element_>
+        struct BoundValue<std::vector<Element_>>
+        {
+            /*! @brief The type tag for Messages. */
+            static constexpr DataKind   kTypeTag{DataKind::OtherMessageExpectedOtherValue};
+
+            /*! @brief Read a sequence of values.
+             @param[in,out] reader The source of the encoded values.
+             @param[out] outValue The values that were read. */
+            static void
+            read
+                (BoundReader &              reader,
+                 std::vector<Element_> &    outValue)
+            {
+                size_t  count{reader.readContainerStart(DataKind::OtherContainerTypeArray)};
+
+                outValue.clear();
+                if (reader.isOK() && (0 < count))
+                {
+                    // Each element takes at least one byte, so the count cannot exceed what is left.
+                    outValue.reserve(std::min(count, reader.getRemaining()));
+                    for (size_t ii = 0; reader.isOK() && (count > ii); ++ii)
+                    {
+                        Element_    element{};
+
+                        BoundValue<Element_>::read(reader, element);
+                        outValue.push_back(std::move(element));
+                    }
+                    reader.expectByte(DataKind::Other | DataKind::OtherContainerEnd | DataKind::OtherContainerTypeArray |
+                                      DataKind::OtherContainerNonEmptyValue);
+                }
+            }
+
+            /*! @brief Write a sequence of values, as done by Array::writeToMessage().
+             Note that floating-point values are gathered into a single sequence.
+             @param[in,out] outMessage The Message to be appended to.
+             @param[in] inValue The values to be written. */
+            static void
+            write
+                (Message &                      outMessage,
+                 const std::vector<Element_> &  inValue)
+            {
+                if (0 < inValue.size())
+                {
+                    static const DataKind   startArray{DataKind::Other | DataKind::OtherContainerStart |
+                                                        DataKind::OtherContainerTypeArray |
+                                                        DataKind::OtherContainerNonEmptyValue};
+                    static const DataKind   endArray{DataKind::Other | DataKind::OtherContainerEnd |
+                                                        DataKind::OtherContainerTypeArray |
+                                                        DataKind::OtherContainerNonEmptyValue};
+
+                    outMessage.appendBytes(&startArray, sizeof(startArray));
+                    Value::writeInt64ToMessage(outMessage, StaticCast(int, inValue.size()) + kDataKindIntegerShortValueMinValue - 1);
+                    if constexpr (std::is_floating_point<Element_>::value)
+                    {
+                        std::queue<double>  doublesSeen;
+
+                        for (auto walker : inValue)
+                        {
+                            doublesSeen.push(StaticCast(double, walker));
+                        }
+                        Double::writeValuesToMessage(doublesSeen, outMessage);
+                    }
+                    else
+                    {
+                        for (const auto & walker : inValue)
+                        {
+                            BoundValue<Element_>::write(outMessage, walker);
+                        }
+                    }
+                    outMessage.appendBytes(&endArray, sizeof(endArray));
+                }
+                else
+                {
+                    static const DataKind   stuff[]
+                    {
+                        DataKind::Other | DataKind::OtherContainerStart | DataKind::OtherContainerTypeArray |
+                          DataKind::OtherContainerEmptyValue,
+                        DataKind::Other | DataKind::OtherContainerEnd | DataKind::OtherContainerTypeArray |
+                          DataKind::OtherContainerEmptyValue
+                    };
+
+                    outMessage.appendBytes(stuff, sizeof(stuff));
+                }
+            }
+
+        }; // BoundValue<std::vector>
+
+    } // internal_
+
+    /*! @brief Read a value from a Message, without building any Values.
+     The Message must contain exactly one value, with the same shape as the C++ type. Map keys are recorded in,
+     or looked up in, the dictionary for Map keys of the Message, if it has one.
+     @tparam Type_ The type of the value, which is usually a bound struct.
+     @param[in] inMessage The Message to be read.
+     @param[out] outValue The value that was read.
+     @return @c true if the Message had the expected shape and @c false otherwise. */
+    template
+        <typename   Type_>
+    bool
+    DecodeBoundValue
+        (const Message &    inMessage,
+         Type_ &            outValue)
+    {
+        internal_::BoundReader  reader{inMessage};
+        DataKind                typeTag{internal_::BoundValue<Type_>::kTypeTag};
+
+        reader.expectByte(DataKind::StartOfMessageValue | DataKind::OtherMessageNonEmptyValue | typeTag);
+        internal_::BoundValue<Type_>::read(reader, outValue);
+        reader.expectByte(DataKind::EndOfMessageValue | DataKind::OtherMessageNonEmptyValue | typeTag);
+        return (reader.isOK() && reader.atEnd());
+    }
+
+    /*! @brief Set the contents of a Message from a value, without building any Values.
+     The Message is identical to that produced by Message::setValue() for the equivalent Value, including Map keys
+     that are sent as references to the dictionary for Map keys of the Message.
+     @tparam Type_ The type of the value, which is usually a bound struct.
+     @param[in,out] outMessage The Message to be filled, which must be open for writing.
+     @param[in] inValue The value to be written.
+     @return The Message object so that cascading can be done. */
+    template
+        <typename   Type_>
+    Message &
+    EncodeBoundValue
+        (Message &      outMessage,
+         const Type_ &  inValue)
+    {
+        if (outMessage.isOpenForWriting())
+        {
+            DataKind    typeTag{internal_::BoundValue<Type_>::kTypeTag};
+            DataKind    headerByte{DataKind::StartOfMessageValue | DataKind::OtherMessageNonEmptyValue | typeTag};
+            DataKind    trailerByte{DataKind::EndOfMessageValue | DataKind::OtherMessageNonEmptyValue | typeTag};
+
+            outMessage.setEncodedValue(ReinterpretCast(CPtr(uint8_t), &headerByte), sizeof(headerByte));
+            internal_::BoundValue<Type_>::write(outMessage, inValue);
+            outMessage.appendBytes(&trailerByte, sizeof(trailerByte));
+        }
+        return outMessage;
+    }
+
+} // nImO
+
+/*! @brief Describe a field of a bound struct.
+ @param[in] Struct_ The type of the struct.
+ @param[in] field_ The name of the field. */
+# define NIMO_BIND_FIELD(Struct_, field_) nImO::BindField(# field_, &Struct_::field_)
+
+/*! @brief Bind a struct, so that it can be written to and read from Messages.
+ Note that this must be used at global scope.
+ @param[in] Struct_ The type of the struct.
+ @param[in] ... The fields of the struct, described with NIMO_BIND_FIELD. */
+# define NIMO_BIND_STRUCT(Struct_, ...) \
+    template <>\
+    struct nImO::StructBinding<Struct_>\
+    {\
+        static constexpr auto   kFields{std::make_tuple(__VA_ARGS__)};\
+    }
+
+#endif // not defined(nImOstructBinding_H_)
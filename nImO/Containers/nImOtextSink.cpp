@@ -0,0 +1,244 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOtextSink.cpp
+//
+//  Project:    nImO
+//
+//  Contains:   The class definitions for destinations of printed text.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+#include <Containers/nImOtextSink.h>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if MAC_OR_LINUX_OR_BSD_
+# include <unistd.h>
+#else // not MAC_OR_LINUX_OR_BSD_
+# include <io.h>
+#endif // not MAC_OR_LINUX_OR_BSD_
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definitions for destinations of printed text. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace nImO;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+nImO::TextSink::TextSink
+    (void)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // nImO::TextSink::TextSink
+
+nImO::TextSink::~TextSink
+    (void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // nImO::TextSink::~TextSink
+
+nImO::DescriptorTextSink::DescriptorTextSink
+    (const int  outDescriptor) :
+        inherited{}, _outDescriptor{outDescriptor}
+{
+    ODL_ENTER(); //####
+    ODL_I1(outDescriptor); //####
+    ODL_EXIT_P(this); //####
+} // nImO::DescriptorTextSink::DescriptorTextSink
+
+nImO::SpanTextSink::SpanTextSink
+    (Ptr(uint8_t)   base,
+     const size_t   capacity) :
+        inherited{}, _base{base}, _capacity{capacity}
+{
+    ODL_ENTER(); //####
+    ODL_P1(base); //####
+    ODL_I1(capacity); //####
+    ODL_EXIT_P(this); //####
+} // nImO::SpanTextSink::SpanTextSink
+
+nImO::StreamTextSink::StreamTextSink
+    (std::ostream & outStream) :
+        inherited{}, _outStream{outStream}
+{
+    ODL_ENTER(); //####
+    ODL_P1(&outStream); //####
+    ODL_EXIT_P(this); //####
+} // nImO::StreamTextSink::StreamTextSink
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+nImO::TextSink::flush
+    (void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT_B(! _failed); //####
+    return (! _failed);
+} // nImO::TextSink::flush
+
+bool
+nImO::DescriptorTextSink::write
+    (CPtr(uint8_t)  data,
+     const size_t   numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(data); //####
+    ODL_I1(numBytes); //####
+    CPtr(uint8_t)   walker{data};
+
+    for (size_t toWrite = numBytes; (! _failed) && (0 < toWrite); )
+    {
+#if MAC_OR_LINUX_OR_BSD_
+        auto    written{::write(_outDescriptor, walker, toWrite)};
+#else // not MAC_OR_LINUX_OR_BSD_
+        auto    written{_write(_outDescriptor, walker, StaticCast(unsigned int, toWrite))};
+#endif // not MAC_OR_LINUX_OR_BSD_
+
+        if (0 < written)
+        {
+            walker += written;
+            toWrite -= written;
+        }
+        else
+        {
+            if ((0 > written) && (EINTR == errno))
+            {
+                ODL_LOG("((0 > written) && (EINTR == errno))"); //####
+            }
+            else
+            {
+                ODL_LOG("! ((0 > written) && (EINTR == errno))"); //####
+                _failed = true;
+            }
+        }
+    }
+    ODL_OBJEXIT_B(! _failed); //####
+    return (! _failed);
+} // nImO::DescriptorTextSink::write
+
+bool
+nImO::SpanTextSink::write
+    (CPtr(uint8_t)  data,
+     const size_t   numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(data); //####
+    ODL_I1(numBytes); //####
+    if (! _failed)
+    {
+        ODL_LOG("(! _failed)"); //####
+        if ((_capacity - _length) < numBytes)
+        {
+            ODL_LOG("((_capacity - _length) < numBytes)"); //####
+            _failed = true;
+        }
+        else
+        {
+            ODL_LOG("! ((_capacity - _length) < numBytes)"); //####
+            memcpy(_base + _length, data, numBytes);
+            _length += numBytes;
+        }
+    }
+    ODL_OBJEXIT_B(! _failed); //####
+    return (! _failed);
+} // nImO::SpanTextSink::write
+
+bool
+nImO::StreamTextSink::flush
+    (void)
+{
+    ODL_OBJENTER(); //####
+    if (! _failed)
+    {
+        ODL_LOG("(! _failed)"); //####
+        _outStream.flush();
+        _failed = _outStream.fail();
+    }
+    ODL_OBJEXIT_B(! _failed); //####
+    return (! _failed);
+} // nImO::StreamTextSink::flush
+
+bool
+nImO::StreamTextSink::write
+    (CPtr(uint8_t)  data,
+     const size_t   numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(data); //####
+    ODL_I1(numBytes); //####
+    if (! _failed)
+    {
+        ODL_LOG("(! _failed)"); //####
+        _outStream.write(ReinterpretCast(CPtr(char), data), StaticCast(std::streamsize, numBytes));
+        _failed = _outStream.fail();
+    }
+    ODL_OBJEXIT_B(! _failed); //####
+    return (! _failed);
+} // nImO::StreamTextSink::write
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
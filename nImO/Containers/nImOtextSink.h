@@ -0,0 +1,372 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/Containers/nImOtextSink.h
+//
+//  Project:    nImO
+//
+//  Contains:   The class declarations for destinations of printed text.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+#if (! defined(nImOtextSink_H_))
+# define nImOtextSink_H_ /* Header guard */
+
+# include <nImOcommon.h>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declarations for destinations of printed text. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace nImO
+{
+    /*! @brief A destination for text that is produced a piece at a time.
+     A StringBuffer that is attached to a TextSink hands its contents to the sink whenever a chunk
+     fills up, so that printing a large Value does not need to hold all of its text in memory. */
+    class TextSink
+    {
+
+        public :
+            // Public type definitions.
+
+        protected :
+            // Protected type definitions.
+
+        private :
+            // Private type definitions.
+
+        public :
+            // Public methods.
+
+            /*! @brief The destructor. */
+            virtual
+            ~TextSink
+                (void);
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            TextSink
+                (const TextSink &   other) = delete;
+
+            /*! @brief The move constructor.
+             @param[in] other The object to be moved. */
+            TextSink
+                (TextSink &&    other) = delete;
+
+            /*! @brief Complete the sending of any text that has been written.
+             @return @c true if the text was sent. */
+            virtual bool
+            flush
+                (void);
+
+            /*! @brief Return @c true if an attempt to send text failed.
+             @return @c true if an attempt to send text failed. */
+            inline bool
+            hasFailed
+                (void)
+                const
+            {
+                return _failed;
+            }
+
+            /*! @brief The copy assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            TextSink &
+            operator=
+                (const TextSink &   other) = delete;
+
+            /*! @brief The move assignment operator.
+             @param[in] other The object to be moved.
+             @return The updated object. */
+            TextSink &
+            operator=
+                (TextSink &&    other) = delete;
+
+            /*! @brief Send some text.
+             @param[in] data The text to be sent.
+             @param[in] numBytes The number of bytes to be sent.
+             @return @c true if the text was sent. */
+            virtual bool
+            write
+                (CPtr(uint8_t)  data,
+                 const size_t   numBytes) = 0;
+
+            /*! @brief Send some text.
+             @param[in] data The text to be sent.
+             @param[in] numBytes The number of bytes to be sent.
+             @return @c true if the text was sent. */
+            inline bool
+            write
+                (CPtr(char)     data,
+                 const size_t   numBytes)
+            {
+                return write(ReinterpretCast(CPtr(uint8_t), data), numBytes);
+            }
+
+        protected :
+            // Protected methods.
+
+            /*! @brief The constructor. */
+            TextSink
+                (void);
+
+        private :
+            // Private methods.
+
+        public :
+            // Public fields.
+
+        protected :
+            // Protected fields.
+
+            /*! @brief @c true if an attempt to send text failed. */
+            bool    _failed{false};
+
+        private :
+            // Private fields.
+
+    }; // TextSink
+
+    /*! @brief A TextSink that sends its text to a file descriptor. */
+    class DescriptorTextSink final : public TextSink
+    {
+
+        public :
+            // Public type definitions.
+
+        protected :
+            // Protected type definitions.
+
+        private :
+            // Private type definitions.
+
+            /*! @brief The class that this class is derived from. */
+            using inherited = TextSink;
+
+        public :
+            // Public methods.
+
+            /*! @brief The constructor.
+             @param[in] outDescriptor The file descriptor to be written to. */
+            explicit DescriptorTextSink
+                (const int  outDescriptor);
+
+            /*! @brief Send some text.
+             @param[in] data The text to be sent.
+             @param[in] numBytes The number of bytes to be sent.
+             @return @c true if the text was sent. */
+            bool
+            write
+                (CPtr(uint8_t)  data,
+                 const size_t   numBytes)
+                override;
+
+            using inherited::write;
+
+        protected :
+            // Protected methods.
+
+        private :
+            // Private methods.
+
+        public :
+            // Public fields.
+
+        protected :
+            // Protected fields.
+
+        private :
+            // Private fields.
+
+            /*! @brief The file descriptor to be written to. */
+            int _outDescriptor{-1};
+
+    }; // DescriptorTextSink
+
+    /*! @brief A TextSink that places its text in a caller-supplied block of memory. */
+    class SpanTextSink final : public TextSink
+    {
+
+        public :
+            // Public type definitions.
+
+        protected :
+            // Protected type definitions.
+
+        private :
+            // Private type definitions.
+
+            /*! @brief The class that this class is derived from. */
+            using inherited = TextSink;
+
+        public :
+            // Public methods.
+
+            /*! @brief The constructor.
+             @param[in] base The start of the memory to be written to.
+             @param[in] capacity The number of bytes that can be written. */
+            SpanTextSink
+                (Ptr(uint8_t)   base,
+                 const size_t   capacity);
+
+            /*! @brief Return the number of bytes that have been written.
+             @return The number of bytes that have been written. */
+            inline size_t
+            getLength
+                (void)
+                const
+            {
+                return _length;
+            }
+
+            /*! @brief Start writing at the beginning of the memory again. */
+            inline void
+            reset
+                (void)
+            {
+                _length = 0;
+                _failed = false;
+            }
+
+            /*! @brief Send some text.
+             Text that does not fit in the remaining memory is dropped and the sink is marked as failed.
+             @param[in] data The text to be sent.
+             @param[in] numBytes The number of bytes to be sent.
+             @return @c true if the text was sent. */
+            bool
+            write
+                (CPtr(uint8_t)  data,
+                 const size_t   numBytes)
+                override;
+
+            using inherited::write;
+
+        protected :
+            // Protected methods.
+
+        private :
+            // Private methods.
+
+        public :
+            // Public fields.
+
+        protected :
+            // Protected fields.
+
+        private :
+            // Private fields.
+
+            /*! @brief The start of the memory to be written to. */
+            Ptr(uint8_t)    _base{nullptr};
+
+            /*! @brief The number of bytes that can be written. */
+            size_t  _capacity{0};
+
+            /*! @brief The number of bytes that have been written. */
+            size_t  _length{0};
+
+    }; // SpanTextSink
+
+    /*! @brief A TextSink that sends its text to a stream. */
+    class StreamTextSink final : public TextSink
+    {
+
+        public :
+            // Public type definitions.
+
+        protected :
+            // Protected type definitions.
+
+        private :
+            // Private type definitions.
+
+            /*! @brief The class that this class is derived from. */
+            using inherited = TextSink;
+
+        public :
+            // Public methods.
+
+            /*! @brief The constructor.
+             @param[in] outStream The stream to be written to. */
+            explicit StreamTextSink
+                (std::ostream & outStream);
+
+            /*! @brief Complete the sending of any text that has been written.
+             @return @c true if the text was sent. */
+            bool
+            flush
+                (void)
+                override;
+
+            /*! @brief Send some text.
+             @param[in] data The text to be sent.
+             @param[in] numBytes The number of bytes to be sent.
+             @return @c true if the text was sent. */
+            bool
+            write
+                (CPtr(uint8_t)  data,
+                 const size_t   numBytes)
+                override;
+
+            using inherited::write;
+
+        protected :
+            // Protected methods.
+
+        private :
+            // Private methods.
+
+        public :
+            // Public fields.
+
+        protected :
+            // Protected fields.
+
+        private :
+            // Private fields.
+
+            /*! @brief The stream to be written to. */
+            std::ostream &  _outStream;
+
+    }; // StreamTextSink
+
+    /*! @brief A shorter name for a pointer to a TextSink that has a single owner. */
+    using UpTextSink = std::unique_ptr<TextSink>;
+
+} // nImO
+
+#endif // not defined(nImOtextSink_H_)
@@ -82,7 +82,7 @@
 
 nImO::GetInformationForAllConnectionsOnMachineResponseHandler::GetInformationForAllConnectionsOnMachineResponseHandler
     (void) :
-        inherited{}
+        inherited{true}
 {
     ODL_ENTER(); //####
     ODL_EXIT_P(this); //####
@@ -99,7 +99,6 @@ nImO::GetInformationForAllConnectionsOnMachineResponseHandler::doIt
     ODL_OBJENTER(); //####
     bool    okSoFar{false};
 
-    _result.clear();
     if (1 < stuff.size())
     {
         auto    infoVector{stuff[1]->asArray()};
@@ -82,7 +82,7 @@
 
 nImO::GetInformationForAllConnectionsOnNodeResponseHandler::GetInformationForAllConnectionsOnNodeResponseHandler
     (void) :
-        inherited{}
+        inherited{true}
 {
     ODL_ENTER(); //####
     ODL_EXIT_P(this); //####
@@ -99,7 +99,6 @@ nImO::GetInformationForAllConnectionsOnNodeResponseHandler::doIt
     ODL_OBJENTER(); //####
     bool    okSoFar{false};
 
-    _result.clear();
     if (1 < stuff.size())
     {
         auto    infoVector{stuff[1]->asArray()};
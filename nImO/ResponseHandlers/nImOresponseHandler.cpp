@@ -85,6 +85,15 @@
 # pragma mark Constructors and Destructors
 #endif // defined(__APPLE__)
 
+nImO::ResponseHandler::ResponseHandler
+    (const bool acceptsStreamedResponse) :
+        _acceptsStreamedResponse{acceptsStreamedResponse}
+{
+    ODL_ENTER(); //####
+    ODL_B1(acceptsStreamedResponse); //####
+    ODL_EXIT_P(this); //####
+} // nImO::ResponseHandler::ResponseHandler
+
 nImO::ResponseHandler::~ResponseHandler
     (void)
 {
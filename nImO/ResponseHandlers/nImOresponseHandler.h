@@ -86,7 +86,18 @@ namespace nImO
             ResponseHandler
                 (ResponseHandler &&    other) = delete;
 
+            /*! @brief Return @c true if the handler can process a response that is sent as a series of batches.
+             @return @c true if the handler can process a response that is sent as a series of batches. */
+            inline bool
+            acceptsStreamedResponse
+                (void)
+                const
+            {
+                return _acceptsStreamedResponse;
+            }
+
             /*! @brief Handle the response, returning @c true if successful.
+             For a streamed response, this is called once for each batch.
              @param[in] stuff The data included in the response.
              @return @c true if the response was correctly structured. */
             virtual bool
@@ -110,9 +121,10 @@ namespace nImO
         protected :
             // Protected methods.
 
-            /*! @brief The constructor. */
+            /*! @brief The constructor.
+             @param[in] acceptsStreamedResponse @c true if the handler can process a response that is sent as a series of batches. */
             ResponseHandler
-                (void) = default;
+                (const bool acceptsStreamedResponse = false);
 
         private :
             // Private methods.
@@ -126,6 +138,9 @@ namespace nImO
         private :
             // Private fields.
 
+            /*! @brief @c true if the handler can process a response that is sent as a series of batches. */
+            bool    _acceptsStreamedResponse{false};
+
     }; // ResponseHandler
 
 } // nImO
@@ -40,6 +40,7 @@
 
 #include <BasicTypes/nImOaddress.h>
 #include <BasicTypes/nImOinteger.h>
+#include <BasicTypes/nImOlogical.h>
 #include <BasicTypes/nImOstring.h>
 
 //#include <odlEnable.h>
@@ -118,6 +119,44 @@ nImO::SetUpReceiverResponseHandler::doIt
                 {
                     _result._address = addressPtr->getAddressValue();
                     _result._port = portPtr->getIntegerValue();
+                    // Receivers that do not support a dictionary for Map keys do not report it.
+                    if (2 < infoArray->size())
+                    {
+                        auto    keyDictionaryPtr{(*infoArray)[2]->asLogical()};
+
+                        _keyDictionary = ((nullptr != keyDictionaryPtr) && keyDictionaryPtr->getValue());
+                    }
+                    // Receivers that can not reconstruct delta-encoded Values do not report it.
+                    if (3 < infoArray->size())
+                    {
+                        auto    acceptsDeltasPtr{(*infoArray)[3]->asLogical()};
+
+                        _acceptsDeltas = ((nullptr != acceptsDeltasPtr) && acceptsDeltasPtr->getValue());
+                    }
+                    // Receivers that can only handle MIME do not report binary framing.
+                    if (4 < infoArray->size())
+                    {
+                        auto    acceptsFramesPtr{(*infoArray)[4]->asLogical()};
+
+                        _acceptsFrames = ((nullptr != acceptsFramesPtr) && acceptsFramesPtr->getValue());
+                    }
+                    // Receivers that can not expand compressed Messages do not report compression.
+                    if (5 < infoArray->size())
+                    {
+                        auto    acceptsCompressionPtr{(*infoArray)[5]->asLogical()};
+
+                        _acceptsCompression = ((nullptr != acceptsCompressionPtr) && acceptsCompressionPtr->getValue());
+                    }
+                    // Receivers that can not use local transports do not report a local endpoint name.
+                    if (6 < infoArray->size())
+                    {
+                        auto    localEndpointNamePtr{(*infoArray)[6]->asString()};
+
+                        if (nullptr != localEndpointNamePtr)
+                        {
+                            _localEndpointName = localEndpointNamePtr->getValue();
+                        }
+                    }
                     okSoFar = true;
                     ODL_B1(okSoFar); //####
                 }
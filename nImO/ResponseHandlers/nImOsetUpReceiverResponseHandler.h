@@ -79,6 +79,36 @@ namespace nImO
             SetUpReceiverResponseHandler
                 (void);
 
+            /*! @brief Return @c true if the receiver can handle Messages in binary frames.
+             @return @c true if the receiver can handle Messages in binary frames. */
+            inline bool
+            acceptsBinaryFraming
+                (void)
+                const
+            {
+                return _acceptsFrames;
+            }
+
+            /*! @brief Return @c true if the receiver can expand compressed Messages.
+             @return @c true if the receiver can expand compressed Messages. */
+            inline bool
+            acceptsCompression
+                (void)
+                const
+            {
+                return _acceptsCompression;
+            }
+
+            /*! @brief Return @c true if the receiver can reconstruct delta-encoded Values.
+             @return @c true if the receiver can reconstruct delta-encoded Values. */
+            inline bool
+            acceptsDeltaEncoding
+                (void)
+                const
+            {
+                return _acceptsDeltas;
+            }
+
             /*! @brief Handle the response, returning @c true if successful.
              @param[in] stuff The data included in the response.
              @return @c true if the response was correctly structured. */
@@ -87,6 +117,17 @@ namespace nImO
                 (const Array &  stuff)
                 override;
 
+            /*! @brief Return the name of the receiver's shared memory segment or the path of its local socket.
+             @return The name of the receiver's shared memory segment or the path of its local socket, or an empty
+             string if it does not use a local transport. */
+            inline const std::string &
+            localEndpointName
+                (void)
+                const
+            {
+                return _localEndpointName;
+            }
+
             /*! @brief Return the received value.
              @return The received value. */
             inline const AddressInfo &
@@ -97,6 +138,16 @@ namespace nImO
                 return _result;
             }
 
+            /*! @brief Return @c true if the receiver agreed to use a dictionary for Map keys.
+             @return @c true if the receiver agreed to use a dictionary for Map keys. */
+            inline bool
+            usesKeyDictionary
+                (void)
+                const
+            {
+                return _keyDictionary;
+            }
+
         protected :
             // Protected methods.
 
@@ -115,6 +166,21 @@ namespace nImO
             /*! @brief The received value. */
             AddressInfo _result{};
 
+            /*! @brief @c true if the receiver agreed to use a dictionary for Map keys. */
+            bool    _keyDictionary{false};
+
+            /*! @brief @c true if the receiver can reconstruct delta-encoded Values. */
+            bool    _acceptsDeltas{false};
+
+            /*! @brief @c true if the receiver can handle Messages in binary frames. */
+            bool    _acceptsFrames{false};
+
+            /*! @brief @c true if the receiver can expand compressed Messages. */
+            bool    _acceptsCompression{false};
+
+            /*! @brief The name of the receiver's shared memory segment or the path of its local socket, if it has one. */
+            std::string _localEndpointName{};
+
     }; // SetUpReceiverResponseHandler
 
 } // nImO
@@ -40,6 +40,7 @@
 
 #include <BasicTypes/nImOaddress.h>
 #include <BasicTypes/nImOinteger.h>
+#include <BasicTypes/nImOlogical.h>
 #include <BasicTypes/nImOstring.h>
 
 //#include <odlEnable.h>
@@ -118,6 +119,20 @@ nImO::SetUpSenderResponseHandler::doIt
                 {
                     _result._address = addressPtr->getAddressValue();
                     _result._port = portPtr->getIntegerValue();
+                    // Senders that do not support delta encoding do not report it.
+                    if (2 < infoArray->size())
+                    {
+                        auto    deltaEncodingPtr{(*infoArray)[2]->asLogical()};
+
+                        _deltaEncoding = ((nullptr != deltaEncodingPtr) && deltaEncodingPtr->getValue());
+                    }
+                    // Senders that only send MIME do not report binary framing.
+                    if (3 < infoArray->size())
+                    {
+                        auto    binaryFramingPtr{(*infoArray)[3]->asLogical()};
+
+                        _binaryFraming = ((nullptr != binaryFramingPtr) && binaryFramingPtr->getValue());
+                    }
                     okSoFar = true;
                     ODL_B1(okSoFar); //####
                 }
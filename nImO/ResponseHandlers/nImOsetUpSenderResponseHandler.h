@@ -97,6 +97,26 @@ namespace nImO
                 return _result;
             }
 
+            /*! @brief Return @c true if the sender will send Messages in binary frames.
+             @return @c true if the sender will send Messages in binary frames. */
+            inline bool
+            usesBinaryFraming
+                (void)
+                const
+            {
+                return _binaryFraming;
+            }
+
+            /*! @brief Return @c true if the sender will send delta-encoded Values.
+             @return @c true if the sender will send delta-encoded Values. */
+            inline bool
+            usesDeltaEncoding
+                (void)
+                const
+            {
+                return _deltaEncoding;
+            }
+
         protected :
             // Protected methods.
 
@@ -115,6 +135,12 @@ namespace nImO
             /*! @brief The received value. */
             AddressInfo _result{false};
 
+            /*! @brief @c true if the sender will send delta-encoded Values. */
+            bool    _deltaEncoding{false};
+
+            /*! @brief @c true if the sender will send Messages in binary frames. */
+            bool    _binaryFraming{false};
+
     }; // SetUpSenderResponseHandler
 
 } // nImO
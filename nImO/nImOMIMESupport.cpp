@@ -35,23 +35,19 @@
 //  Created:    2022-12-10
 //
 //--------------------------------------------------------------------------------------------------
-
 #include <nImOMIMESupport.h>
 
 #include <string>
+#if defined(__AVX2__)
+# include <immintrin.h>
+#elif defined(__SSSE3__)
+# include <tmmintrin.h>
+# define nImO_USE_SSSE3_ /* */
+#endif // defined(__SSSE3__)
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
-#if defined(__APPLE__)
-# pragma clang diagnostic push
-# pragma clang diagnostic ignored "-Wdeprecated-declarations"
-#endif // defined(__APPLE__)
-#include <boost/algorithm/string.hpp>
-#if defined(__APPLE__)
-# pragma clang diagnostic pop
-#endif // defined(__APPLE__)
-
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -75,19 +71,46 @@
 constexpr char  kEqualsChar{'='};
 
 /*! @brief The set of characters to be used with MIME data. */
-static const char   kMIMECharSet[]{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
-
-/*! @brief The 'plus' character that is used in MIME data.
- This is a convenience declaration to simply validity checks. */
-constexpr char  kPlusChar{'+'};
+constexpr char  kMIMECharSet[]{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
 
-/*! @brief The 'slash' character that is used in MIME data.
- This is a convenience declaration to simply validity checks. */
-constexpr char  kSlashChar{'/'};
+/*! @brief The value in the decoding table for characters that are not valid in MIME data. */
+constexpr uint8_t   kInvalidMIMEValue{0xFF};
 
 /*! @brief The maximum line length when converting to a MIME representation of data. */
 constexpr size_t    kMaxMIMELine{72}; // Must be divisible by 4!
 
+/*! @brief The number of bytes that are represented by a full line of MIME data. */
+constexpr size_t    kMaxMIMELineBytes{(kMaxMIMELine / 4) * 3};
+
+/*! @brief The extra space needed after decoded bytes, as the vectorized decoder stores whole registers. */
+constexpr size_t    kMIMEDecodeSlack{32};
+
+/*! @brief The table used to convert MIME characters into their six-bit values. */
+struct MIMEDecodeTable final
+{
+    /*! @brief The six-bit value for each character, or kInvalidMIMEValue. */
+    uint8_t _values[256];
+
+    /*! @brief The constructor. */
+    constexpr MIMEDecodeTable
+        (void) :
+            _values{}
+    {
+        for (size_t ii = 0; ii < 256; ++ii)
+        {
+            _values[ii] = kInvalidMIMEValue;
+        }
+        for (size_t ii = 0; ii < 64; ++ii)
+        {
+            _values[StaticCast(uint8_t, kMIMECharSet[ii])] = StaticCast(uint8_t, ii);
+        }
+    }
+
+}; // MIMEDecodeTable
+
+/*! @brief The six-bit values of the MIME characters. */
+static constexpr MIMEDecodeTable    kMIMEDecodeTable{};
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -96,16 +119,320 @@ constexpr size_t    kMaxMIMELine{72}; // Must be divisible by 4!
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
-/*! @brief Check if a character can be used for MIME data.
- @param[in] ch The character to be checked.
- @return @c true if the character is valid in MIME data. */
+#if defined(__AVX2__)
+/*! @brief Convert 32 MIME characters into their six-bit values.
+ @param[in] chars The characters to be converted.
+ @param[out] values The six-bit values of the characters.
+ @return @c true if all the characters are valid in MIME data. */
+static inline bool
+charsToValues
+    (const __m256i  chars,
+     __m256i &      values)
+{
+    // Bytes with the high bit set compare as negative, so they fall outside every range.
+    const __m256i   upperRange{_mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('A' - 1)),
+                                                _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), chars))};
+    const __m256i   lowerRange{_mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('a' - 1)),
+                                                _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), chars))};
+    const __m256i   digitRange{_mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('0' - 1)),
+                                                _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), chars))};
+    const __m256i   isPlus{_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('+'))};
+    const __m256i   isSlash{_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('/'))};
+    const __m256i   valid{_mm256_or_si256(_mm256_or_si256(upperRange, lowerRange),
+                                          _mm256_or_si256(digitRange, _mm256_or_si256(isPlus, isSlash)))};
+    const __m256i   shift{_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(upperRange, _mm256_set1_epi8(-'A')),
+                                                          _mm256_and_si256(lowerRange, _mm256_set1_epi8(26 - 'a'))),
+                                          _mm256_or_si256(_mm256_and_si256(digitRange, _mm256_set1_epi8(52 - '0')),
+                                                          _mm256_or_si256(_mm256_and_si256(isPlus, _mm256_set1_epi8(62 - '+')),
+                                                                          _mm256_and_si256(isSlash, _mm256_set1_epi8(63 - '/')))))};
+
+    values = _mm256_add_epi8(chars, shift);
+    return (-1 == _mm256_movemask_epi8(valid));
+} // charsToValues
+
+/*! @brief Convert 24 bytes, held as 12 bytes at the start of each 128-bit lane, into 32 MIME characters.
+ @param[in] bytes The bytes to be converted.
+ @return The MIME characters. */
+static inline __m256i
+bytesToChars
+    (const __m256i  bytes)
+{
+    // Spread each group of three bytes over four bytes, then move each six-bit field into its own byte.
+    const __m256i   spread{_mm256_shuffle_epi8(bytes, _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                                                       1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10))};
+    const __m256i   highFields{_mm256_mulhi_epu16(_mm256_and_si256(spread, _mm256_set1_epi32(0x0FC0FC00)),
+                                                  _mm256_set1_epi32(0x04000040))};
+    const __m256i   lowFields{_mm256_mullo_epi16(_mm256_and_si256(spread, _mm256_set1_epi32(0x003F03F0)),
+                                                 _mm256_set1_epi32(0x01000010))};
+    const __m256i   values{_mm256_or_si256(highFields, lowFields)};
+    // Map 0..25 to 13, 26..51 to 0, 52..61 to 1..10, 62 to 11 and 63 to 12, then look up the offset to add.
+    __m256i         offsetIndex{_mm256_subs_epu8(values, _mm256_set1_epi8(51))};
+
+    offsetIndex = _mm256_or_si256(offsetIndex, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), values),
+                                                                 _mm256_set1_epi8(13)));
+    const __m256i   offsets{_mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+                                             'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0)};
+
+    return _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, offsetIndex));
+} // bytesToChars
+#elif defined(nImO_USE_SSSE3_)
+/*! @brief Convert 16 MIME characters into their six-bit values.
+ @param[in] chars The characters to be converted.
+ @param[out] values The six-bit values of the characters.
+ @return @c true if all the characters are valid in MIME data. */
+static inline bool
+charsToValues
+    (const __m128i  chars,
+     __m128i &      values)
+{
+    // Bytes with the high bit set compare as negative, so they fall outside every range.
+    const __m128i   upperRange{_mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('A' - 1)),
+                                             _mm_cmplt_epi8(chars, _mm_set1_epi8('Z' + 1)))};
+    const __m128i   lowerRange{_mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('a' - 1)),
+                                             _mm_cmplt_epi8(chars, _mm_set1_epi8('z' + 1)))};
+    const __m128i   digitRange{_mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)),
+                                             _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)))};
+    const __m128i   isPlus{_mm_cmpeq_epi8(chars, _mm_set1_epi8('+'))};
+    const __m128i   isSlash{_mm_cmpeq_epi8(chars, _mm_set1_epi8('/'))};
+    const __m128i   valid{_mm_or_si128(_mm_or_si128(upperRange, lowerRange),
+                                       _mm_or_si128(digitRange, _mm_or_si128(isPlus, isSlash)))};
+    const __m128i   shift{_mm_or_si128(_mm_or_si128(_mm_and_si128(upperRange, _mm_set1_epi8(-'A')),
+                                                    _mm_and_si128(lowerRange, _mm_set1_epi8(26 - 'a'))),
+                                       _mm_or_si128(_mm_and_si128(digitRange, _mm_set1_epi8(52 - '0')),
+                                                    _mm_or_si128(_mm_and_si128(isPlus, _mm_set1_epi8(62 - '+')),
+                                                                 _mm_and_si128(isSlash, _mm_set1_epi8(63 - '/')))))};
+
+    values = _mm_add_epi8(chars, shift);
+    return (0xFFFF == _mm_movemask_epi8(valid));
+} // charsToValues
+
+/*! @brief Convert 12 bytes, held at the start of a register, into 16 MIME characters.
+ @param[in] bytes The bytes to be converted.
+ @return The MIME characters. */
+static inline __m128i
+bytesToChars
+    (const __m128i  bytes)
+{
+    // Spread each group of three bytes over four bytes, then move each six-bit field into its own byte.
+    const __m128i   spread{_mm_shuffle_epi8(bytes, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10))};
+    const __m128i   highFields{_mm_mulhi_epu16(_mm_and_si128(spread, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040))};
+    const __m128i   lowFields{_mm_mullo_epi16(_mm_and_si128(spread, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010))};
+    const __m128i   values{_mm_or_si128(highFields, lowFields)};
+    // Map 0..25 to 13, 26..51 to 0, 52..61 to 1..10, 62 to 11 and 63 to 12, then look up the offset to add.
+    __m128i         offsetIndex{_mm_subs_epu8(values, _mm_set1_epi8(51))};
+
+    offsetIndex = _mm_or_si128(offsetIndex, _mm_and_si128(_mm_cmplt_epi8(values, _mm_set1_epi8(26)), _mm_set1_epi8(13)));
+    const __m128i   offsets{_mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0)};
+
+    return _mm_add_epi8(values, _mm_shuffle_epi8(offsets, offsetIndex));
+} // bytesToChars
+#endif // defined(nImO_USE_SSSE3_)
+
+/*! @brief Convert as many whole blocks of MIME characters as possible with vector instructions.
+ Decoding stops at the first block that contains an invalid character, so that the caller can report it.
+ @param[in] chars The characters to be converted, whose length is a multiple of four.
+ @param[in] numChars The number of characters to be converted.
+ @param[in,out] outBytes Where to store the bytes, which is advanced past the stored bytes; there must be
+ kMIMEDecodeSlack bytes of space past the last byte.
+ @return The number of characters converted. */
+static size_t
+decodeMIMEBlocks
+    (CPtr(char)     chars,
+     const size_t   numChars,
+     Ptr(uint8_t) & outBytes)
+{
+    size_t  ii{0};
+
+#if defined(__AVX2__)
+    for ( ; (ii + 32) <= numChars; ii += 32)
+    {
+        __m256i values;
+
+        if (! charsToValues(_mm256_loadu_si256(ReinterpretCast(CPtr(__m256i), chars + ii)), values))
+        {
+            break;
+
+        }
+        // Combine each group of four six-bit values into three bytes, then close the gap between the lanes.
+        __m256i merged{_mm256_madd_epi16(_mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000))};
+
+        merged = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                              2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        merged = _mm256_permutevar8x32_epi32(merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+        _mm256_storeu_si256(ReinterpretCast(Ptr(__m256i), outBytes), merged);
+        outBytes += 24;
+    }
+#elif defined(nImO_USE_SSSE3_)
+    for ( ; (ii + 16) <= numChars; ii += 16)
+    {
+        __m128i values;
+
+        if (! charsToValues(_mm_loadu_si128(ReinterpretCast(CPtr(__m128i), chars + ii)), values))
+        {
+            break;
+
+        }
+        // Combine each group of four six-bit values into three bytes.
+        __m128i merged{_mm_madd_epi16(_mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000))};
+
+        merged = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        _mm_storeu_si128(ReinterpretCast(Ptr(__m128i), outBytes), merged);
+        outBytes += 12;
+    }
+#else // ! defined(nImO_USE_SSSE3_)
+    NIMO_UNUSED_VAR_(chars);
+    NIMO_UNUSED_VAR_(numChars);
+    NIMO_UNUSED_VAR_(outBytes);
+#endif // ! defined(nImO_USE_SSSE3_)
+    return ii;
+} // decodeMIMEBlocks
+
+/*! @brief Convert a line of MIME characters into the corresponding bytes.
+ Characters after a padding character are ignored.
+ @param[in] line The characters to be converted.
+ @param[in] length The number of characters in the line.
+ @param[in,out] outBytes Where to store the bytes, which is advanced past the stored bytes; there must be
+ kMIMEDecodeSlack bytes of space past the last byte.
+ @return @c true if the line contains only valid MIME characters and its length is a multiple of four. */
 static bool
-isValidMIMEChar
-    (const char ch)
+decodeMIMELine
+    (CPtr(char)     line,
+     const size_t   length,
+     Ptr(uint8_t) & outBytes)
 {
-    BOOST_STATIC_ASSERT_MSG(0 == (kMaxMIMELine % 4), "MIME line length is not divisible by 4.");
-    return (isalnum(ch) || (kPlusChar == ch) || (kSlashChar == ch));
-} // isValidMIMEChar
+    bool    okSoFar{0 == (length % 4)};
+
+    if (okSoFar)
+    {
+        auto    padding{StaticCast(CPtr(char), memchr(line, kEqualsChar, length))};
+        size_t  dataLength{(nullptr == padding) ? length : StaticCast(size_t, padding - line)};
+        size_t  ii{decodeMIMEBlocks(line, dataLength, outBytes)};
+        auto    table{kMIMEDecodeTable._values};
+
+        for ( ; okSoFar && ((ii + 4) <= dataLength); ii += 4)
+        {
+            uint8_t v0{table[StaticCast(uint8_t, line[ii])]};
+            uint8_t v1{table[StaticCast(uint8_t, line[ii + 1])]};
+            uint8_t v2{table[StaticCast(uint8_t, line[ii + 2])]};
+            uint8_t v3{table[StaticCast(uint8_t, line[ii + 3])]};
+
+            if (kInvalidMIMEValue == (v0 | v1 | v2 | v3))
+            {
+                okSoFar = false;
+                ODL_B1(okSoFar); //####
+            }
+            else
+            {
+                outBytes[0] = StaticCast(uint8_t, (v0 << 2) | (v1 >> 4));
+                outBytes[1] = StaticCast(uint8_t, (v1 << 4) | (v2 >> 2));
+                outBytes[2] = StaticCast(uint8_t, (v2 << 6) | v3);
+                outBytes += 3;
+            }
+        }
+        if (okSoFar && (ii < dataLength))
+        {
+            // A partial group of characters, before the padding, represents one or two bytes.
+            size_t  count{dataLength - ii};
+            uint8_t group6[3]{0, 0, 0};
+
+            for (size_t jj = 0; okSoFar && (jj < count); ++jj)
+            {
+                group6[jj] = table[StaticCast(uint8_t, line[ii + jj])];
+                if (kInvalidMIMEValue == group6[jj])
+                {
+                    okSoFar = false;
+                    ODL_B1(okSoFar); //####
+                }
+            }
+            if (okSoFar && (1 < count))
+            {
+                *outBytes++ = StaticCast(uint8_t, (group6[0] << 2) | (group6[1] >> 4));
+                if (2 < count)
+                {
+                    *outBytes++ = StaticCast(uint8_t, (group6[1] << 4) | (group6[2] >> 2));
+                }
+            }
+        }
+    }
+    else
+    {
+        ODL_LOG("! (0 == (length % 4))"); //####
+    }
+    return okSoFar;
+} // decodeMIMELine
+
+/*! @brief Convert as many whole groups of bytes as possible into MIME characters with vector instructions.
+ @param[in] bytes The bytes to be converted.
+ @param[in] numBytes The number of bytes to be converted, which is a multiple of three.
+ @param[in,out] outChars Where to store the characters, which is advanced past the stored characters.
+ @return The number of bytes converted. */
+static size_t
+encodeMIMEBlocks
+    (CPtr(uint8_t)  bytes,
+     const size_t   numBytes,
+     Ptr(char) &    outChars)
+{
+    size_t  ii{0};
+
+    // Each register is loaded with sixteen bytes of which twelve are used, so the last four bytes are only read.
+#if defined(__AVX2__)
+    for ( ; (ii + 28) <= numBytes; ii += 24)
+    {
+        __m256i block{_mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(ReinterpretCast(CPtr(__m128i), bytes + ii))),
+                                              _mm_loadu_si128(ReinterpretCast(CPtr(__m128i), bytes + ii + 12)), 1)};
+
+        _mm256_storeu_si256(ReinterpretCast(Ptr(__m256i), outChars), bytesToChars(block));
+        outChars += 32;
+    }
+#elif defined(nImO_USE_SSSE3_)
+    for ( ; (ii + 16) <= numBytes; ii += 12)
+    {
+        _mm_storeu_si128(ReinterpretCast(Ptr(__m128i), outChars),
+                         bytesToChars(_mm_loadu_si128(ReinterpretCast(CPtr(__m128i), bytes + ii))));
+        outChars += 16;
+    }
+#else // ! defined(nImO_USE_SSSE3_)
+    NIMO_UNUSED_VAR_(bytes);
+    NIMO_UNUSED_VAR_(numBytes);
+    NIMO_UNUSED_VAR_(outChars);
+#endif // ! defined(nImO_USE_SSSE3_)
+    return ii;
+} // encodeMIMEBlocks
+
+/*! @brief Convert a line's worth of bytes into MIME characters, including any padding.
+ @param[in] bytes The bytes to be converted.
+ @param[in] numBytes The number of bytes to be converted.
+ @param[out] outChars Where to store the characters, which must have room for all of them. */
+static void
+encodeMIMELine
+    (CPtr(uint8_t)  bytes,
+     const size_t   numBytes,
+     Ptr(char)      outChars)
+{
+    size_t  fullBytes{numBytes - (numBytes % 3)};
+    size_t  ii{encodeMIMEBlocks(bytes, fullBytes, outChars)};
+
+    for ( ; ii < fullBytes; ii += 3)
+    {
+        outChars[0] = kMIMECharSet[bytes[ii] >> 2];
+        outChars[1] = kMIMECharSet[((bytes[ii] & 0x03) << 4) | (bytes[ii + 1] >> 4)];
+        outChars[2] = kMIMECharSet[((bytes[ii + 1] & 0x0F) << 2) | (bytes[ii + 2] >> 6)];
+        outChars[3] = kMIMECharSet[bytes[ii + 2] & 0x3F];
+        outChars += 4;
+    }
+    if (ii < numBytes)
+    {
+        uint8_t second{(numBytes > (ii + 1)) ? bytes[ii + 1] : StaticCast(uint8_t, 0)};
+
+        outChars[0] = kMIMECharSet[bytes[ii] >> 2];
+        outChars[1] = kMIMECharSet[((bytes[ii] & 0x03) << 4) | (second >> 4)];
+        outChars[2] = ((numBytes > (ii + 1)) ? kMIMECharSet[(second & 0x0F) << 2] : kEqualsChar);
+        outChars[3] = kEqualsChar;
+    }
+} // encodeMIMELine
 
 #if defined(__APPLE__)
 # pragma mark Class methods
@@ -120,19 +447,13 @@ nImO::DecodeMIMEToBytes
     (const StdStringVector &    inValue,
      ByteVector &               outBytes)
 {
-    bool        okSoFar{true};
-    uint8_t     group6[4];
-    uint8_t     group8[3];
-    size_t      count4s{0};
-    size_t      numRows{inValue.size()};
-    size_t      newSize{0};
-    std::string line;
+    bool    okSoFar{true};
+    size_t  newSize{0};
 
     outBytes.clear();
     // First, validate the row sizes.
-    for (size_t ii = 0; okSoFar && (ii < numRows); ++ii)
+    for (auto & line : inValue)
     {
-        line = inValue[ii];
         if (0 == (line.length() % 4))
         {
             newSize += ((line.length() / 4) * 3);
@@ -141,102 +462,84 @@ nImO::DecodeMIMEToBytes
         {
             okSoFar = false;
             ODL_B1(okSoFar); //####
+            break;
+
         }
     }
     if (okSoFar)
     {
-        outBytes.reserve(newSize);
-    }
-    for (size_t ii = 0; okSoFar && (ii < numRows); ++ii)
-    {
-        line = inValue[ii];
-        for (size_t jj = 0, nn = line.length(); jj < nn; ++jj)
-        {
-            char    ch{line[jj]};
+        outBytes.resize(newSize + kMIMEDecodeSlack);
+        Ptr(uint8_t)    outPtr{outBytes.data()};
 
-            if (kEqualsChar == ch)
-            {
-                break;
-
-            }
-            if (isValidMIMEChar(ch))
-            {
-                group6[count4s] = ch;
-                if (4 == ++count4s)
-                {
-                    for (size_t kk = 0; kk < 4; ++kk)
-                    {
-                        group6[kk] = strchr(kMIMECharSet, group6[kk]) - kMIMECharSet;
-                    }
-                    group8[0] = (group6[0] << 2) + ((group6[1] & 0x0030) >> 4);
-                    group8[1] = ((group6[1] & 0x000f) << 4) + ((group6[2] & 0x003c) >> 2);
-                    group8[2] = ((group6[2] & 0x0003) << 6) + group6[3];
-                    for (size_t kk = 0; kk < 3; ++kk)
-                    {
-                        outBytes.push_back(group8[kk]);
-                    }
-                    count4s = 0;
-                }
-            }
-            else
-            {
-                okSoFar = false;
-                ODL_B1(okSoFar); //####
-            }
-        }
-        if (okSoFar && (count4s > 0))
+        for (size_t ii = 0, numRows = inValue.size(); okSoFar && (ii < numRows); ++ii)
         {
-            for (size_t jj = count4s; jj < 4; ++jj)
-            {
-                group6[jj] = kEndOfString;
-            }
-            for (size_t jj = 0; jj < 4; ++jj)
-            {
-                CPtr(char)  offset{strchr(kMIMECharSet, group6[jj])};
-
-                if (nullptr == offset)
-                {
-                    group6[jj] = 0;
-                }
-                else
-                {
-                    group6[jj] = offset - kMIMECharSet;
-                }
-            }
-            group8[0] = (group6[0] << 2) + ((group6[1] & 0x0030) >> 4);
-            group8[1] = ((group6[1] & 0x000f) << 4) + ((group6[2] & 0x003c) >> 2);
-            group8[2] = ((group6[2] & 0x0003) << 6) + group6[3];
-            for (size_t jj = 0; jj < (count4s - 1); ++jj)
-            {
-                outBytes.push_back(group8[jj]);
-            }
+            okSoFar = decodeMIMELine(inValue[ii].data(), inValue[ii].length(), outPtr);
         }
+        outBytes.resize(outPtr - outBytes.data());
     }
     return okSoFar;
 } // nImO::DecodeMIMEToBytes
 
 bool
 nImO::DecodeMIMEToBytes
-    (const std::string &    inValue,
-     ByteVector &           outBytes)
+    (CPtr(char)     inChars,
+     const size_t   numChars,
+     ByteVector &   outBytes)
 {
-    StdStringVector tempValues;
+    bool            okSoFar{true};
+    CPtr(char)      walker{inChars};
+    CPtr(char)      endOfInput{walker + numChars};
+    Ptr(uint8_t)    outPtr;
+
+    // The lines are decoded in place, rather than being split apart first.
+    outBytes.resize(((numChars / 4) * 3) + kMIMEDecodeSlack);
+    outPtr = outBytes.data();
+    for ( ; okSoFar; )
+    {
+        auto    endOfLine{StaticCast(CPtr(char), memchr(walker, '\n', endOfInput - walker))};
 
-    boost::split(tempValues, inValue, boost::is_any_of("\n"));
-    return DecodeMIMEToBytes(tempValues, outBytes);
+        if (nullptr == endOfLine)
+        {
+            okSoFar = decodeMIMELine(walker, endOfInput - walker, outPtr);
+            break;
+
+        }
+        okSoFar = decodeMIMELine(walker, endOfLine - walker, outPtr);
+        walker = endOfLine + 1;
+    }
+    outBytes.resize(outPtr - outBytes.data());
+    return okSoFar;
 } // nImO::DecodeMIMEToBytes
 
+void
+nImO::EncodeBytesAsMIME
+    (Ptr(char)      outChars,
+     CPtr(void)     inBytes,
+     const size_t   numBytes)
+{
+    CPtr(uint8_t)   rawBytes{StaticCast(CPtr(uint8_t), inBytes)};
+
+    for (size_t ii = 0; ii < numBytes; ii += kMaxMIMELineBytes)
+    {
+        size_t  lineBytes{std::min(kMaxMIMELineBytes, numBytes - ii)};
+
+        if (0 < ii)
+        {
+            *outChars++ = '\n';
+        }
+        encodeMIMELine(rawBytes + ii, lineBytes, outChars);
+        outChars += ((lineBytes + 2) / 3) * 4;
+    }
+} // nImO::EncodeBytesAsMIME
+
 void
 nImO::EncodeBytesAsMIME
     (StdStringVector &  outValue,
      CPtr(void)         inBytes,
      const size_t       numBytes)
 {
+    BOOST_STATIC_ASSERT_MSG(0 == (kMaxMIMELine % 4), "MIME line length is not divisible by 4.");
     CPtr(uint8_t)   rawBytes{StaticCast(CPtr(uint8_t), inBytes)};
-    uint8_t         group8[3];
-    uint8_t         group6[4];
-    size_t          count3s{0};
-    std::string     line;
 
     outValue.clear();
     // Calculate the number of rows.
@@ -244,62 +547,26 @@ nImO::EncodeBytesAsMIME
     size_t  numRows{((4 * numQuads) + kMaxMIMELine - 1) / kMaxMIMELine};
 
     outValue.reserve(numRows);
-    for (size_t ii = 0; ii < numBytes; ++ii)
-    {
-        group8[count3s++] = rawBytes[ii];
-        if (3 == count3s)
-        {
-            group6[0] = ((group8[0] & 0x00fc) >> 2);
-            group6[1] = ((group8[0] & 0x0003) << 4) + ((group8[1] & 0x00f0) >> 4);
-            group6[2] = ((group8[1] & 0x000f) << 2) + ((group8[2] & 0x00c0) >> 6);
-            group6[3] = (group8[2] & 0x003f);
-            for (size_t jj = 0; jj < 4; ++jj)
-            {
-                if (kMaxMIMELine <= line.length())
-                {
-                    outValue.push_back(line);
-                    line = ""s;
-                }
-                line += kMIMECharSet[group6[jj]];
-            }
-            count3s = 0;
-        }
-    }
-    if (0 < count3s)
+    // Since a line holds a whole number of groups, each line can be converted independently.
+    for (size_t ii = 0; ii < numBytes; ii += kMaxMIMELineBytes)
     {
-        for (size_t ii = count3s; ii < 3; ++ii)
-        {
-            group8[ii] = kEndOfString;
-        }
-        group6[0] = ((group8[0] & 0x00fc) >> 2);
-        group6[1] = ((group8[0] & 0x0003) << 4) + ((group8[1] & 0x00f0) >> 4);
-        group6[2] = ((group8[1] & 0x000f) << 2) + ((group8[2] & 0x00c0) >> 6);
-        group6[3] = (group8[2] & 0x003f);
-        for (size_t ii = 0; ii < (count3s + 1); ++ii)
-        {
-            if (kMaxMIMELine <= line.length())
-            {
-                outValue.push_back(line);
-                line = ""s;
-            }
-            line += kMIMECharSet[group6[ii]];
-        }
-        for ( ; count3s++ < 3; )
-        {
-            if (kMaxMIMELine <= line.length())
-            {
-                outValue.push_back(line);
-                line = ""s;
-            }
-            line += kEqualsChar;
-        }
-    }
-    if (! line.empty())
-    {
-        outValue.push_back(line);
+        size_t  lineBytes{std::min(kMaxMIMELineBytes, numBytes - ii)};
+
+        outValue.emplace_back(((lineBytes + 2) / 3) * 4, kEqualsChar);
+        encodeMIMELine(rawBytes + ii, lineBytes, &outValue.back()[0]);
     }
 } // nImO::EncodeBytesAsMIME
 
+size_t
+nImO::MIMEEncodedLength
+    (const size_t   numBytes)
+{
+    size_t  numChars{((numBytes + 2) / 3) * 4};
+    size_t  numRows{(numChars + kMaxMIMELine - 1) / kMaxMIMELine};
+
+    return ((0 < numRows) ? (numChars + numRows - 1) : 0);
+} // nImO::MIMEEncodedLength
+
 #if defined(__APPLE__)
 # pragma mark Actions and Accessors
 #endif // defined(__APPLE__)
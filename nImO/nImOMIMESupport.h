@@ -79,15 +79,43 @@ namespace nImO
         (const StdStringVector &    inValue,
          ByteVector &               outBytes);
 
+    /*! @brief Convert MIME-encoded lines, separated by newlines, into the corresponding bytes.
+     The characters are decoded where they are, so that they can be taken directly from a receive buffer.
+     @param[in] inChars The MIME-encoding of the bytes to be converted.
+     @param[in] numChars The number of characters in the MIME-encoding.
+     @param[out] outBytes The bytes represented by the MIME encoding; its storage is reused if it is large enough.
+     @return @c true if the input characters can be converted into a sequence of bytes and
+     @c false otherwise. */
+    bool
+    DecodeMIMEToBytes
+        (CPtr(char)     inChars,
+         const size_t   numChars,
+         ByteVector &   outBytes);
+
     /*! @brief Convert a MIME-encoded string into the corresponding bytes.
      @param[in] inValue The MIME-encoding of the bytes to be converted.
      @param[out] outBytes The bytes represented by the MIME encoding.
      @return @c true if the input string can be converted into a sequence of bytes and
      @c false otherwise. */
-    bool
+    inline bool
     DecodeMIMEToBytes
         (const std::string &    inValue,
-         ByteVector &           outBytes);
+         ByteVector &           outBytes)
+    {
+        return DecodeMIMEToBytes(inValue.data(), inValue.length(), outBytes);
+    }
+
+    /*! @brief Convert a sequence of bytes into MIME-encoded lines, separated by newlines, in a buffer.
+     The lines are the same as those produced by the StdStringVector form.
+     @param[out] outChars Where to store the characters, which must have room for
+     MIMEEncodedLength(numBytes) characters.
+     @param[in] inBytes The bytes to be encoded.
+     @param[in] numBytes The number of bytes to be encoded. */
+    void
+    EncodeBytesAsMIME
+        (Ptr(char)      outChars,
+         CPtr(void)     inBytes,
+         const size_t   numBytes);
 
     /*! @brief Convert a sequence of bytes into a sequence of MIME-encoded strings.
      @param[out] outValue The MIME encoding of the sequence of bytes.
@@ -110,6 +138,14 @@ namespace nImO
         EncodeBytesAsMIME(outValue, inString.data(), inString.length());
     }
 
+    /*! @brief Return the number of characters in the MIME encoding of a sequence of bytes, including the
+     newlines between lines.
+     @param[in] numBytes The number of bytes to be encoded.
+     @return The number of characters in the MIME encoding. */
+    size_t
+    MIMEEncodedLength
+        (const size_t   numBytes);
+
 } // nImO
 
 #endif // not defined(nImOzMIMESupport_H_)
@@ -38,6 +38,8 @@
 
 #include <nImObaseChannel.h>
 
+#include <Containers/nImOkeyDictionary.h>
+#include <Containers/nImOschemaCodec.h>
 #include <Contexts/nImOinputOutputContext.h>
 
 //#include <odlEnable.h>
@@ -97,6 +99,11 @@ nImO::BaseChannel::~BaseChannel
     ODL_OBJENTER(); //####
     _tcpSocket.reset();
     _udpSocket.reset();
+    _sharedMemoryRing.reset();
+#if MAC_OR_LINUX_OR_BSD_
+    _localStreamSocket.reset();
+    _localDatagramSocket.reset();
+#endif // MAC_OR_LINUX_OR_BSD_
     ODL_OBJEXIT(); //####
 } // nImO::BaseChannel::~BaseChannel
 
@@ -124,13 +131,78 @@ nImO::BaseChannel::isConnected
         }
         else
         {
-            result = false;
+            if (TransportType::kSharedMemory == _connection._transport)
+            {
+                result = _sharedMemoryConnected;
+            }
+            else
+            {
+                if (TransportType::kLocalStream == _connection._transport)
+                {
+                    result = _localStreamConnected;
+                }
+                else
+                {
+                    if (TransportType::kLocalDatagram == _connection._transport)
+                    {
+                        result = _localDatagramConnected;
+                    }
+                    else
+                    {
+                        result = false;
+                    }
+                }
+            }
         }
     }
     ODL_OBJEXIT_B(result); //####
     return result;
 } // nImO::BaseChannel::isConnected
 
+void
+nImO::BaseChannel::resetKeyDictionary
+    (void)
+{
+    ODL_OBJENTER(); //####
+    if (_keyDictionary)
+    {
+        ODL_LOG("(_keyDictionary)"); //####
+        _keyDictionary->reset();
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::BaseChannel::resetKeyDictionary
+
+void
+nImO::BaseChannel::setDataType
+    (const std::string &    dataType)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s(dataType); //####
+    _schemaCodec = SchemaCodec::findCodec(dataType);
+    ODL_OBJEXIT(); //####
+} // nImO::BaseChannel::setDataType
+
+void
+nImO::BaseChannel::setUpKeyDictionary
+    (const bool useKeyDictionary)
+{
+    ODL_OBJENTER(); //####
+    ODL_B1(useKeyDictionary); //####
+    if (useKeyDictionary && ((TransportType::kTCP == _connection._transport) || (TransportType::kLocalStream == _connection._transport)))
+    {
+        ODL_LOG("(useKeyDictionary && ((TransportType::kTCP == _connection._transport) || " //####
+                "(TransportType::kLocalStream == _connection._transport)))"); //####
+        _keyDictionary = std::make_shared<KeyDictionary>();
+    }
+    else
+    {
+        ODL_LOG("! (useKeyDictionary && ((TransportType::kTCP == _connection._transport) || " //####
+                "(TransportType::kLocalStream == _connection._transport)))"); //####
+        _keyDictionary.reset();
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::BaseChannel::setUpKeyDictionary
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
@@ -97,6 +97,16 @@ namespace nImO
                 return _name;
             }
 
+            /*! @brief Return the codec for the data type of the connection.
+             @return The codec for the data type of the connection or @c nullptr if none is registered. */
+            inline SpSchemaCodec
+            getSchemaCodec
+                (void)
+                const
+            {
+                return _schemaCodec;
+            }
+
             /*! @brief Retrieve the current statistics.
              @param[out] numberOfBytes The number of bytes transferred.
              @param[out] numberOfMessage The number of messages transferred. */
@@ -115,12 +125,50 @@ namespace nImO
                 (void)
                 const;
 
+            /*! @brief Set the data type of the connection, which selects the codec registered for it, if any.
+             This must be called before the channel is set up, as Messages that are encoded by a codec carry
+             their Map keys in full and are not delta-encoded.
+             @param[in] dataType The data type of the connection. */
+            void
+            setDataType
+                (const std::string &    dataType);
+
             /*! @brief Stop the channel and clear settings.
              @return @c true if the channel was successfully stopped. */
             virtual bool
             stop
                 (void) = 0;
 
+            /*! @brief Return @c true if the channel sends or receives Messages in binary frames rather than as MIME.
+             @return @c true if the channel sends or receives Messages in binary frames rather than as MIME. */
+            inline bool
+            usesBinaryFraming
+                (void)
+                const
+            {
+                return _binaryFraming;
+            }
+
+            /*! @brief Return @c true if the channel sends or receives delta-encoded Values.
+             @return @c true if the channel sends or receives delta-encoded Values. */
+            inline bool
+            usesDeltaEncoding
+                (void)
+                const
+            {
+                return (nullptr != _deltaCoder);
+            }
+
+            /*! @brief Return @c true if the channel uses a dictionary for Map keys.
+             @return @c true if the channel uses a dictionary for Map keys. */
+            inline bool
+            usesKeyDictionary
+                (void)
+                const
+            {
+                return (nullptr != _keyDictionary);
+            }
+
         protected :
             // Protected methods.
 
@@ -147,6 +195,20 @@ namespace nImO
                 (BaseChannel && other)
                 noexcept = delete;
 
+            /*! @brief Clear the dictionary used for Map keys, if there is one.
+             Both ends of a connection must do this whenever the connection is established or lost. */
+            void
+            resetKeyDictionary
+                (void);
+
+            /*! @brief Create or remove the dictionary used for Map keys.
+             Note that a dictionary is only used with TCP and local streams, as both ends must see the same
+             sequence of Messages; the transport mode must be set before this is called.
+             @param[in] useKeyDictionary @c true if a dictionary is requested. */
+            void
+            setUpKeyDictionary
+                (const bool useKeyDictionary);
+
         private :
             // Private methods.
 
@@ -165,6 +227,17 @@ namespace nImO
             /*! @brief The socket to use for UDP communication. */
             SpSocketUDP    _udpSocket{};
 
+            /*! @brief The ring buffer to use for shared memory communication. */
+            SpSharedMemoryRing  _sharedMemoryRing{};
+
+# if MAC_OR_LINUX_OR_BSD_
+            /*! @brief The socket to use for local stream communication. */
+            SpSocketLocalStream _localStreamSocket{};
+
+            /*! @brief The socket to use for local datagram communication. */
+            SpSocketLocalDatagram   _localDatagramSocket{};
+# endif // MAC_OR_LINUX_OR_BSD_
+
             /*! @brief The IP address, port and mode for the communication. */
             Connection  _connection{};
 
@@ -180,9 +253,30 @@ namespace nImO
             /*! @brief @c true once a UDP connection has been established. */
             std::atomic_bool    _udpConnected{false};
 
+            /*! @brief @c true once a shared memory connection has been established. */
+            std::atomic_bool    _sharedMemoryConnected{false};
+
+            /*! @brief @c true once a local stream connection has been established. */
+            std::atomic_bool    _localStreamConnected{false};
+
+            /*! @brief @c true once a local datagram connection has been established. */
+            std::atomic_bool    _localDatagramConnected{false};
+
             /*! @brief The transfer statistics for the channel. */
             ChannelStatistics    _statistics{};
 
+            /*! @brief The dictionary used for Map keys, if one was negotiated for the connection. */
+            SpKeyDictionary _keyDictionary{};
+
+            /*! @brief The encoder or decoder for delta-encoded Values, if delta encoding was negotiated for the connection. */
+            SpDeltaCoder    _deltaCoder{};
+
+            /*! @brief The codec for the data type of the connection, if one is registered. */
+            SpSchemaCodec   _schemaCodec{};
+
+            /*! @brief @c true if Messages are sent in binary frames rather than as MIME, if negotiated for the connection. */
+            bool    _binaryFraming{false};
+
         private :
             // Private fields.
 
@@ -66,7 +66,8 @@
 #define ALPHA_OR_DOLLAR_STRING  "[[:alnum:]$]"
 #define NAME_MATCH_STRING       ALPHA_OR_DOLLAR_STRING "+([_.-]" ALPHA_OR_DOLLAR_STRING "+)*"
 #define PATH_MATCH_STRING       "(/" NAME_MATCH_STRING ")+"
-#define TRANSPORT_MATCH_STRING  "([Uu][Dd][Pp]|[Tt][Cc][Pp]|[Aa][Nn][Yy])"
+#define TRANSPORT_MATCH_STRING  "([Uu][Dd][Pp]|[Tt][Cc][Pp]|[Ss][Hh][Mm]|[Ll][Oo][Cc][Aa][Ll][Ss][Tt][Rr][Ee][Aa][Mm]|" \
+                                "[Ll][Oo][Cc][Aa][Ll][Dd][Gg][Rr][Aa][Mm]|[Aa][Nn][Yy])"
 
 /*! @brief The character that ends the network part of a ChannelName. */
 constexpr char  kEndNetwork{':'};
@@ -93,6 +94,12 @@ static std::regex   lTransportMatch{"^" TRANSPORT_MATCH_STRING "$", std::regex::
 
 const std::string   nImO::kProtocolAnyName{"any"s}; // must be lower-case!
 
+const std::string   nImO::kProtocolLocalDatagramName{"localdgram"s}; // must be lower-case!
+
+const std::string   nImO::kProtocolLocalStreamName{"localstream"s}; // must be lower-case!
+
+const std::string   nImO::kProtocolSharedMemoryName{"shm"s}; // must be lower-case!
+
 const std::string   nImO::kProtocolTcpName{"tcp"s}; // must be lower-case!
 
 const std::string   nImO::kProtocolUdpName{"udp"s}; // must be lower-case!
@@ -326,6 +333,27 @@ nImO::ChannelName::transportFromName
             {
                 protocol = TransportType::kTCP;
             }
+            else
+            {
+                if (nameToCheck == transportToName(TransportType::kSharedMemory))
+                {
+                    protocol = TransportType::kSharedMemory;
+                }
+                else
+                {
+                    if (nameToCheck == transportToName(TransportType::kLocalStream))
+                    {
+                        protocol = TransportType::kLocalStream;
+                    }
+                    else
+                    {
+                        if (nameToCheck == transportToName(TransportType::kLocalDatagram))
+                        {
+                            protocol = TransportType::kLocalDatagram;
+                        }
+                    }
+                }
+            }
         }
     }
     ODL_EXIT_I(StaticCast(int, protocol)); //####
@@ -342,6 +370,9 @@ nImO::ChannelName::transportNames
     result.insert(kProtocolAnyName);
     result.insert(kProtocolUdpName);
     result.insert(kProtocolTcpName);
+    result.insert(kProtocolSharedMemoryName);
+    result.insert(kProtocolLocalStreamName);
+    result.insert(kProtocolLocalDatagramName);
     ODL_EXIT(); //####
     return result;
 } // nImO::ChannelName::transportNames
@@ -368,6 +399,18 @@ nImO::ChannelName::transportToName
             result = kProtocolUdpName;
             break;
 
+        case TransportType::kSharedMemory :
+            result = kProtocolSharedMemoryName;
+            break;
+
+        case TransportType::kLocalStream :
+            result = kProtocolLocalStreamName;
+            break;
+
+        case TransportType::kLocalDatagram :
+            result = kProtocolLocalDatagramName;
+            break;
+
         case TransportType::kUnknown :
             result = kProtocolUnknownName;
             break;
@@ -264,6 +264,15 @@ namespace nImO
     /*! @brief The standard name for any protocol. */
     extern const std::string    kProtocolAnyName;
 
+    /*! @brief The standard name for the local datagram protocol. */
+    extern const std::string    kProtocolLocalDatagramName;
+
+    /*! @brief The standard name for the local stream protocol. */
+    extern const std::string    kProtocolLocalStreamName;
+
+    /*! @brief The standard name for the shared memory protocol. */
+    extern const std::string    kProtocolSharedMemoryName;
+
     /*! @brief The standard name for the TCP protocol. */
     extern const std::string    kProtocolTcpName;
 
@@ -49,15 +49,6 @@
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
-#if defined(__APPLE__)
-# pragma clang diagnostic push
-# pragma clang diagnostic ignored "-Wdeprecated-declarations"
-#endif // defined(__APPLE__)
-#include <boost/algorithm/string/join.hpp>
-#if defined(__APPLE__)
-# pragma clang diagnostic pop
-#endif // defined(__APPLE__)
-
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -113,6 +104,34 @@ nImO::CommandHandler::~CommandHandler
 # pragma mark Actions and Accessors
 #endif // defined(__APPLE__)
 
+bool
+nImO::CommandHandler::acceptsStreamedResponse
+    (const Array &  arguments,
+     const size_t   position)
+    const
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(&arguments); //####
+    ODL_I1(position); //####
+    bool    result{false};
+
+    if (position < arguments.size())
+    {
+        auto    asLogical{arguments[position]->asLogical()};
+
+        if (nullptr == asLogical)
+        {
+            ODL_LOG("(nullptr == asLogical)"); //####
+        }
+        else
+        {
+            result = asLogical->getValue();
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // nImO::CommandHandler::acceptsStreamedResponse
+
 bool
 nImO::CommandHandler::sendComplexResponse
     (BTCP::socket &         socket,
@@ -138,11 +157,14 @@ nImO::CommandHandler::sendComplexResponseWithContext
      const std::string &    responseKey,
      const std::string &    responseText,
      SpValue                contents,
-     std::string &          reason)
+     std::string &          reason,
+     const bool             streamed,
+     const bool             moreFollows)
 {
     ODL_ENTER(); //####
     ODL_P4(context.get(), &socket, contents.get(), &reason); //####
     ODL_S2s(responseKey, responseText); //####
+    ODL_B2(streamed, moreFollows); //####
     bool    okSoFar{false};
     Message responseToSend;
     auto    responseArray{std::make_shared<Array>()};
@@ -150,6 +172,11 @@ nImO::CommandHandler::sendComplexResponseWithContext
     responseToSend.open(true);
     responseArray->addValue(std::make_shared<String>(responseKey));
     responseArray->addValue(contents);
+    if (streamed)
+    {
+        // The requester keeps reading until it sees a batch that is not followed by another.
+        responseArray->addValue(std::make_shared<Logical>(moreFollows));
+    }
     responseToSend.setValue(responseArray);
     responseToSend.close();
     if (0 < responseToSend.getLength())
@@ -164,10 +191,7 @@ nImO::CommandHandler::sendComplexResponseWithContext
         else
         {
             std::atomic_bool    keepGoing{true};
-            StdStringVector     outVec;
-
-            EncodeBytesAsMIME(outVec, asString);
-            auto    outString{nImO::PackageMessage(outVec)};
+            auto                outString{nImO::PackageMessage(asString)};
 
             ODL_S1(outString->c_str()); //####
             // send the encoded message to the requestor.
@@ -175,7 +199,7 @@ nImO::CommandHandler::sendComplexResponseWithContext
             context->report("sending response."s);
 #endif /* defined(nImO_ChattyTcpUdpLogging) */
             boost::asio::async_write(socket, boost::asio::buffer(outString->c_str(), outString->length()),
-                                      [context, &keepGoing, &okSoFar, responseText, &reason]
+                                      [context, &keepGoing, &okSoFar, responseText, &reason, moreFollows]
                                       (const BSErr &        ec,
                                        const std::size_t    bytes_transferred)
                                       {
@@ -200,7 +224,10 @@ nImO::CommandHandler::sendComplexResponseWithContext
                                         }
                                         else
                                         {
-                                            context->report(responseText + " response sent."s);
+                                            if (! moreFollows)
+                                            {
+                                                context->report(responseText + " response sent."s);
+                                            }
                                             okSoFar = true;
                                             ODL_B1(okSoFar); //####
                                             keepGoing = false;
@@ -274,10 +301,7 @@ nImO::CommandHandler::sendSimpleResponseWithContext
         else
         {
             std::atomic_bool    keepGoing{true};
-            StdStringVector     outVec;
-
-            EncodeBytesAsMIME(outVec, asString);
-            auto    outString{nImO::PackageMessage(outVec)};
+            auto                outString{nImO::PackageMessage(asString)};
 
             ODL_S1(outString->c_str()); //####
             // send the encoded message to the requestor.
@@ -360,10 +384,7 @@ nImO::CommandHandler::sendStatusReport
         }
         else
         {
-            StdStringVector outVec;
-
-            EncodeBytesAsMIME(outVec, asString);
-            auto    outString(std::make_shared<std::string>(boost::algorithm::join(outVec, "\n"s)));
+            auto    outString{PackageMessage(asString, false)};
 
             // send the encoded message to the logging ports
             theSocket.async_send_to(boost::asio::buffer(*outString), theEndpoint,
@@ -39,6 +39,7 @@
 #if (! defined(nImOcommandHandler_H_))
 # define nImOcommandHandler_H_ /* Header guard */
 
+# include <Containers/nImOarray.h>
 # include <Contexts/nImOserviceContext.h>
 
 # if defined(__APPLE__)
@@ -124,6 +125,16 @@ namespace nImO
         protected :
             // Protected methods.
 
+            /*! @brief Return @c true if the requester will accept a streamed response.
+             @param[in] arguments The arguments to the command, with the first element being the command received.
+             @param[in] position The position of the optional 'accepts streamed response' argument.
+             @return @c true if the requester will accept a streamed response. */
+            bool
+            acceptsStreamedResponse
+                (const Array &  arguments,
+                 const size_t   position)
+                const;
+
             /*! @brief The constructor.
              @param[in] owner The owning Context.  */
             CommandHandler
@@ -145,6 +156,50 @@ namespace nImO
                  std::string &          reason)
                 const;
 
+            /*! @brief Send a reponse for the command that is built from a sequence of elements.
+             If the requester accepts a streamed response, the elements are sent as a series of Messages, each holding at most
+             kStreamedResponseBatchSize elements, so that neither end has to hold the whole response at once.
+             @param[in] socket The socket where the response should be sent.
+             @param[in] responseKey The response type.
+             @param[in] responseText The description of the response.
+             @param[in] elements The source of the data for the response.
+             @param[in] makeValue The function to convert an element to a Value.
+             @param[in] streamed @c true if the requester accepts a streamed response.
+             @param[out] reason The reason for a failure.
+             @return @c true if a response was sent. */
+            template <typename Element>
+            bool
+            sendStreamedResponse
+                (BTCP::socket &                 socket,
+                 const std::string &            responseKey,
+                 const std::string &            responseText,
+                 const std::vector<Element> &   elements,
+                 SpValue                        (*makeValue)(const Element &),
+                 const bool                     streamed,
+                 std::string &                  reason)
+                const
+            {
+                bool    okSoFar{true};
+                size_t  count{elements.size()};
+                size_t  batchLimit{streamed ? kStreamedResponseBatchSize : count};
+                auto    batchArray{std::make_shared<Array>()};
+
+                for (size_t ii = 0; okSoFar && (ii < count); ++ii)
+                {
+                    batchArray->addValue(makeValue(elements[ii]));
+                    if ((batchLimit <= batchArray->size()) && ((ii + 1) < count))
+                    {
+                        okSoFar = sendComplexResponseWithContext(_owner, socket, responseKey, responseText, batchArray, reason, true, true);
+                        batchArray = std::make_shared<Array>();
+                    }
+                }
+                if (okSoFar)
+                {
+                    okSoFar = sendComplexResponseWithContext(_owner, socket, responseKey, responseText, batchArray, reason, streamed, false);
+                }
+                return okSoFar;
+            }
+
             /*! @brief Send a simple reponse for the command.
              @param[in] socket The socket where the response should be sent.
              @param[in] responseKey The response type.
@@ -182,6 +237,8 @@ namespace nImO
              @param[in] responseText The description of the response.
              @param[in] contents The data for the response.
              @param[out] reason The reason for a failure.
+             @param[in] streamed @c true if the response is one of a series of Messages.
+             @param[in] moreFollows @c true if this is not the last Message of a streamed response.
              @return @c true if a response was sent. */
             static bool
             sendComplexResponseWithContext
@@ -190,7 +247,9 @@ namespace nImO
                  const std::string &    responseKey,
                  const std::string &    responseText,
                  SpValue                contents,
-                 std::string &          reason);
+                 std::string &          reason,
+                 const bool             streamed = false,
+                 const bool             moreFollows = false);
 
             /*! @brief Send a simple reponse for the command.
              @param[in] context The context for the responder.
@@ -80,26 +80,25 @@
 /*! @brief Handle the received request.
  @param[in,out] owner The owning Context for the session.
  @param[in,out] socket The TCP/IP socket to use for communication.
- @param[in] incoming The received request.
+ @param[in] incoming The received request, which includes the Message separator.
+ @param[in] incomingLength The number of characters in the received request.
  @return @c true if the request was responded to. */
 static bool
 processRequest
     (nImO::SpServiceContext owner,
      nImO::SpSocketTCP      socket,
-     const std::string &    incoming,
+     CPtr(char)             incoming,
+     const size_t           incomingLength,
      std::string &          reason)
 {
     ODL_ENTER(); //####
-    ODL_P3(owner.get(), socket.get(), reason); //####
-    ODL_S1s(incoming); //####
-    // We need to strip off the Message separator first.
+    ODL_P4(owner.get(), socket.get(), incoming, &reason); //####
+    ODL_I1(incomingLength); //####
     bool                okSoFar{false};
-    auto                trimmed{nImO::UnpackageMessage(incoming)};
     nImO::ByteVector    rawStuff;
 
-    ODL_S1s(trimmed); //####
     // Ignore a request that can't be processed...
-    if (nImO::DecodeMIMEToBytes(trimmed, rawStuff))
+    if (nImO::UnpackageMessage(incoming, incomingLength, rawStuff))
     {
         auto    stuff{std::make_unique<nImO::Message>()};
 
@@ -159,7 +158,7 @@ processRequest
     }
     else
     {
-        ODL_LOG("! (nImO::DecodeMIMEToBytes(trimmed, rawStuff))"); //####
+        ODL_LOG("! (nImO::UnpackageMessage(incoming, incomingLength, rawStuff))"); //####
         reason = "Could not decode message"s;
     }
     ODL_EXIT_B(okSoFar); //####
@@ -222,7 +221,6 @@ nImO::CommandSession::start
                                     (const BSErr &      ec,
                                      const std::size_t  size)
                                     {
-                                        NIMO_UNUSED_VAR_(size);
                                         if (ec)
                                         {
                                             if (BAErr::operation_aborted == ec)
@@ -244,7 +242,7 @@ nImO::CommandSession::start
 #if defined(nImO_ChattyTcpUdpLogging)
                                             _owner->report("got request."s);
 #endif /* defined(nImO_ChattyTcpUdpLogging) */
-                                            if (! processRequest(_owner, _socket, std::string{buffers_begin(_buffer.data()), buffers_end(_buffer.data())}, reason))
+                                            if (! processRequest(_owner, _socket, StaticCast(CPtr(char), _buffer.data().data()), size, reason))
                                             {
                                                 CommandHandler::SendBadResponse(_owner, _socket, reason);
                                             }
@@ -43,6 +43,14 @@
 #include <Contexts/nImOcontext.h>
 
 #include <boost/version.hpp>
+#include <cctype>
+#include <charconv>
+#if (! defined(__cpp_lib_to_chars))
+# include <iomanip>
+# include <limits>
+# include <locale>
+# include <sstream>
+#endif // not defined(__cpp_lib_to_chars)
 #include <random>
 #include <regex>
 #include <string>
@@ -122,6 +130,56 @@ const std::string   nImO::kStatusSeparator{"\t"s};
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Convert a sequence of characters to a number.
+ Leading white space and a leading plus sign are accepted, as they were when the C library conversion
+ functions were used.
+ @param[in] first The first character to be converted.
+ @param[in] last The position after the last character to be converted.
+ @param[out] result The value represented by the characters.
+ @return @c true if the characters are exactly a representation of a number and @c false otherwise. */
+template <typename Type>
+static bool
+convertToNumber
+    (CPtr(char) first,
+     CPtr(char) last,
+     Type &     result)
+{
+    ODL_ENTER(); //####
+    ODL_P3(first, last, &result); //####
+    bool    okSoFar{false};
+
+    // std::from_chars accepts neither of these.
+    for ( ; (first < last) && isspace(StaticCast(unsigned char, *first)); ++first)
+    {
+    }
+    if ((first < last) && ('+' == *first) && ((first + 1) < last) && ('-' != *(first + 1)))
+    {
+        ++first;
+    }
+    if (first < last)
+    {
+        Type    value;
+
+        if constexpr (std::is_floating_point<Type>::value)
+        {
+            okSoFar = ConvertCharsToDouble(first, last, value);
+        }
+        else
+        {
+            auto    converted{std::from_chars(first, last, value)};
+
+            okSoFar = ((std::errc() == converted.ec) && (last == converted.ptr));
+        }
+        if (okSoFar)
+        {
+            result = value;
+            ODL_B1(okSoFar); //####
+        }
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // convertToNumber
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
@@ -141,6 +199,21 @@ nImO::B2D
     return result;
 } // nImO::B2D
 
+float
+nImO::B2F
+    (const NumberAsBytes &  inString)
+{
+    ODL_ENTER(); //####
+    ODL_P1(&inString); //####
+    boost::endian::big_float32_buf_t    holder;
+    float                               result;
+
+    memcpy(holder.data(), inString, sizeof(result));
+    result = holder.value();
+    ODL_EXIT_D(result); //####
+    return result;
+} // nImO::B2F
+
 int64_t
 nImO::B2I
     (const NumberAsBytes &  inString,
@@ -296,6 +369,81 @@ nImO::ConsumeSomeTime
     ODL_EXIT(); //####
 } // nImO::ConsumeSomeTime
 
+bool
+nImO::ConvertCharsToDouble
+    (CPtr(char) first,
+     CPtr(char) last,
+     double &   result)
+{
+    ODL_ENTER(); //####
+    ODL_P3(first, last, &result); //####
+    bool    okSoFar{false};
+
+    if (first < last)
+    {
+        double  value;
+#if defined(__cpp_lib_to_chars)
+        auto    converted{std::from_chars(first, last, value)};
+
+        okSoFar = ((std::errc() == converted.ec) && (last == converted.ptr));
+#else // not defined(__cpp_lib_to_chars)
+        // Older C++ libraries, such as some versions of libc++, lack floating-point std::from_chars.
+        // A stream with the classic locale reads the same forms, apart from a leading plus sign.
+        std::istringstream  inStream{std::string{first, last}};
+
+        inStream.imbue(std::locale::classic());
+        okSoFar = (('+' != *first) && (inStream >> std::noskipws >> value) &&
+                   (std::istringstream::traits_type::eof() == inStream.peek()));
+#endif // not defined(__cpp_lib_to_chars)
+        if (okSoFar)
+        {
+            result = value;
+        }
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::ConvertCharsToDouble
+
+Ptr(char)
+nImO::ConvertDoubleToChars
+    (Ptr(char)      first,
+     Ptr(char)      last,
+     const double   value)
+{
+    ODL_ENTER(); //####
+    ODL_P2(first, last); //####
+    ODL_D1(value); //####
+#if defined(__cpp_lib_to_chars)
+    auto        converted{std::to_chars(first, last, value)};
+    Ptr(char)   result{(std::errc() == converted.ec) ? converted.ptr : first};
+#else // not defined(__cpp_lib_to_chars)
+    // Older C++ libraries, such as some versions of libc++, lack floating-point std::to_chars, so
+    // use the fewest digits that read back as the same value.
+    std::string text;
+
+    for (int precision = std::numeric_limits<double>::digits10; std::numeric_limits<double>::max_digits10 >= precision;
+         ++precision)
+    {
+        std::ostringstream  outStream;
+        double              check;
+
+        outStream.imbue(std::locale::classic());
+        outStream << std::setprecision(precision) << value;
+        text = outStream.str();
+        if (ConvertCharsToDouble(text.data(), text.data() + text.length(), check) && (check == value))
+        {
+            break;
+        }
+    }
+    size_t      length{std::min(text.length(), StaticCast(size_t, last - first))};
+    Ptr(char)   result{first + length};
+
+    memcpy(first, text.data(), length);
+#endif // not defined(__cpp_lib_to_chars)
+    ODL_EXIT_P(result); //####
+    return result;
+} // nImO::ConvertDoubleToChars
+
 std::string
 nImO::ConvertDoubleToString
     (const double   value)
@@ -303,11 +451,11 @@ nImO::ConvertDoubleToString
     ODL_ENTER(); //####
     ODL_D1(value); //####
     // Note that boost::lexical_cast<std::string>(double) generates strings with trailing digits.
-    // That is, 1E-22 winds up as 9.9999999999999E-21, which is platform-sensitive.
-    std::ostringstream  holder;
-
-    holder << std::defaultfloat << value;
-    std::string result{holder.str()};
+    // That is, 1E-22 winds up as 9.9999999999999E-21, which is platform-sensitive. The conversion
+    // doesn't depend on the locale and gives the shortest string that reads back as the same value.
+    std::array<char, kNumberTextLength> holder;
+    std::string                         result{holder.data(), ConvertDoubleToChars(holder.data(),
+                                                                                   holder.data() + holder.size(), value)};
 
     ODL_EXIT_s(result); //####
     return result;
@@ -321,22 +469,8 @@ nImO::ConvertToDouble
     ODL_ENTER(); //####
     ODL_S1(startPtr); //####
     ODL_P1(&result); //####
-    bool        okSoFar;
-    Ptr(char)   endPtr;
-    double      value{strtod(startPtr, &endPtr)};
+    bool    okSoFar{convertToNumber(startPtr, startPtr + strlen(startPtr), result)};
 
-    if ((startPtr != endPtr) && (kEndOfString == *endPtr))
-    {
-        result = value;
-        ODL_D1(result); //####
-        okSoFar = true;
-        ODL_B1(okSoFar); //####
-    }
-    else
-    {
-        okSoFar = false;
-        ODL_B1(okSoFar); //####
-    }
     ODL_EXIT_B(okSoFar); //####
     return okSoFar;
 } // nImO::ConvertToDouble
@@ -349,7 +483,7 @@ nImO::ConvertToDouble
     ODL_ENTER(); //####
     ODL_S1s(aString); //####
     ODL_P1(&result); //####
-    bool    okSoFar{ConvertToDouble(aString.c_str(), result)};
+    bool    okSoFar{convertToNumber(aString.data(), aString.data() + aString.length(), result)};
 
     ODL_EXIT_B(okSoFar); //####
     return okSoFar;
@@ -363,22 +497,8 @@ nImO::ConvertToInt64
     ODL_ENTER(); //####
     ODL_S1(startPtr); //####
     ODL_P1(&result); //####
-    bool        okSoFar;
-    Ptr(char)   endPtr;
-    int64_t     value{strtoll(startPtr, &endPtr, 10)};
+    bool    okSoFar{convertToNumber(startPtr, startPtr + strlen(startPtr), result)};
 
-    if ((startPtr != endPtr) && (kEndOfString == *endPtr))
-    {
-        result = value;
-        ODL_I1(result); //####
-        okSoFar = true;
-        ODL_B1(okSoFar); //####
-    }
-    else
-    {
-        okSoFar = false;
-        ODL_B1(okSoFar); //####
-    }
     ODL_EXIT_B(okSoFar); //####
     return okSoFar;
 } // nImO::ConvertToInt64
@@ -391,7 +511,7 @@ nImO::ConvertToInt64
     ODL_ENTER(); //####
     ODL_S1s(aString); //####
     ODL_P1(&result); //####
-    bool    okSoFar{ConvertToInt64(aString.c_str(), result)};
+    bool    okSoFar{convertToNumber(aString.data(), aString.data() + aString.length(), result)};
 
     ODL_EXIT_B(okSoFar); //####
     return okSoFar;
@@ -494,6 +614,20 @@ nImO::DumpMemoryToStandardError
     }
 } // nImO::DumpMemoryToStandardError
 
+void
+nImO::F2B
+    (const float        inValue,
+     NumberAsBytes &    outString)
+{
+    ODL_ENTER(); //####
+    ODL_D1(inValue); //####
+    ODL_P1(&outString); //####
+    boost::endian::big_float32_buf_t    holder{inValue};
+
+    memcpy(outString, holder.data(), sizeof(inValue));
+    ODL_EXIT(); //####
+} // nImO::F2B
+
 std::string
 nImO::GetRandomHexString
     (void)
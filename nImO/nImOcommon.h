@@ -96,6 +96,8 @@ using namespace std::string_literals;
 #  pragma clang diagnostic ignored "-Wdeprecated-declarations"
 # endif // defined(__APPLE__)
 # include <boost/asio.hpp>
+# include <boost/container/flat_map.hpp>
+# include <boost/container/flat_set.hpp>
 # include <boost/optional.hpp>
 # if defined(__APPLE__)
 #  pragma clang diagnostic pop
@@ -221,6 +223,14 @@ using BTCP = BAIP::tcp;
 /*! @brief A shortened name for a type. */
 using BUDP = BAIP::udp;
 
+# if MAC_OR_LINUX_OR_BSD_
+/*! @brief A shortened name for a type. */
+using BLDgram = boost::asio::local::datagram_protocol;
+
+/*! @brief A shortened name for a type. */
+using BLStream = boost::asio::local::stream_protocol;
+# endif // MAC_OR_LINUX_OR_BSD_
+
 # define UnaryAndBinaryOperators(Type_) \
 inline constexpr Type_ \
 operator~\
@@ -287,15 +297,20 @@ namespace nImO
     class BufferChunk;
     class ChannelName;
     class Context;
+    class DeltaCoder;
     class Flaw;
     class Integer;
+    class KeyDictionary;
     class Logical;
     class Map;
     class Message;
     class RegistryProxy;
+    class SchemaCodec;
     class Set;
+    class SharedMemoryRing;
     class String;
     class StringBuffer;
+    class TextSink;
     class Value;
 
     // Type definitions.
@@ -349,6 +364,10 @@ namespace nImO
                 /*! @brief The mask for the size of the count of floating-point values. */
                 DoubleLongCountMask = 0x0007,
 
+                /*! @brief The floating-point values are single-precision, four bytes each, rather than double-precision.
+                 Note that this is only used with a long count. */
+                DoubleLongCountSinglePrecisionValue = 0x0008,
+
         /*! @brief The data that follows is a String or Blob. */
         StringOrBlob = 0x0080,
 
@@ -377,6 +396,10 @@ namespace nImO
                  Note that the count contained in the byte is one less than the actual count; the length is the actual length. */
                 StringOrBlobLongLengthMask = 0x0007,
 
+                /*! @brief The bytes that follow are the index of a Map key in the KeyDictionary for the connection, rather than the length of a String.
+                 Note that this is only used for String Map keys, on connections that have a KeyDictionary. */
+                StringOrBlobLongLengthKeyReferenceValue = 0x0008,
+
         /*! @brief The data that follows is a Logical or a Container. */
         Other = 0x00C0,
 
@@ -560,16 +583,25 @@ namespace nImO
     enum class TransportType : uint8_t
     {
         /*! @brief The transport mechanism is unknown. */
-        kUnknown =  0x00,
+        kUnknown =          0x00,
 
         /*! @brief Use TCP for the transport mechanism. */
-        kTCP =      0x01,
+        kTCP =              0x01,
 
         /*! @brief Use UDP for the transport mechanism. */
-        kUDP =      0x02,
+        kUDP =              0x02,
+
+        /*! @brief Use a ring buffer in shared memory for the transport mechanism; only possible on a single machine. */
+        kSharedMemory =     0x04,
+
+        /*! @brief Use a local (Unix domain) stream socket for the transport mechanism; only possible on a single machine. */
+        kLocalStream =      0x08,
+
+        /*! @brief Use a local (Unix domain) datagram socket for the transport mechanism; only possible on a single machine. */
+        kLocalDatagram =    0x10,
 
         /*! @brief Any transport mechanism is allowed. */
-        kAny =      0x7F
+        kAny =              0x7F
 
     }; // TransportType
 
@@ -834,6 +866,85 @@ namespace nImO
     /*! @brief The line length for command-line help output. */
     constexpr size_t    kHelpLineLength{250};
 
+    /*! @brief The amount of JSON text that is collected before it is sent. */
+    constexpr size_t    kJSONBufferSize{8192};
+
+    /*! @brief The deepest nesting of JSON arrays and objects that will be read. */
+    constexpr size_t    kJSONMaximumDepth{512};
+
+    /*! @brief The amount of input that is requested at a time when input cannot be memory-mapped. */
+    constexpr size_t    kMappedInputBlockSize{65536};
+
+    /*! @brief The smallest amount of text that is given to a thread when parsing in parallel. */
+    constexpr size_t    kParallelParseMinimumSegment{1048576};
+
+    /*! @brief The first byte of a binary-framed Message. */
+    constexpr uint8_t   kFrameMarker{0xA5};
+
+    /*! @brief The flag, in the second byte of a binary-framed Message, that indicates that a checksum follows the header. */
+    constexpr uint8_t   kFrameChecksumFlag{0x01};
+
+    /*! @brief The number of bytes in the header of a binary-framed Message: marker, flags and a four-byte big-endian length. */
+    constexpr size_t    kFrameHeaderSize{6};
+
+    /*! @brief The number of bytes in the checksum of a binary-framed Message. */
+    constexpr size_t    kFrameChecksumSize{4};
+
+    /*! @brief The largest Message body that will be accepted in a binary frame. */
+    constexpr size_t    kFrameMaximumLength{16777216};
+
+    /*! @brief The number of released transmission buffers that are kept for reuse. */
+    constexpr size_t    kTransmissionBufferPoolSize{32};
+
+    /*! @brief The largest transmission buffer that is kept for reuse; larger buffers are freed when released. */
+    constexpr size_t    kTransmissionBufferMaximumCapacity{1048576};
+
+    /*! @brief The first byte of a compressed Message; it is a reserved DataKind value, so it never starts an uncompressed Message. */
+    constexpr uint8_t   kCompressedMessageMarker{0xC8};
+
+    /*! @brief The number of bytes in the header of a compressed Message: marker and a four-byte big-endian length. */
+    constexpr size_t    kCompressedMessageHeaderSize{5};
+
+    /*! @brief The largest uncompressed Message that will be accepted in a compressed Message. */
+    constexpr size_t    kCompressedMessageMaximumLength{16777216};
+
+    /*! @brief The number of elements sent in each batch of a streamed command response. */
+    constexpr size_t    kStreamedResponseBatchSize{256};
+
+    /*! @brief The number of bytes in the ring buffer of a shared memory connection; must be a power of two. */
+    constexpr size_t    kSharedMemoryRingCapacity{4194304};
+
+    /*! @brief The longest time, in microseconds, that a side of a shared memory connection sleeps before checking if it was closed. */
+    constexpr long      kSharedMemoryWaitInterval{100000};
+
+    /*! @brief The largest datagram that is sent via a local datagram socket; the socket buffers are made at least this large. */
+    constexpr size_t    kLocalDatagramMaximumLength{196608};
+
+    /*! @brief The largest datagram that is sent via UDP as it is; larger datagrams are split into fragments. */
+    constexpr size_t    kUdpDatagramMaximumLength{2048};
+
+    /*! @brief The first byte of a fragment of a UDP datagram; it is neither a MIME character nor the binary frame marker. */
+    constexpr uint8_t   kFragmentMarker{0xA6};
+
+    /*! @brief The number of bytes in the header of a fragment: marker, a reserved byte, a four-byte big-endian datagram identifier,
+     a two-byte big-endian fragment index and a two-byte big-endian fragment count. */
+    constexpr size_t    kFragmentHeaderSize{10};
+
+    /*! @brief The largest fragment, including its header; it fits in an Ethernet packet, so that IP does not split it further. */
+    constexpr size_t    kFragmentMaximumLength{1400};
+
+    /*! @brief The largest datagram that will be split into fragments or reassembled from them. */
+    constexpr size_t    kFragmentedDatagramMaximumLength{1048576};
+
+    /*! @brief The number of partly-received datagrams that a receiver keeps; the oldest is dropped to make room for a new one. */
+    constexpr size_t    kFragmentReassemblyTableSize{8};
+
+    /*! @brief The time, in milliseconds, after which a partly-received datagram is dropped. */
+    constexpr long      kFragmentReassemblyTimeout{2000};
+
+    /*! @brief The space needed for the text form of a number; '-2.2250738585072014e-308' is the longest double. */
+    constexpr size_t    kNumberTextLength{32};
+
     /*! @brief The standard copyright holder name to use for nImO-created executables. */
     const std::string   kCopyrightName{"OpenDragon"s};
 
@@ -849,12 +960,18 @@ namespace nImO
     /*! @brief A sequence of bytes. */
     using ByteVector = std::vector<uint8_t>;
 
+    /*! @brief A sequence of double values. */
+    using DoubleVector = std::vector<double>;
+
     /*! @brief The table type used for lookups. */
     using StdStringSet = std::set<std::string>;
 
     /*! @brief A holder for a shared pointer to an Array. */
     using SpArray = std::shared_ptr<Array>;
 
+    /*! @brief A holder for a shared pointer to an array of uint8_t values. */
+    using SpAuint8_t = std::shared_ptr<uint8_t[]>;
+
     /*! @brief A holder for a shared pointer to a BaseArgumentDescriptor. */
     using SpBaseArgumentDescriptor = std::shared_ptr<BaseArgumentDescriptor>;
 
@@ -867,12 +984,18 @@ namespace nImO
     /*! @brief A holder for a shared pointer to a ChannelName. */
     using SpChannelName = std::shared_ptr<ChannelName>;
 
+    /*! @brief A holder for a shared pointer to a DeltaCoder. */
+    using SpDeltaCoder = std::shared_ptr<DeltaCoder>;
+
     /*! @brief A holder for a shared pointer to a Flaw. */
     using SpFlaw = std::shared_ptr<Flaw>;
 
     /*! @brief A holder for a shared pointer to a Flaw. */
     using SpInteger = std::shared_ptr<Integer>;
 
+    /*! @brief A holder for a shared pointer to a KeyDictionary. */
+    using SpKeyDictionary = std::shared_ptr<KeyDictionary>;
+
     /*! @brief A holder for a shared pointer to a Flaw. */
     using SpLogical = std::shared_ptr<Logical>;
 
@@ -882,6 +1005,9 @@ namespace nImO
     /*! @brief A holder for a shared pointer to a Message. */
     using SpMessage = std::shared_ptr<Message>;
 
+    /*! @brief A holder for a shared pointer to a SchemaCodec. */
+    using SpSchemaCodec = std::shared_ptr<SchemaCodec>;
+
     /*! @brief A holder for a shared pointer to a Set. */
     using SpSet = std::shared_ptr<Set>;
 
@@ -891,12 +1017,28 @@ namespace nImO
     /*! @brief A holder for a shared pointer to an Asio TCP/IP acceptor. */
     using SpAcceptorTCP = std::shared_ptr<BTCP::acceptor>;
 
+# if MAC_OR_LINUX_OR_BSD_
+    /*! @brief A holder for a shared pointer to an Asio local stream acceptor. */
+    using SpAcceptorLocalStream = std::shared_ptr<BLStream::acceptor>;
+# endif // MAC_OR_LINUX_OR_BSD_
+
     /*! @brief A holder for a shared pointer to an Asio deadline timer. */
     using SpDeadlineTimer = std::shared_ptr<BAD_t>;
 
     /*! @brief A holder for a shared pointer to a RegistryProxy. */
     using SpRegistryProxy = std::shared_ptr<RegistryProxy>;
 
+    /*! @brief A holder for a shared pointer to a SharedMemoryRing. */
+    using SpSharedMemoryRing = std::shared_ptr<SharedMemoryRing>;
+
+# if MAC_OR_LINUX_OR_BSD_
+    /*! @brief A holder for a shared pointer to an Asio local datagram socket. */
+    using SpSocketLocalDatagram = std::shared_ptr<BLDgram::socket>;
+
+    /*! @brief A holder for a shared pointer to an Asio local stream socket. */
+    using SpSocketLocalStream = std::shared_ptr<BLStream::socket>;
+# endif // MAC_OR_LINUX_OR_BSD_
+
     /*! @brief A holder for a shared pointer to an Asio TCP/IP socket. */
     using SpSocketTCP = std::shared_ptr<BTCP::socket>;
 
@@ -1014,6 +1156,13 @@ namespace nImO
     B2D
         (const NumberAsBytes &  inString);
 
+    /*! @brief Convert a set of bytes into a single-precision floating-point value.
+     @param[in] inString The byte string to be processed; only the first four bytes are used.
+     @return The floating-point value stored in the bytes. */
+    float
+    B2F
+        (const NumberAsBytes &  inString);
+
     /*! @brief Convert a set of bytes into an integer value.
      @param[in] inString The byte string to be processed.
      @param[in] numBytes The number of bytes to be processed.
@@ -1078,7 +1227,33 @@ namespace nImO
         (Ptr(Context)   context,
          const double   factor = 200.0);
 
+    /*! @brief Convert a sequence of characters to a double value, without depending on the locale.
+     Unlike ConvertToDouble(), neither leading white space nor a leading plus sign is accepted.
+     @param[in] first The first character to be converted.
+     @param[in] last The position after the last character to be converted.
+     @param[out] result The value represented by the characters.
+     @return @c true if the characters are exactly a representation of a double and @c false
+     otherwise. */
+    bool
+    ConvertCharsToDouble
+        (CPtr(char)     first,
+         CPtr(char)     last,
+         double &       result);
+
+    /*! @brief Write the text form of a double value to a buffer, without depending on the locale.
+     The text is the shortest one that reads back as the same value.
+     @param[in] first The start of the buffer.
+     @param[in] last The end of the buffer, which should allow for kNumberTextLength characters.
+     @param[in] value The value to be written.
+     @return The position after the last character written. */
+    Ptr(char)
+    ConvertDoubleToChars
+        (Ptr(char)      first,
+         Ptr(char)      last,
+         const double   value);
+
     /*! @brief Convert a double value to a string.
+     The string is the shortest one that reads back as the same value.
      @param[in] value The value to be represented in the string.
      @return The string representation of the value. */
     std::string
@@ -1086,6 +1261,7 @@ namespace nImO
         (const double   value);
 
     /*! @brief Convert a string to a double value.
+     Leading white space and a leading plus sign are accepted, as they were by strtod().
      @param[in] startPtr The string to be converted.
      @param[out] result The value represented by the string.
      @return @c true if the string contained a representation of a double and @c false
@@ -1148,6 +1324,14 @@ namespace nImO
         (CPtr(void)     address,
          const size_t   numBytes);
 
+    /*! @brief Convert a floating-point value into a set of bytes, as a single-precision value.
+     @param[in] inValue The number to be converted.
+     @param[out] outString The byte string to be filled; only the first four bytes are set. */
+    void
+    F2B
+        (const float        inValue,
+         NumberAsBytes &    outString);
+
     /*! @brief Return a random string of hexadecimal digits.
      @return A random string of hexadecimal digits. */
     std::string
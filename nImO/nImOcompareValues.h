@@ -55,7 +55,7 @@
 namespace nImO
 {
     /*! @brief A class to provide values that are used to compare pointers to values. */
-    class CompareValues final
+    class CompareValues
     {
 
         public :
@@ -0,0 +1,441 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/nImOcompression.cpp
+//
+//  Project:    nImO
+//
+//  Contains:   The function definitions for compression of Message bytes.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+#include <nImOcompression.h>
+
+#include <cstring>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The function definitions for compression of Message bytes. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace nImO;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of bits in a hash table index. */
+constexpr int       kHashBits{12};
+
+/*! @brief The number of bytes at the end of a block that are always literals. */
+constexpr size_t    kLastLiterals{5};
+
+/*! @brief The largest distance back to a match. */
+constexpr size_t    kMaxOffset{65535};
+
+/*! @brief The shortest match. */
+constexpr size_t    kMinMatch{4};
+
+/*! @brief The number of bytes at the end of a block in which a match can not start. */
+constexpr size_t    kMatchFindLimit{12};
+
+/*! @brief The extra space at the end of the expanded bytes, so that short copies can be done in fixed-size pieces. */
+constexpr size_t    kExpandSlack{32};
+
+/*! @brief The largest length that fits in one half of a sequence token. */
+constexpr size_t    kTokenLengthMask{15};
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return eight bytes, in whatever order they are in memory.
+ @param[in] data The position of the bytes.
+ @return The eight bytes. */
+static inline uint64_t
+fetchEightBytes
+    (CPtr(uint8_t)  data)
+{
+    uint64_t    result;
+
+    memcpy(&result, data, sizeof(result));
+    return result;
+} // fetchEightBytes
+
+/*! @brief Return four bytes, in whatever order they are in memory.
+ @param[in] data The position of the bytes.
+ @return The four bytes. */
+static inline uint32_t
+fetchFourBytes
+    (CPtr(uint8_t)  data)
+{
+    uint32_t    result;
+
+    memcpy(&result, data, sizeof(result));
+    return result;
+} // fetchFourBytes
+
+/*! @brief Return the hash table index for the four bytes at a position.
+ @param[in] data The position of the bytes.
+ @return The hash table index for the four bytes. */
+static inline uint32_t
+hashFourBytes
+    (CPtr(uint8_t)  data)
+{
+    return ((fetchFourBytes(data) * 2654435761U) >> (32 - kHashBits));
+} // hashFourBytes
+
+/*! @brief Read the continuation of a length from a compressed block.
+ @param[in,out] walker The position in the compressed block, which is advanced past the continuation.
+ @param[in] endOfInput The end of the compressed block.
+ @param[in,out] length The length to be extended.
+ @return @c true if the continuation is complete. */
+static bool
+readLength
+    (CPtr(uint8_t) &    walker,
+     CPtr(uint8_t)      endOfInput,
+     size_t &           length)
+{
+    bool    okSoFar{true};
+
+    for (uint8_t aByte = 255; okSoFar && (255 == aByte); )
+    {
+        if (walker < endOfInput)
+        {
+            aByte = *walker++;
+            length += aByte;
+        }
+        else
+        {
+            okSoFar = false;
+        }
+    }
+    return okSoFar;
+} // readLength
+
+/*! @brief Write the continuation of a length to a compressed block.
+ @param[in,out] outPtr The position in the compressed block, which is advanced past the continuation.
+ @param[in] length The part of the length that did not fit in the sequence token. */
+static void
+writeLength
+    (Ptr(uint8_t) & outPtr,
+     size_t         length)
+{
+    for ( ; 255 <= length; length -= 255)
+    {
+        *outPtr++ = 255;
+    }
+    *outPtr++ = StaticCast(uint8_t, length);
+} // writeLength
+
+/*! @brief Write a sequence, consisting of literal bytes and an optional match, to a compressed block.
+ @param[in,out] outPtr The position in the compressed block, which is advanced past the sequence.
+ @param[in] literals The literal bytes.
+ @param[in] numLiterals The number of literal bytes.
+ @param[in] offset The distance back to the match, or zero for the final sequence, which has no match.
+ @param[in] matchLength The length of the match. */
+static void
+writeSequence
+    (Ptr(uint8_t) & outPtr,
+     CPtr(uint8_t)  literals,
+     const size_t   numLiterals,
+     const size_t   offset,
+     const size_t   matchLength)
+{
+    Ptr(uint8_t)    token{outPtr++};
+
+    *token = StaticCast(uint8_t, std::min(numLiterals, kTokenLengthMask) << 4);
+    if (kTokenLengthMask <= numLiterals)
+    {
+        writeLength(outPtr, numLiterals - kTokenLengthMask);
+    }
+    memcpy(outPtr, literals, numLiterals);
+    outPtr += numLiterals;
+    if (0 < offset)
+    {
+        size_t  extraLength{matchLength - kMinMatch};
+
+        *outPtr++ = StaticCast(uint8_t, offset & 0x00FF);
+        *outPtr++ = StaticCast(uint8_t, (offset >> 8) & 0x00FF);
+        *token |= StaticCast(uint8_t, std::min(extraLength, kTokenLengthMask));
+        if (kTokenLengthMask <= extraLength)
+        {
+            writeLength(outPtr, extraLength - kTokenLengthMask);
+        }
+    }
+} // writeSequence
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+bool
+nImO::CompressMessageBytes
+    (CPtr(uint8_t)  data,
+     const size_t   numBytes,
+     std::string &  outBytes)
+{
+    ODL_ENTER(); //####
+    ODL_P2(data, &outBytes); //####
+    ODL_I1(numBytes); //####
+    bool    okSoFar{false};
+
+    // The receiver rejects a compressed Message that expands to more than this.
+    if (kCompressedMessageMaximumLength >= numBytes)
+    {
+        // The compressed block is never larger than this, even if nothing matches.
+        outBytes.resize(kCompressedMessageHeaderSize + numBytes + (numBytes / 255) + 16);
+        Ptr(uint8_t)    start{ReinterpretCast(Ptr(uint8_t), &outBytes[0])};
+        Ptr(uint8_t)    outPtr{start};
+        size_t          anchor{0};
+
+        *outPtr++ = kCompressedMessageMarker;
+        for (int shift = 24; 0 <= shift; shift -= 8)
+        {
+            *outPtr++ = StaticCast(uint8_t, (numBytes >> shift) & 0x00FF);
+        }
+        if ((kMatchFindLimit + 1) < numBytes)
+        {
+            std::vector<uint32_t>   table(1 << kHashBits, 0);
+            size_t                  searchLimit{numBytes - kMatchFindLimit};
+            size_t                  matchLimit{numBytes - kLastLiterals};
+
+            for (size_t ii = 1; ii < searchLimit; )
+            {
+                uint32_t    hash{hashFourBytes(data + ii)};
+                size_t      candidate{table[hash]};
+
+                table[hash] = StaticCast(uint32_t, ii);
+                if ((candidate < ii) && (kMaxOffset >= (ii - candidate)) && (fetchFourBytes(data + candidate) == fetchFourBytes(data + ii)))
+                {
+                    size_t  matchStart{ii};
+                    size_t  length{kMinMatch};
+
+                    for ( ; (matchStart > anchor) && (0 < candidate) && (data[matchStart - 1] == data[candidate - 1]); --matchStart, --candidate)
+                    {
+                        ++length;
+                    }
+                    for ( ; ((matchStart + length + 8) <= matchLimit) &&
+                         (fetchEightBytes(data + candidate + length) == fetchEightBytes(data + matchStart + length)); )
+                    {
+                        length += 8;
+                    }
+                    for ( ; ((matchStart + length) < matchLimit) && (data[candidate + length] == data[matchStart + length]); )
+                    {
+                        ++length;
+                    }
+                    writeSequence(outPtr, data + anchor, matchStart - anchor, matchStart - candidate, length);
+                    ii = anchor = matchStart + length;
+                    if (ii < searchLimit)
+                    {
+                        table[hashFourBytes(data + ii - 2)] = StaticCast(uint32_t, ii - 2);
+                    }
+                }
+                else
+                {
+                    // Skip ahead faster the longer that nothing has matched, so that incompressible data is cheap.
+                    ii += 1 + ((ii - anchor) >> 6);
+                }
+            }
+        }
+        writeSequence(outPtr, data + anchor, numBytes - anchor, 0, 0);
+        outBytes.resize(outPtr - start);
+        okSoFar = (outBytes.length() < numBytes);
+    }
+    else
+    {
+        ODL_LOG("! (kCompressedMessageMaximumLength >= numBytes)"); //####
+        outBytes.clear();
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::CompressMessageBytes
+
+bool
+nImO::ExpandMessageBytes
+    (CPtr(uint8_t)  data,
+     const size_t   numBytes,
+     ByteVector &   outBytes)
+{
+    ODL_ENTER(); //####
+    ODL_P2(data, &outBytes); //####
+    ODL_I1(numBytes); //####
+    bool    okSoFar{false};
+
+    outBytes.clear();
+    if ((kCompressedMessageHeaderSize <= numBytes) && IsCompressedMessage(data, numBytes))
+    {
+        size_t  expandedLength{0};
+
+        for (size_t ii = 1; ii < kCompressedMessageHeaderSize; ++ii)
+        {
+            expandedLength = (expandedLength << 8) + data[ii];
+        }
+        if (kCompressedMessageMaximumLength >= expandedLength)
+        {
+            CPtr(uint8_t)   walker{data + kCompressedMessageHeaderSize};
+            CPtr(uint8_t)   endOfInput{data + numBytes};
+            Ptr(uint8_t)    outPtr;
+            Ptr(uint8_t)    endOfOutput;
+
+            outBytes.resize(expandedLength + kExpandSlack);
+            outPtr = outBytes.data();
+            endOfOutput = outPtr + expandedLength;
+            for (okSoFar = true; okSoFar && (walker < endOfInput); )
+            {
+                uint8_t token{*walker++};
+                size_t  numLiterals{StaticCast(size_t, token >> 4)};
+
+                if (kTokenLengthMask == numLiterals)
+                {
+                    okSoFar = readLength(walker, endOfInput, numLiterals);
+                }
+                if (okSoFar && (numLiterals <= StaticCast(size_t, endOfInput - walker)) &&
+                    (numLiterals <= StaticCast(size_t, endOfOutput - outPtr)))
+                {
+                    // Most runs of literals are short, so they are copied as one fixed-size piece when possible.
+                    if ((16 >= numLiterals) && (16 <= (endOfInput - walker)))
+                    {
+                        memcpy(outPtr, walker, 16);
+                    }
+                    else
+                    {
+                        memcpy(outPtr, walker, numLiterals);
+                    }
+                    walker += numLiterals;
+                    outPtr += numLiterals;
+                    // The final sequence has no match.
+                    if (walker < endOfInput)
+                    {
+                        size_t  offset{0};
+                        size_t  matchLength{StaticCast(size_t, token & kTokenLengthMask)};
+
+                        if (2 <= (endOfInput - walker))
+                        {
+                            offset = walker[0] | (walker[1] << 8);
+                            walker += 2;
+                        }
+                        if ((0 < offset) && (offset <= StaticCast(size_t, outPtr - outBytes.data())))
+                        {
+                            if (kTokenLengthMask == matchLength)
+                            {
+                                okSoFar = readLength(walker, endOfInput, matchLength);
+                            }
+                            matchLength += kMinMatch;
+                            if (okSoFar && (matchLength <= StaticCast(size_t, endOfOutput - outPtr)))
+                            {
+                                CPtr(uint8_t)   source{outPtr - offset};
+
+                                if (8 <= offset)
+                                {
+                                    // Each piece is complete before it is read, even if the match overlaps the bytes being
+                                    // written; the slack absorbs the bytes written past the end of the match.
+                                    for (size_t ii = 0; ii < matchLength; ii += 8)
+                                    {
+                                        memcpy(outPtr + ii, source + ii, 8);
+                                    }
+                                    outPtr += matchLength;
+                                }
+                                else
+                                {
+                                    // The match overlaps the bytes being written, which repeats them.
+                                    for (size_t ii = 0; ii < matchLength; ++ii)
+                                    {
+                                        *outPtr++ = *source++;
+                                    }
+                                }
+                            }
+                            else
+                            {
+                                ODL_LOG("! (okSoFar && (matchLength <= StaticCast(size_t, endOfOutput - outPtr)))"); //####
+                                okSoFar = false;
+                            }
+                        }
+                        else
+                        {
+                            ODL_LOG("! ((0 < offset) && (offset <= StaticCast(size_t, outPtr - outBytes.data())))"); //####
+                            okSoFar = false;
+                        }
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (okSoFar && (numLiterals <= StaticCast(size_t, endOfInput - walker)) && " //####
+                            "(numLiterals <= StaticCast(size_t, endOfOutput - outPtr)))"); //####
+                    okSoFar = false;
+                }
+            }
+            okSoFar = (okSoFar && (outPtr == endOfOutput));
+            outBytes.resize(expandedLength);
+        }
+        else
+        {
+            ODL_LOG("! (kCompressedMessageMaximumLength >= expandedLength)"); //####
+        }
+    }
+    else
+    {
+        ODL_LOG("! ((kCompressedMessageHeaderSize <= numBytes) && IsCompressedMessage(data, numBytes))"); //####
+    }
+    if (! okSoFar)
+    {
+        outBytes.clear();
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::ExpandMessageBytes
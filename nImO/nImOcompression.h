@@ -0,0 +1,96 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/nImOcompression.h
+//
+//  Project:    nImO
+//
+//  Contains:   The function declarations for compression of Message bytes.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+#if (! defined(nImOcompression_H_))
+# define nImOcompression_H_ /* Header guard */
+
+# include <nImOcommon.h>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The function declarations for compression of Message bytes. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace nImO
+{
+
+    /*! @brief Compress the bytes of a Message.
+     The result is the compressed Message marker, the length of the uncompressed bytes as four big-endian
+     bytes and then the bytes compressed as an LZ4 block.
+     @param[in] data The bytes of the Message.
+     @param[in] numBytes The number of bytes in the Message.
+     @param[out] outBytes The compressed Message.
+     @return @c true if the compressed Message is smaller than the uncompressed Message and @c false if the
+     Message should be sent uncompressed, which includes a Message longer than kCompressedMessageMaximumLength. */
+    bool
+    CompressMessageBytes
+        (CPtr(uint8_t)  data,
+         const size_t   numBytes,
+         std::string &  outBytes);
+
+    /*! @brief Restore the bytes of a compressed Message.
+     @param[in] data The compressed Message, starting with the compressed Message marker.
+     @param[in] numBytes The number of bytes in the compressed Message.
+     @param[out] outBytes The bytes of the Message.
+     @return @c true if the compressed Message is well-formed. */
+    bool
+    ExpandMessageBytes
+        (CPtr(uint8_t)  data,
+         const size_t   numBytes,
+         ByteVector &   outBytes);
+
+    /*! @brief Return @c true if the bytes are a compressed Message.
+     @param[in] data The bytes to be checked.
+     @param[in] numBytes The number of bytes to be checked.
+     @return @c true if the bytes are a compressed Message. */
+    inline bool
+    IsCompressedMessage
+        (CPtr(uint8_t)  data,
+         const size_t   numBytes)
+    {
+        return ((0 < numBytes) && (kCompressedMessageMarker == data[0]));
+    }
+
+} // nImO
+
+#endif // not defined(nImOcompression_H_)
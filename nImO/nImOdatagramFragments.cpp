@@ -0,0 +1,307 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/nImOdatagramFragments.cpp
+//
+//  Project:    nImO
+//
+//  Contains:   The class and function definitions for fragments of UDP datagrams.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+#include <nImOdatagramFragments.h>
+
+#include <Containers/nImOmessage.h>
+
+#include <algorithm>
+#include <cstring>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class and function definitions for fragments of UDP datagrams. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace nImO;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of bytes of the datagram in each fragment except the last. */
+constexpr size_t    kFragmentPayloadSize{kFragmentMaximumLength - kFragmentHeaderSize};
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Read a big-endian value from a fragment header.
+ @param[in] data The first byte of the value.
+ @param[in] numBytes The number of bytes in the value.
+ @return The value. */
+static uint32_t
+fetchBigEndian
+    (CPtr(uint8_t)  data,
+     const size_t   numBytes)
+{
+    uint32_t    result{0};
+
+    for (size_t ii = 0; ii < numBytes; ++ii)
+    {
+        result = ((result << 8) | data[ii]);
+    }
+    return result;
+} // fetchBigEndian
+
+/*! @brief Append a big-endian value to a fragment header.
+ @param[in,out] fragment The fragment being built.
+ @param[in] value The value to be appended.
+ @param[in] numBytes The number of bytes in the value. */
+static void
+storeBigEndian
+    (std::string &  fragment,
+     const uint32_t value,
+     const size_t   numBytes)
+{
+    for (int shift = StaticCast(int, (numBytes - 1) * 8); 0 <= shift; shift -= 8)
+    {
+        fragment.push_back(StaticCast(char, (value >> shift) & 0x00FF));
+    }
+} // storeBigEndian
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+nImO::DatagramReassembler::DatagramReassembler
+    (const size_t   maximumEntries,
+     const long     timeout) :
+        _maximumEntries{maximumEntries}, _timeout{timeout}
+{
+    ODL_ENTER(); //####
+    ODL_I2(maximumEntries, timeout); //####
+    ODL_EXIT_P(this); //####
+} // nImO::DatagramReassembler::DatagramReassembler
+
+nImO::DatagramReassembler::~DatagramReassembler
+    (void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // nImO::DatagramReassembler::~DatagramReassembler
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+nImO::DatagramReassembler::addFragment
+    (const IPv4Address  senderAddress,
+     const IPv4Port     senderPort,
+     CPtr(uint8_t)      data,
+     const size_t       numBytes,
+     ByteVector &       outBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_X1(senderAddress); //####
+    ODL_I2(senderPort, numBytes); //####
+    ODL_P2(data, &outBytes); //####
+    bool    complete{false};
+    auto    now{Clock::now()};
+
+    dropStaleEntries(now);
+    if (IsDatagramFragment(data, numBytes) && (0 == data[1]))
+    {
+        uint32_t    datagramId{fetchBigEndian(data + 2, 4)};
+        size_t      index{fetchBigEndian(data + 6, 2)};
+        size_t      count{fetchBigEndian(data + 8, 2)};
+        size_t      partLength{numBytes - kFragmentHeaderSize};
+        bool        isLast{(index + 1) == count};
+
+        // Only the last fragment can be short, so the position of every fragment is known when it arrives.
+        if ((index < count) && (((count - 1) * kFragmentPayloadSize) < kFragmentedDatagramMaximumLength) && (0 < partLength) &&
+            (isLast ? (kFragmentPayloadSize >= partLength) : (kFragmentPayloadSize == partLength)))
+        {
+            PartialKey  key{senderAddress, senderPort, datagramId};
+            auto        walker{_partials.find(key)};
+
+            if (_partials.end() == walker)
+            {
+                if ((0 < _maximumEntries) && (_maximumEntries <= _partials.size()))
+                {
+                    auto    oldest{_partials.begin()};
+
+                    for (auto scanner = _partials.begin(); _partials.end() != scanner; ++scanner)
+                    {
+                        if (scanner->second._started < oldest->second._started)
+                        {
+                            oldest = scanner;
+                        }
+                    }
+                    ODL_LOG("dropping oldest partial datagram"); //####
+                    _partials.erase(oldest);
+                }
+                walker = _partials.emplace(key, PartialDatagram{}).first;
+                walker->second._bytes.resize(count * kFragmentPayloadSize);
+                walker->second._fragmentCount = count;
+                walker->second._received.assign(count, false);
+                walker->second._started = now;
+            }
+            PartialDatagram &   partial{walker->second};
+
+            if (partial._fragmentCount == count)
+            {
+                if (! partial._received[index])
+                {
+                    memcpy(partial._bytes.data() + (index * kFragmentPayloadSize), data + kFragmentHeaderSize, partLength);
+                    partial._received[index] = true;
+                    ++partial._receivedCount;
+                    if (isLast)
+                    {
+                        partial._length = (index * kFragmentPayloadSize) + partLength;
+                    }
+                    if (partial._receivedCount == partial._fragmentCount)
+                    {
+                        partial._bytes.resize(partial._length);
+                        outBytes.swap(partial._bytes);
+                        _partials.erase(walker);
+                        complete = true;
+                        ODL_B1(complete); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (! partial._received[index])"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (partial._fragmentCount == count)"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! ((index < count) && (((count - 1) * kFragmentPayloadSize) < kFragmentedDatagramMaximumLength) && " //####
+                    "(0 < partLength) && (isLast ? (kFragmentPayloadSize >= partLength) : " //####
+                    "(kFragmentPayloadSize == partLength)))"); //####
+        }
+    }
+    else
+    {
+        ODL_LOG("! (IsDatagramFragment(data, numBytes) && (0 == data[1]))"); //####
+    }
+    ODL_OBJEXIT_B(complete); //####
+    return complete;
+} // nImO::DatagramReassembler::addFragment
+
+void
+nImO::DatagramReassembler::dropStaleEntries
+    (const Clock::time_point    now)
+{
+    ODL_OBJENTER(); //####
+    for (auto walker = _partials.begin(); _partials.end() != walker; )
+    {
+        if ((now - walker->second._started) > _timeout)
+        {
+            ODL_LOG("dropping stale partial datagram"); //####
+            walker = _partials.erase(walker);
+        }
+        else
+        {
+            ++walker;
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::DatagramReassembler::dropStaleEntries
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+bool
+nImO::SplitDatagram
+    (const std::string &        datagram,
+     const uint32_t             datagramId,
+     std::vector<SpStdString> & fragments)
+{
+    ODL_ENTER(); //####
+    ODL_I1(datagramId); //####
+    ODL_P1(&fragments); //####
+    bool    okSoFar{false};
+    size_t  length{datagram.length()};
+
+    fragments.clear();
+    if ((0 < length) && (kFragmentedDatagramMaximumLength >= length))
+    {
+        size_t  count{(length + kFragmentPayloadSize - 1) / kFragmentPayloadSize};
+
+        fragments.reserve(count);
+        for (size_t index = 0, offset = 0; index < count; ++index, offset += kFragmentPayloadSize)
+        {
+            size_t  partLength{std::min(kFragmentPayloadSize, length - offset)};
+            auto    fragment{GetTransmissionBuffer(kFragmentHeaderSize + partLength)};
+
+            fragment->push_back(StaticCast(char, kFragmentMarker));
+            fragment->push_back(0);
+            storeBigEndian(*fragment, datagramId, 4);
+            storeBigEndian(*fragment, StaticCast(uint32_t, index), 2);
+            storeBigEndian(*fragment, StaticCast(uint32_t, count), 2);
+            fragment->append(datagram, offset, partLength);
+            fragments.push_back(fragment);
+        }
+        okSoFar = true;
+        ODL_B1(okSoFar); //####
+    }
+    else
+    {
+        ODL_LOG("! ((0 < length) && (kFragmentedDatagramMaximumLength >= length))"); //####
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::SplitDatagram
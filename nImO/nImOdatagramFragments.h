@@ -0,0 +1,233 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/nImOdatagramFragments.h
+//
+//  Project:    nImO
+//
+//  Contains:   The class and function declarations for fragments of UDP datagrams.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+#if (! defined(nImOdatagramFragments_H_))
+# define nImOdatagramFragments_H_ /* Header guard */
+
+# include <nImOcommon.h>
+
+# include <chrono>
+# include <tuple>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class and function declarations for fragments of UDP datagrams. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace nImO
+{
+    /*! @brief A class to rebuild UDP datagrams from their fragments.
+
+     The fragments of a datagram are collected in an entry that is identified by the sender and the
+     datagram identifier; they can arrive in any order and duplicates are ignored. The number of entries
+     is bounded: an entry that is not completed within the timeout is dropped, as is the oldest entry
+     when a new datagram starts and there is no room for it, so a lost fragment only costs the datagram
+     that it belongs to. */
+    class DatagramReassembler final
+    {
+
+        public :
+            // Public type definitions.
+
+        protected :
+            // Protected type definitions.
+
+        private :
+            // Private type definitions.
+
+            /*! @brief The clock used to time out partly-received datagrams. */
+            using Clock = std::chrono::steady_clock;
+
+            /*! @brief A partly-received datagram. */
+            struct PartialDatagram
+            {
+                /*! @brief The bytes of the datagram; each fragment is copied to its position. */
+                ByteVector  _bytes{};
+
+                /*! @brief The number of fragments in the datagram. */
+                size_t  _fragmentCount{0};
+
+                /*! @brief The number of bytes in the datagram, known once the last fragment has arrived. */
+                size_t  _length{0};
+
+                /*! @brief Which of the fragments have arrived. */
+                std::vector<bool>   _received{};
+
+                /*! @brief The number of fragments that have arrived. */
+                size_t  _receivedCount{0};
+
+                /*! @brief When the first fragment arrived. */
+                Clock::time_point   _started{};
+
+            }; // PartialDatagram
+
+            /*! @brief The sender address, sender port and datagram identifier of a partly-received datagram. */
+            using PartialKey = std::tuple<IPv4Address, IPv4Port, uint32_t>;
+
+        public :
+            // Public methods.
+
+            /*! @brief The constructor.
+             @param[in] maximumEntries The number of partly-received datagrams that are kept.
+             @param[in] timeout The time, in milliseconds, after which a partly-received datagram is dropped. */
+            DatagramReassembler
+                (const size_t   maximumEntries = kFragmentReassemblyTableSize,
+                 const long     timeout = kFragmentReassemblyTimeout);
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            DatagramReassembler
+                (const DatagramReassembler &    other) = delete;
+
+            /*! @brief The move constructor.
+             @param[in] other The object to be moved. */
+            DatagramReassembler
+                (DatagramReassembler && other)
+                noexcept = delete;
+
+            /*! @brief The destructor. */
+            ~DatagramReassembler
+                (void);
+
+            /*! @brief Add a fragment and return the datagram if it is now complete.
+             @param[in] senderAddress The address of the sender of the fragment.
+             @param[in] senderPort The port of the sender of the fragment.
+             @param[in] data The fragment, starting with the fragment marker.
+             @param[in] numBytes The number of bytes in the fragment.
+             @param[out] outBytes The bytes of the datagram, if it is complete.
+             @return @c true if the fragment completed a datagram and @c false if more fragments are needed or
+             the fragment was not well-formed. */
+            bool
+            addFragment
+                (const IPv4Address  senderAddress,
+                 const IPv4Port     senderPort,
+                 CPtr(uint8_t)      data,
+                 const size_t       numBytes,
+                 ByteVector &       outBytes);
+
+            /*! @brief Return the number of partly-received datagrams.
+             @return The number of partly-received datagrams. */
+            inline size_t
+            getPendingCount
+                (void)
+                const
+            {
+                return _partials.size();
+            }
+
+            /*! @brief The copy assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            DatagramReassembler &
+            operator=
+                (const DatagramReassembler &    other) = delete;
+
+            /*! @brief The move assignment operator.
+             @param[in] other The object to be moved.
+             @return The updated object. */
+            DatagramReassembler &
+            operator=
+                (DatagramReassembler && other)
+                noexcept = delete;
+
+        protected :
+            // Protected methods.
+
+        private :
+            // Private methods.
+
+            /*! @brief Drop the partly-received datagrams that have timed out.
+             @param[in] now The current time. */
+            void
+            dropStaleEntries
+                (const Clock::time_point    now);
+
+        public :
+            // Public fields.
+
+        protected :
+            // Protected fields.
+
+        private :
+            // Private fields.
+
+            /*! @brief The number of partly-received datagrams that are kept. */
+            size_t  _maximumEntries;
+
+            /*! @brief The partly-received datagrams. */
+            std::map<PartialKey, PartialDatagram>   _partials{};
+
+            /*! @brief The time after which a partly-received datagram is dropped. */
+            std::chrono::milliseconds   _timeout;
+
+    }; // DatagramReassembler
+
+    /*! @brief Return @c true if the bytes are a fragment of a datagram.
+     @param[in] data The bytes to be checked.
+     @param[in] numBytes The number of bytes to be checked.
+     @return @c true if the bytes are a fragment of a datagram. */
+    inline bool
+    IsDatagramFragment
+        (CPtr(uint8_t)  data,
+         const size_t   numBytes)
+    {
+        return ((kFragmentHeaderSize <= numBytes) && (kFragmentMarker == data[0]));
+    }
+
+    /*! @brief Split a datagram into fragments that each fit in a single UDP packet.
+     Each fragment is the fragment marker, a reserved byte, the datagram identifier, the index of the
+     fragment and the number of fragments, followed by a part of the datagram. All of the fragments except
+     the last hold the same number of bytes of the datagram, so the receiver can place each one as it arrives.
+     @param[in] datagram The datagram to be split.
+     @param[in] datagramId The identifier that the receiver uses to collect the fragments of the datagram.
+     @param[out] fragments The fragments, in order.
+     @return @c true if the datagram was split and @c false if it is too large to be sent as fragments. */
+    bool
+    SplitDatagram
+        (const std::string &        datagram,
+         const uint32_t             datagramId,
+         std::vector<SpStdString> & fragments);
+
+} // nImO
+
+#endif // not defined(nImOdatagramFragments_H_)
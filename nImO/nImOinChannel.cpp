@@ -38,12 +38,18 @@
 
 #include <nImOinChannel.h>
 
+#include <Containers/nImOdeltaCoder.h>
 #include <Contexts/nImOinputOutputContext.h>
 #include <nImOmainSupport.h>
+#include <nImOsharedMemoryRing.h>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
+#if MAC_OR_LINUX_OR_BSD_
+# include <unistd.h>
+#endif // MAC_OR_LINUX_OR_BSD_
+
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -63,6 +69,9 @@
 # pragma mark Private structures, constants and variables
 #endif // defined(__APPLE__)
 
+/*! @brief Used to make local socket paths unique within a process. */
+static std::atomic<uint32_t>    lLocalSocketCounter{0};
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -71,6 +80,23 @@
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+#if MAC_OR_LINUX_OR_BSD_
+/*! @brief Return a path for a new local socket that is unique on this machine.
+ @return A path for a new local socket. */
+static std::string
+makeLocalSocketPath
+    (void)
+{
+    ODL_ENTER(); //####
+    // Socket paths are limited to around a hundred characters, so the name is kept short.
+    auto        socketName{"nImO_"s + std::to_string(getpid()) + "_"s + std::to_string(++lLocalSocketCounter) + ".sock"s};
+    std::string result{(boost::filesystem::temp_directory_path() / socketName).string()};
+
+    ODL_EXIT_s(result); //####
+    return result;
+} // makeLocalSocketPath
+#endif // MAC_OR_LINUX_OR_BSD_
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -107,20 +133,398 @@ nImO::InChannel::~InChannel
 #endif // defined(__APPLE__)
 
 void
-nImO::InChannel::receiveTcpMessages
+nImO::InChannel::closeStreamConnection
+    (void)
+{
+    ODL_OBJENTER(); //####
+    BSErr   ignored;
+
+    if (TransportType::kTCP == _connection._transport)
+    {
+        _tcpSocket->shutdown(boost::asio::socket_base::shutdown_both, ignored);
+        _tcpSocket->close(ignored);
+        _tcpConnected = false;
+        ODL_B1(_tcpConnected); //####
+    }
+#if MAC_OR_LINUX_OR_BSD_
+    else
+    {
+        if (TransportType::kLocalStream == _connection._transport)
+        {
+            _localStreamSocket->shutdown(boost::asio::socket_base::shutdown_both, ignored);
+            _localStreamSocket->close(ignored);
+            _localStreamConnected = false;
+            ODL_B1(_localStreamConnected); //####
+        }
+    }
+#endif // MAC_OR_LINUX_OR_BSD_
+    ODL_OBJEXIT(); //####
+} // nImO::InChannel::closeStreamConnection
+
+std::string
+nImO::InChannel::getLocalEndpointName
+    (void)
+    const
+{
+    ODL_OBJENTER(); //####
+    std::string result{};
+
+    if (_sharedMemoryRing)
+    {
+        result = _sharedMemoryRing->getName();
+    }
+    else
+    {
+        result = _localSocketPath;
+    }
+    ODL_OBJEXIT_s(result); //####
+    return result;
+} // nImO::InChannel::getLocalEndpointName
+
+void
+nImO::InChannel::processUdpDatagram
+    (CPtr(char)         data,
+     const size_t       numBytes,
+     const IPv4Address  senderAddress,
+     const IPv4Port     senderPort)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(data); //####
+    ODL_I1(numBytes); //####
+    ODL_X1(senderAddress); //####
+    ODL_I1(senderPort); //####
+    if (_binaryFraming)
+    {
+        CPtr(uint8_t)    body;
+        size_t           bodyLength;
+
+        // A datagram holds exactly one frame, so a bad frame only loses that Message.
+        if (UnpackageFrame(ReinterpretCast(CPtr(uint8_t), data), numBytes, body, bodyLength))
+        {
+#if defined(nImO_ChattyTcpUdpLogging)
+            _context.report("got message."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+            _inQueue.addBytesAsMessage(_index, senderAddress, senderPort, body, bodyLength, nullptr, _deltaCoder, _schemaCodec,
+                                       _deliverMessages);
+            _statistics.update(bodyLength);
+        }
+    }
+    else
+    {
+#if defined(nImO_ChattyTcpUdpLogging)
+        _context.report("got message."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+        if (UnpackageMessage(data, numBytes, _decodedBytes))
+        {
+            _inQueue.addBytesAsMessage(_index, senderAddress, senderPort, _decodedBytes.data(), _decodedBytes.size(), nullptr,
+                                       _deltaCoder, _schemaCodec, _deliverMessages);
+            _statistics.update(numBytes - (kMessageSentinel.length() + 1));
+        }
+    }
+    requestKeyframe();
+    ODL_OBJEXIT(); //####
+} // nImO::InChannel::processUdpDatagram
+
+void
+nImO::InChannel::receiveLocalDatagrams
+    (void)
+{
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_OR_BSD_
+    if (gKeepRunning)
+    {
+        _localDatagramSocket->async_receive(boost::asio::buffer(_localDatagramBuffer),
+                                            [this]
+                                            (const BSErr        ec,
+                                             const std::size_t  length)
+                                            {
+                                                if (ec)
+                                                {
+                                                    if (BAErr::operation_aborted == ec)
+                                                    {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                                        _context.report("async_receive() operation cancelled."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                                        ODL_LOG("(BAErr::operation_aborted == ec)"); //####
+                                                    }
+                                                    else
+                                                    {
+                                                        auto    errMessage{"async_receive() failed -> "s + ec.message() + "."s};
+
+                                                        _context.report(errMessage);
+                                                    }
+                                                }
+                                                else
+                                                {
+                                                    CPtr(uint8_t)   body;
+                                                    size_t          bodyLength;
+
+                                                    // A datagram holds exactly one frame, and local datagrams are neither lost nor reordered.
+                                                    if (UnpackageFrame(_localDatagramBuffer.data(), length, body, bodyLength))
+                                                    {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                                        _context.report("got message."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                                        _inQueue.addBytesAsMessage(_index, body, bodyLength, nullptr, _deltaCoder, _schemaCodec,
+                                                                                   _deliverMessages);
+                                                        _statistics.update(bodyLength);
+                                                    }
+                                                    receiveLocalDatagrams();
+                                                }
+                                            });
+    }
+#endif // MAC_OR_LINUX_OR_BSD_
+    ODL_EXIT(); //####
+} // nImO::InChannel::receiveLocalDatagrams
+
+void
+nImO::InChannel::receiveLocalStreamFrames
+    (void)
+{
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_OR_BSD_
+    if (gKeepRunning)
+    {
+        // Only one read is outstanding at a time, so the frame buffer can be reused.
+        _frameBuffer.resize(kFrameHeaderSize);
+        boost::asio::async_read(*_localStreamSocket, boost::asio::buffer(_frameBuffer),
+                                [this]
+                                (const BSErr &      ec,
+                                 const std::size_t  size)
+                                {
+                                    NIMO_UNUSED_VAR_(size);
+                                    size_t  remainingLength;
+
+                                    if (ec)
+                                    {
+                                        if (BAErr::operation_aborted == ec)
+                                        {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                            _context.report("async_read() operation cancelled."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                            ODL_LOG("(BAErr::operation_aborted == ec)"); //####
+                                        }
+                                        else
+                                        {
+                                            auto    errMessage{"async_read() failed -> "s + ec.message() + "."s};
+
+                                            _context.report(errMessage);
+                                        }
+                                    }
+                                    else
+                                    {
+                                        if (UnpackageFrameHeader(_frameBuffer.data(), remainingLength))
+                                        {
+                                            _frameBuffer.resize(kFrameHeaderSize + remainingLength);
+                                            boost::asio::async_read(*_localStreamSocket,
+                                                                    boost::asio::buffer(_frameBuffer.data() + kFrameHeaderSize, remainingLength),
+                                                                    [this]
+                                                                    (const BSErr &      ec2,
+                                                                     const std::size_t  size2)
+                                                                    {
+                                                                        NIMO_UNUSED_VAR_(size2);
+                                                                        CPtr(uint8_t)   body;
+                                                                        size_t          bodyLength;
+
+                                                                        if (ec2)
+                                                                        {
+                                                                            if (BAErr::operation_aborted == ec2)
+                                                                            {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                                                                _context.report("async_read() operation cancelled."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                                                                ODL_LOG("(BAErr::operation_aborted == ec2)"); //####
+                                                                            }
+                                                                            else
+                                                                            {
+                                                                                auto    errMessage{"async_read() failed -> "s + ec2.message() + "."s};
+
+                                                                                _context.report(errMessage);
+                                                                            }
+                                                                        }
+                                                                        else
+                                                                        {
+                                                                            bool    messageLost{false};
+
+                                                                            if (UnpackageFrame(_frameBuffer.data(), _frameBuffer.size(), body, bodyLength))
+                                                                            {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                                                                _context.report("got message."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                                                                messageLost = (! _inQueue.addBytesAsMessage(_index, body, bodyLength, _keyDictionary, _deltaCoder, _schemaCodec, _deliverMessages));
+                                                                                _statistics.update(bodyLength);
+                                                                            }
+                                                                            else
+                                                                            {
+                                                                                // The frame was delimited correctly, so the stream can still be followed.
+                                                                                _context.report("bad checksum in received frame."s);
+                                                                                messageLost = true;
+                                                                            }
+                                                                            if (messageLost && _keyDictionary)
+                                                                            {
+                                                                                // The lost Message may have defined Map keys that later Messages refer to.
+                                                                                _context.report("Message lost on a connection with a key dictionary; closing connection."s);
+                                                                                closeStreamConnection();
+                                                                            }
+                                                                            else
+                                                                            {
+                                                                                requestKeyframe();
+                                                                                receiveLocalStreamFrames();
+                                                                            }
+                                                                        }
+                                                                    });
+                                        }
+                                        else
+                                        {
+                                            // There is no way to find the next frame in the stream, so the connection is closed and the sender sees it go away.
+                                            _context.report("invalid frame header received; closing connection."s);
+                                            closeStreamConnection();
+                                        }
+                                    }
+                                });
+    }
+#endif // MAC_OR_LINUX_OR_BSD_
+    ODL_EXIT(); //####
+} // nImO::InChannel::receiveLocalStreamFrames
+
+void
+nImO::InChannel::receiveSharedMemoryMessages
+    (void)
+{
+    ODL_OBJENTER(); //####
+    // The ring is only closed when the channel is stopped or the sender goes away.
+    for ( ; gKeepRunning && _sharedMemoryRing->readMessage(_sharedMemoryBytes); )
+    {
+#if defined(nImO_ChattyTcpUdpLogging)
+        _context.report("got message."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+        _inQueue.addBytesAsMessage(_index, _sharedMemoryBytes.data(), _sharedMemoryBytes.size(), nullptr, _deltaCoder, _schemaCodec,
+                                   _deliverMessages);
+        _statistics.update(_sharedMemoryBytes.size());
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::InChannel::receiveSharedMemoryMessages
+
+void
+nImO::InChannel::receiveTcpFrames
     (void)
 {
     ODL_ENTER(); //####
     if (gKeepRunning)
     {
-        auto    rB{std::make_shared<boost::asio::streambuf>()};
+        // Only one read is outstanding at a time, so the frame buffer can be reused.
+        _frameBuffer.resize(kFrameHeaderSize);
+        boost::asio::async_read(*_tcpSocket, boost::asio::buffer(_frameBuffer),
+                                [this]
+                                (const BSErr &      ec,
+                                 const std::size_t  size)
+                                {
+                                    NIMO_UNUSED_VAR_(size);
+                                    size_t  remainingLength;
+
+                                    if (ec)
+                                    {
+                                        if (BAErr::operation_aborted == ec)
+                                        {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                            _context.report("async_read() operation cancelled."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                            ODL_LOG("(BAErr::operation_aborted == ec)"); //####
+                                        }
+                                        else
+                                        {
+                                            auto    errMessage{"async_read() failed -> "s + ec.message() + "."s};
+
+                                            _context.report(errMessage);
+                                        }
+                                    }
+                                    else
+                                    {
+                                        if (UnpackageFrameHeader(_frameBuffer.data(), remainingLength))
+                                        {
+                                            _frameBuffer.resize(kFrameHeaderSize + remainingLength);
+                                            boost::asio::async_read(*_tcpSocket, boost::asio::buffer(_frameBuffer.data() + kFrameHeaderSize, remainingLength),
+                                                                    [this]
+                                                                    (const BSErr &      ec2,
+                                                                     const std::size_t  size2)
+                                                                    {
+                                                                        NIMO_UNUSED_VAR_(size2);
+                                                                        CPtr(uint8_t)   body;
+                                                                        size_t          bodyLength;
+
+                                                                        if (ec2)
+                                                                        {
+                                                                            if (BAErr::operation_aborted == ec2)
+                                                                            {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                                                                _context.report("async_read() operation cancelled."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                                                                ODL_LOG("(BAErr::operation_aborted == ec2)"); //####
+                                                                            }
+                                                                            else
+                                                                            {
+                                                                                auto    errMessage{"async_read() failed -> "s + ec2.message() + "."s};
+
+                                                                                _context.report(errMessage);
+                                                                            }
+                                                                        }
+                                                                        else
+                                                                        {
+                                                                            bool    messageLost{false};
+
+                                                                            if (UnpackageFrame(_frameBuffer.data(), _frameBuffer.size(), body, bodyLength))
+                                                                            {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                                                                _context.report("got message."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                                                                messageLost = (! _inQueue.addBytesAsMessage(_index, body, bodyLength, _keyDictionary, _deltaCoder, _schemaCodec, _deliverMessages));
+                                                                                _statistics.update(bodyLength);
+                                                                            }
+                                                                            else
+                                                                            {
+                                                                                // The frame was delimited correctly, so the stream can still be followed.
+                                                                                _context.report("bad checksum in received frame."s);
+                                                                                messageLost = true;
+                                                                            }
+                                                                            if (messageLost && _keyDictionary)
+                                                                            {
+                                                                                // The lost Message may have defined Map keys that later Messages refer to.
+                                                                                _context.report("Message lost on a connection with a key dictionary; closing connection."s);
+                                                                                closeStreamConnection();
+                                                                            }
+                                                                            else
+                                                                            {
+                                                                                requestKeyframe();
+                                                                                receiveTcpFrames();
+                                                                            }
+                                                                        }
+                                                                    });
+                                        }
+                                        else
+                                        {
+                                            // There is no way to find the next frame in the stream, so the connection is closed and the sender sees it go away.
+                                            _context.report("invalid frame header received; closing connection."s);
+                                            closeStreamConnection();
+                                        }
+                                    }
+                                });
+    }
+    ODL_EXIT(); //####
+} // nImO::InChannel::receiveTcpFrames
 
-        boost::asio::async_read_until(*_tcpSocket, *rB, nImO::MatchMessageSeparator,
-                                    [this, rB]
+void
+nImO::InChannel::receiveTcpMessages
+    (void)
+{
+    ODL_ENTER(); //####
+    if (gKeepRunning)
+    {
+        // Bytes past the separator stay in the buffer, so a burst of Messages is handled without further reads.
+        boost::asio::async_read_until(*_tcpSocket, _receiveBuffer, nImO::MatchMessageSeparator,
+                                    [this]
                                     (const BSErr &      ec,
                                      const std::size_t  size)
                                     {
-                                        NIMO_UNUSED_VAR_(size);
                                         if (ec)
                                         {
                                             if (BAErr::operation_aborted == ec)
@@ -139,16 +543,31 @@ nImO::InChannel::receiveTcpMessages
                                         }
                                         else
                                         {
-                                            std::string receivedAsString{buffers_begin(rB->data()), buffers_end(rB->data())};
-                                            auto        trimmed{UnpackageMessage(receivedAsString)};
+                                            // The input sequence of a streambuf is contiguous, so it is decoded where it is.
+                                            auto    received{StaticCast(CPtr(char), _receiveBuffer.data().data())};
+                                            bool    messageLost{true};
 
-                                            ODL_S1s(trimmed); //####
 #if defined(nImO_ChattyTcpUdpLogging)
                                             _context.report("got message."s);
 #endif /* defined(nImO_ChattyTcpUdpLogging) */
-                                            _inQueue.addRawBytesAsMessage(_index, trimmed);
-                                            _statistics.update(trimmed.length());
-                                            receiveTcpMessages();
+                                            if (UnpackageMessage(received, size, _decodedBytes))
+                                            {
+                                                messageLost = (! _inQueue.addBytesAsMessage(_index, _decodedBytes.data(), _decodedBytes.size(),
+                                                                                            _keyDictionary, _deltaCoder, _schemaCodec, _deliverMessages));
+                                                _statistics.update(size - (kMessageSentinel.length() + 1));
+                                            }
+                                            _receiveBuffer.consume(size);
+                                            if (messageLost && _keyDictionary)
+                                            {
+                                                // The lost Message may have defined Map keys that later Messages refer to.
+                                                _context.report("Message lost on a connection with a key dictionary; closing connection."s);
+                                                closeStreamConnection();
+                                            }
+                                            else
+                                            {
+                                                requestKeyframe();
+                                                receiveTcpMessages();
+                                            }
                                         }
                                     });
     }
@@ -191,15 +610,21 @@ nImO::InChannel::receiveUdpMessages
 
                                                if (_unfiltered || ((_matchAddress == senderAddress) && (_matchPort == senderPort)))
                                                {
-                                                   std::string  receivedAsString{_rawData.data(), length};
-                                                   auto         trimmed{UnpackageMessage(receivedAsString)};
+                                                   CPtr(uint8_t)    rawBytes{ReinterpretCast(CPtr(uint8_t), _rawData.data())};
 
-                                                   ODL_S1s(trimmed); //####
-#if defined(nImO_ChattyTcpUdpLogging)
-                                                   _context.report("got message."s);
-#endif /* defined(nImO_ChattyTcpUdpLogging) */
-                                                   _inQueue.addRawBytesAsMessage(_index, senderAddress, senderPort, trimmed);
-                                                   _statistics.update(trimmed.length());
+                                                   // A large datagram arrives as fragments and is only processed once all of them are here.
+                                                   if (IsDatagramFragment(rawBytes, length))
+                                                   {
+                                                       if (_reassembler.addFragment(senderAddress, senderPort, rawBytes, length, _reassembledDatagram))
+                                                       {
+                                                           processUdpDatagram(ReinterpretCast(CPtr(char), _reassembledDatagram.data()),
+                                                                              _reassembledDatagram.size(), senderAddress, senderPort);
+                                                       }
+                                                   }
+                                                   else
+                                                   {
+                                                       processUdpDatagram(_rawData.data(), length, senderAddress, senderPort);
+                                                   }
                                                }
                                                receiveUdpMessages();
                                            }
@@ -208,15 +633,108 @@ nImO::InChannel::receiveUdpMessages
     ODL_EXIT(); //####
 } // nImO::InChannel::receiveUdpMessages
 
+void
+nImO::InChannel::requestKeyframe
+    (void)
+{
+    ODL_OBJENTER(); //####
+    if (_deltaCoder && _deltaCoder->isKeyframeNeeded())
+    {
+        ODL_LOG("(_deltaCoder && _deltaCoder->isKeyframeNeeded())"); //####
+        static const auto   request{std::make_shared<std::string>(kDeltaKeyframeRequest)};
+        auto                handleWrite{[this]
+                                        (const BSErr &      ec,
+                                         const std::size_t  length)
+                                        {
+                                            NIMO_UNUSED_VAR_(length);
+                                            _keyframeRequestPending = false;
+                                            if (ec)
+                                            {
+                                                if (BAErr::operation_aborted == ec)
+                                                {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                                    _context.report("async_write() operation cancelled."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                                    ODL_LOG("(BAErr::operation_aborted == ec)"); //####
+                                                }
+                                                else
+                                                {
+                                                    auto    errMessage{"async_write() failed -> "s + ec.message() + "."s};
+
+                                                    _context.report(errMessage);
+                                                }
+                                            }
+                                        }};
+
+        if (TransportType::kUDP == _connection._transport)
+        {
+            _udpSocket->async_send_to(boost::asio::buffer(*request), _udpSenderEndpoint,
+                                      [this]
+                                      (const BSErr          ec,
+                                       const std::size_t    length)
+                                      {
+                                        NIMO_UNUSED_VAR_(length);
+                                        if (ec)
+                                        {
+                                            if (BAErr::operation_aborted == ec)
+                                            {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                                _context.report("async_send_to() operation cancelled."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                                ODL_LOG("(BAErr::operation_aborted == ec)"); //####
+                                            }
+                                            else
+                                            {
+                                                auto    errMessage{"async_send_to() failed -> "s + ec.message() + "."s};
+
+                                                _context.report(errMessage);
+                                            }
+                                        }
+                                      });
+        }
+        else
+        {
+            // Only one request is written at a time, so that requests are never interleaved in the stream.
+            if (! _keyframeRequestPending.exchange(true))
+            {
+                if (TransportType::kTCP == _connection._transport)
+                {
+                    boost::asio::async_write(*_tcpSocket, boost::asio::buffer(*request), handleWrite);
+                }
+                else
+                {
+#if MAC_OR_LINUX_OR_BSD_
+                    if (TransportType::kLocalStream == _connection._transport)
+                    {
+                        boost::asio::async_write(*_localStreamSocket, boost::asio::buffer(*request), handleWrite);
+                    }
+                    else
+                    {
+                        _keyframeRequestPending = false;
+                    }
+#else // not MAC_OR_LINUX_OR_BSD_
+                    _keyframeRequestPending = false;
+#endif // not MAC_OR_LINUX_OR_BSD_
+                }
+            }
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::InChannel::requestKeyframe
+
 bool
 nImO::InChannel::setUp
-    (const TransportType    mode)
+    (const TransportType    mode,
+     const bool             useKeyDictionary)
 {
     ODL_OBJENTER(); //####
     ODL_I1(StaticCast(int, mode)); //####
+    ODL_B1(useKeyDictionary); //####
     bool    okSoFar{false};
 
     _connection._transport = mode;
+    // Messages encoded by a schema codec carry their Map keys in full, so there is no use for a dictionary.
+    setUpKeyDictionary(useKeyDictionary && (nullptr == _schemaCodec));
     // Set up network activity.
     if (TransportType::kUDP == _connection._transport)
     {
@@ -227,6 +745,8 @@ nImO::InChannel::setUp
         _udpSocket->open(inEndpoint.protocol());
         _udpSocket->set_option(BUDP::socket::reuse_address(true));
         _udpSocket->bind(inEndpoint);
+        // Room for all the fragments of a large datagram, as they arrive faster than they are processed; the system may limit this.
+        _udpSocket->set_option(boost::asio::socket_base::receive_buffer_size(StaticCast(int, kFragmentedDatagramMaximumLength)));
         _connection._address = ntohl(ContextWithMDNS::gServiceAddressIpv4.sin_addr.s_addr);
         _connection._port = _udpSocket->local_endpoint().port();
         okSoFar = true;
@@ -251,6 +771,53 @@ nImO::InChannel::setUp
             okSoFar = true;
             ODL_B1(okSoFar); //####
         }
+        else
+        {
+            if (TransportType::kSharedMemory == _connection._transport)
+            {
+                // The address is still reported, as the sender must be on the same machine.
+                _sharedMemoryRing = std::make_shared<SharedMemoryRing>(SharedMemoryRing::MakeName(), true);
+                _connection._address = ntohl(ContextWithMDNS::gServiceAddressIpv4.sin_addr.s_addr);
+                _connection._port = 0;
+                okSoFar = _sharedMemoryRing->isOpen();
+                ODL_B1(okSoFar); //####
+            }
+            else
+            {
+#if MAC_OR_LINUX_OR_BSD_
+                if (TransportType::kLocalStream == _connection._transport)
+                {
+                    _localSocketPath = makeLocalSocketPath();
+                    _localStreamAcceptor = std::make_shared<BLStream::acceptor>(*_context.getService(), BLStream::endpoint{_localSocketPath});
+                    _localStreamSocket = std::make_shared<BLStream::socket>(*_context.getService());
+                    _connection._address = ntohl(ContextWithMDNS::gServiceAddressIpv4.sin_addr.s_addr);
+                    _connection._port = 0;
+#if defined(nImO_ChattyTcpUdpLogging)
+                    _context.report("acceptor path = "s + _localSocketPath + "."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                    okSoFar = true;
+                    ODL_B1(okSoFar); //####
+                }
+                else
+                {
+                    if (TransportType::kLocalDatagram == _connection._transport)
+                    {
+                        _localSocketPath = makeLocalSocketPath();
+                        _localDatagramSocket = std::make_shared<BLDgram::socket>(*_context.getService(), BLDgram::endpoint{_localSocketPath});
+                        _localDatagramSocket->set_option(boost::asio::socket_base::receive_buffer_size(kLocalDatagramMaximumLength));
+                        _localDatagramBuffer.resize(kLocalDatagramMaximumLength);
+                        _connection._address = ntohl(ContextWithMDNS::gServiceAddressIpv4.sin_addr.s_addr);
+                        _connection._port = 0;
+#if defined(nImO_ChattyTcpUdpLogging)
+                        _context.report("local path = "s + _localSocketPath + "."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                        okSoFar = true;
+                        ODL_B1(okSoFar); //####
+                    }
+                }
+#endif // MAC_OR_LINUX_OR_BSD_
+            }
+        }
     }
     ODL_OBJEXIT_B(okSoFar); //####
     return okSoFar;
@@ -259,15 +826,29 @@ nImO::InChannel::setUp
 bool
 nImO::InChannel::start
     (const IPv4Address  senderAddress,
-     const IPv4Port     senderPort)
+     const IPv4Port     senderPort,
+     const bool         useDeltaEncoding,
+     const bool         useBinaryFraming)
 {
     ODL_OBJENTER(); //####
     ODL_X1(senderAddress); //####
     ODL_I1(senderPort); //####
+    ODL_B2(useDeltaEncoding, useBinaryFraming); //####
     bool    okSoFar{false};
 
     _matchAddress = senderAddress;
     _matchPort = senderPort;
+    _binaryFraming = useBinaryFraming;
+    if (useDeltaEncoding)
+    {
+        ODL_LOG("(useDeltaEncoding)"); //####
+        _deltaCoder = std::make_shared<DeltaCoder>(0);
+    }
+    else
+    {
+        ODL_LOG("! (useDeltaEncoding)"); //####
+        _deltaCoder.reset();
+    }
     // Start network activity.
     if (TransportType::kUDP == _connection._transport)
     {
@@ -284,6 +865,8 @@ nImO::InChannel::start
         {
             // Start the acceptor listening.
             _unfiltered = true;
+            resetKeyDictionary();
+            _receiveBuffer.consume(_receiveBuffer.size());
             _tcpAcceptor->async_accept(*_tcpSocket,
                                        [this]
                                        (const BSErr ec)
@@ -306,12 +889,88 @@ nImO::InChannel::start
                                             {
                                                 _tcpConnected = true;
                                                 ODL_B1(_tcpConnected); //####
-                                                receiveTcpMessages();
+                                                if (_binaryFraming)
+                                                {
+                                                    receiveTcpFrames();
+                                                }
+                                                else
+                                                {
+                                                    receiveTcpMessages();
+                                                }
                                             }
                                        });
             okSoFar = true;
             ODL_B1(okSoFar); //####
         }
+        else
+        {
+            if ((TransportType::kSharedMemory == _connection._transport) && (nullptr == _sharedMemoryThread))
+            {
+                // Reading from the ring blocks, so it is done in its own thread rather than by the I/O service.
+                _unfiltered = true;
+                _sharedMemoryConnected = true;
+                ODL_B1(_sharedMemoryConnected); //####
+                _sharedMemoryThread = new boost::thread([this]
+                                                        (void)
+                                                        {
+                                                            receiveSharedMemoryMessages();
+                                                        });
+                okSoFar = true;
+                ODL_B1(okSoFar); //####
+            }
+            else
+            {
+#if MAC_OR_LINUX_OR_BSD_
+                // Local connections always use binary frames, as every sender that supports them can send frames.
+                if (TransportType::kLocalStream == _connection._transport)
+                {
+                    _unfiltered = true;
+                    _binaryFraming = true;
+                    resetKeyDictionary();
+                    _localStreamAcceptor->async_accept(*_localStreamSocket,
+                                                       [this]
+                                                       (const BSErr ec)
+                                                       {
+                                                            if (ec)
+                                                            {
+                                                                if (BAErr::operation_aborted == ec)
+                                                                {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                                                    _context.report("async_accept() operation cancelled."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                                                    ODL_LOG("(BAErr::operation_aborted == ec)"); //####
+                                                                }
+                                                                else
+                                                                {
+                                                                    _context.report("async_accept() failed -> "s + ec.message() + "."s);
+                                                                }
+                                                            }
+                                                            else
+                                                            {
+                                                                _localStreamConnected = true;
+                                                                ODL_B1(_localStreamConnected); //####
+                                                                receiveLocalStreamFrames();
+                                                            }
+                                                       });
+                    okSoFar = true;
+                    ODL_B1(okSoFar); //####
+                }
+                else
+                {
+                    if (TransportType::kLocalDatagram == _connection._transport)
+                    {
+                        _unfiltered = true;
+                        _binaryFraming = true;
+                        _localDatagramConnected = true;
+                        ODL_B1(_localDatagramConnected); //####
+                        receiveLocalDatagrams();
+                        okSoFar = true;
+                        ODL_B1(okSoFar); //####
+                    }
+                }
+#endif // MAC_OR_LINUX_OR_BSD_
+            }
+        }
     }
     ODL_OBJEXIT_B(okSoFar); //####
     return okSoFar;
@@ -355,10 +1014,67 @@ nImO::InChannel::stop
         }
         else
         {
+            if (TransportType::kSharedMemory == _connection._transport)
+            {
+                // Closing the ring wakes the receiving thread, which then ends.
+                _sharedMemoryRing->close();
+                if (nullptr != _sharedMemoryThread)
+                {
+                    _sharedMemoryThread->join();
+                    delete _sharedMemoryThread;
+                    _sharedMemoryThread = nullptr;
+                }
+                _sharedMemoryRing.reset();
+                _sharedMemoryConnected = false;
+                ODL_B1(_sharedMemoryConnected); //####
+            }
+#if MAC_OR_LINUX_OR_BSD_
+            else
+            {
+                if (TransportType::kLocalStream == _connection._transport)
+                {
+                    if (_localStreamSocket->is_open())
+                    {
+                        _localStreamSocket->cancel();
+                    }
+                    if (_localStreamAcceptor->is_open())
+                    {
+                        _localStreamAcceptor->close();
+                    }
+                    _localStreamConnected = false;
+                    ODL_B1(_localStreamConnected); //####
+                }
+                else
+                {
+                    if (TransportType::kLocalDatagram == _connection._transport)
+                    {
+                        if (_localDatagramSocket->is_open())
+                        {
+                            _localDatagramSocket->cancel();
+                        }
+                        _localDatagramConnected = false;
+                        ODL_B1(_localDatagramConnected); //####
+                    }
+                }
+                // The socket is bound to a path, which would otherwise be left behind.
+                if (! _localSocketPath.empty())
+                {
+                    BSErr   ec;
+
+                    boost::filesystem::remove(_localSocketPath, ec);
+                    _localSocketPath.clear();
+                }
+            }
+#endif // MAC_OR_LINUX_OR_BSD_
             okSoFar = true;
             ODL_B1(okSoFar); //####
         }
     }
+    resetKeyDictionary();
+    _deltaCoder.reset();
+    _schemaCodec.reset();
+    _keyframeRequestPending = false;
+    _binaryFraming = false;
     _connection._transport = TransportType::kUnknown;
     ODL_OBJEXIT_B(okSoFar); //####
     return okSoFar;
@@ -40,8 +40,11 @@
 # define nImOinChannel_H_ /* Header guard */
 
 # include <nImObaseChannel.h>
+# include <nImOdatagramFragments.h>
 # include <nImOreceiveQueue.h>
 
+# include <boost/thread.hpp>
+
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
 #  pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -97,6 +100,15 @@ namespace nImO
                 (void)
                 override;
 
+            /*! @brief Return the name that a sender on the same machine uses to reach the channel.
+             This is the name of the shared memory segment or the path of the local socket.
+             @return The name that a sender on the same machine uses to reach the channel, or an empty string
+             if the channel does not use a local transport. */
+            std::string
+            getLocalEndpointName
+                (void)
+                const;
+
             /*! @brief The move assignment operator.
              @param[in] other The object to be moved.
              @return The updated object. */
@@ -105,6 +117,26 @@ namespace nImO
                 (InChannel && other)
                 noexcept = delete;
 
+            /*! @brief Receive binary-framed messages via the TCP socket. */
+            void
+            receiveTcpFrames
+                (void);
+
+            /*! @brief Receive messages via the local datagram socket. */
+            void
+            receiveLocalDatagrams
+                (void);
+
+            /*! @brief Receive binary-framed messages via the local stream socket. */
+            void
+            receiveLocalStreamFrames
+                (void);
+
+            /*! @brief Receive messages via the shared memory ring, until it is closed. */
+            void
+            receiveSharedMemoryMessages
+                (void);
+
             /*! @brief Receive messages via the TCP socket. */
             void
             receiveTcpMessages
@@ -115,18 +147,39 @@ namespace nImO
             receiveUdpMessages
                 (void);
 
+            /*! @brief Set whether received Messages are delivered as Messages rather than as Values.
+             A delivered Message can be read without building any Values, as with DecodeBoundValue(), and Messages
+             are delivered even if there is a schema codec for the data type of the connection.
+             @param[in] deliverMessages @c true if received Messages are to be delivered as Messages. */
+            inline void
+            setDeliverMessages
+                (const bool deliverMessages)
+            {
+                _deliverMessages = deliverMessages;
+            }
+
+            /*! @brief Configure the network port for the channel.
+             @param[in] mode The transport mode to use.
+             @param[in] useKeyDictionary @c true if the sender has been asked to use a dictionary for Map keys,
+             which is only used if there is no schema codec for the data type of the connection.
+             @return @c true if the network information for the channel was set up. */
             bool
             setUp
-                (const TransportType    mode);
+                (const TransportType    mode,
+                 const bool             useKeyDictionary = false);
 
             /*! @brief Start the channel.
              @param[in] senderAddress The allowed address for messages.
              @param[in] senderPort The allowed port for messages.
+             @param[in] useDeltaEncoding @c true if the sender sends delta-encoded Values.
+             @param[in] useBinaryFraming @c true if the sender sends Messages in binary frames rather than as MIME.
              @return @c true if the channel was successfully started. */
             bool
             start
                 (const IPv4Address  senderAddress,
-                 const IPv4Port     senderPort);
+                 const IPv4Port     senderPort,
+                 const bool         useDeltaEncoding = false,
+                 const bool         useBinaryFraming = false);
 
             /*! @brief Stop the channel and clear settings.
              @return @c true if the channel was successfully stopped. */
@@ -141,6 +194,31 @@ namespace nImO
         private :
             // Private methods.
 
+            /*! @brief Close the TCP or local stream connection, so that the sender sees it go away.
+             This is used when the stream can not be followed or a Message that may have defined Map keys was
+             lost, so that both ends start again with empty key dictionaries. */
+            void
+            closeStreamConnection
+                (void);
+
+            /*! @brief Turn a complete datagram received via UDP into a Message.
+             @param[in] data The datagram.
+             @param[in] numBytes The number of bytes in the datagram.
+             @param[in] senderAddress The address of the sender of the datagram.
+             @param[in] senderPort The port of the sender of the datagram. */
+            void
+            processUdpDatagram
+                (CPtr(char)         data,
+                 const size_t       numBytes,
+                 const IPv4Address  senderAddress,
+                 const IPv4Port     senderPort);
+
+            /*! @brief Ask the sender for a keyframe, if delta-encoded Values can no longer be reconstructed.
+             The request is sent as a datagram for UDP and is written to the connection for TCP and local streams. */
+            void
+            requestKeyframe
+                (void);
+
         public :
             // Public fields.
 
@@ -159,6 +237,14 @@ namespace nImO
             /*! @brief The acceptor TCP connections. */
             SpAcceptorTCP   _tcpAcceptor{};
 
+# if MAC_OR_LINUX_OR_BSD_
+            /*! @brief The acceptor for local stream connections. */
+            SpAcceptorLocalStream   _localStreamAcceptor{};
+# endif // MAC_OR_LINUX_OR_BSD_
+
+            /*! @brief The path of the local socket, if one is used. */
+            std::string _localSocketPath{};
+
             /*! @brief The sender's endpoint for TCP. */
             BTCP::endpoint  _tcpSenderEndpoint{};
 
@@ -166,7 +252,31 @@ namespace nImO
             BUDP::endpoint  _udpSenderEndpoint{};
 
             /*! @brief A buffer for the raw message data. */
-            std::array<char, 2048>  _rawData{};
+            std::array<char, kUdpDatagramMaximumLength> _rawData{};
+
+            /*! @brief The partly-received UDP datagrams that were sent as fragments. */
+            DatagramReassembler _reassembler{};
+
+            /*! @brief The most recent UDP datagram that was rebuilt from its fragments. */
+            ByteVector  _reassembledDatagram{};
+
+            /*! @brief A buffer for binary frames received via TCP, kept between frames to avoid reallocation. */
+            ByteVector  _frameBuffer{};
+
+            /*! @brief The bytes received via TCP that have not yet been made into Messages. */
+            boost::asio::streambuf  _receiveBuffer{};
+
+            /*! @brief A buffer for decoded MIME-encoded Messages, kept between Messages to avoid reallocation. */
+            ByteVector  _decodedBytes{};
+
+            /*! @brief A buffer for datagrams received via the local datagram socket. */
+            ByteVector  _localDatagramBuffer{};
+
+            /*! @brief A buffer for Messages received via shared memory, kept between Messages to avoid reallocation. */
+            ByteVector  _sharedMemoryBytes{};
+
+            /*! @brief The thread that receives Messages via shared memory. */
+            Ptr(boost::thread)  _sharedMemoryThread{nullptr};
 
             /*! @brief The destination for incoming messages. */
             ReceiveQueue &  _inQueue;
@@ -174,6 +284,12 @@ namespace nImO
             /*! @brief @c true if the sender address and port are ignored. */
             bool    _unfiltered{false};
 
+            /*! @brief @c true if received Messages are delivered as Messages rather than as Values. */
+            bool    _deliverMessages{false};
+
+            /*! @brief @c true if a request for a keyframe is being written to a stream connection. */
+            std::atomic_bool    _keyframeRequestPending{false};
+
     }; // InChannel
 
 } // nImO
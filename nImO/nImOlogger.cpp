@@ -54,15 +54,6 @@
 # include <winsock.h>
 #endif // not MAC_OR_LINUX_OR_BSD_
 
-#if defined(__APPLE__)
-# pragma clang diagnostic push
-# pragma clang diagnostic ignored "-Wdeprecated-declarations"
-#endif // defined(__APPLE__)
-#include <boost/algorithm/string/join.hpp>
-#if defined(__APPLE__)
-# pragma clang diagnostic pop
-#endif // defined(__APPLE__)
-
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -235,10 +226,7 @@ nImO::Logger::report
             }
             else
             {
-                StdStringVector outVec;
-
-                EncodeBytesAsMIME(outVec, asString);
-                auto    outString(std::make_shared<std::string>(boost::algorithm::join(outVec, "\n"s)));
+                auto    outString{PackageMessage(asString, false)};
 
                 // send the encoded message to the logging ports
                 _socket.async_send_to(boost::asio::buffer(*outString), _endpoint,
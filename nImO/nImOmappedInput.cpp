@@ -0,0 +1,318 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/nImOmappedInput.cpp
+//
+//  Project:    nImO
+//
+//  Contains:   The class definition for memory-mapped input.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+#include <nImOmappedInput.h>
+
+#include <cstring>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#if MAC_OR_LINUX_OR_BSD_
+# include <sys/mman.h>
+# include <unistd.h>
+#else // not MAC_OR_LINUX_OR_BSD_
+# include <io.h>
+#endif // not MAC_OR_LINUX_OR_BSD_
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for memory-mapped input. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace nImO;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+nImO::MappedInput::MappedInput
+    (const std::string &    filePath) :
+        inherited{}
+{
+    ODL_ENTER(); //####
+    ODL_S1s(filePath); //####
+#if MAC_OR_LINUX_OR_BSD_
+    _descriptor = open(filePath.c_str(), O_RDONLY);
+#else // not MAC_OR_LINUX_OR_BSD_
+    _descriptor = _open(filePath.c_str(), _O_RDONLY | _O_BINARY);
+#endif // not MAC_OR_LINUX_OR_BSD_
+    _ownsDescriptor = true;
+    mapInput();
+    ODL_EXIT_P(this); //####
+} // nImO::MappedInput::MappedInput
+
+nImO::MappedInput::MappedInput
+    (const int  inDescriptor) :
+        inherited{}, _descriptor{inDescriptor}
+{
+    ODL_ENTER(); //####
+    ODL_I1(inDescriptor); //####
+    mapInput();
+    ODL_EXIT_P(this); //####
+} // nImO::MappedInput::MappedInput
+
+nImO::MappedInput::~MappedInput
+    (void)
+{
+    ODL_OBJENTER(); //####
+#if MAC_OR_LINUX_OR_BSD_
+    if (nullptr != _mappedBase)
+    {
+        ODL_LOG("(nullptr != _mappedBase)"); //####
+        munmap(_mappedBase, _mappedLength);
+    }
+#endif // MAC_OR_LINUX_OR_BSD_
+    if (_ownsDescriptor && (0 <= _descriptor))
+    {
+        ODL_LOG("(_ownsDescriptor && (0 <= _descriptor))"); //####
+#if MAC_OR_LINUX_OR_BSD_
+        close(_descriptor);
+#else // not MAC_OR_LINUX_OR_BSD_
+        _close(_descriptor);
+#endif // not MAC_OR_LINUX_OR_BSD_
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::MappedInput::~MappedInput
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+nImO::MappedInput::fillBuffer
+    (void)
+{
+    ODL_OBJENTER(); //####
+    bool    result{false};
+
+    if ((nullptr == _mappedBase) && (0 <= _descriptor) && (! _sawEnd))
+    {
+        ODL_LOG("((nullptr == _mappedBase) && (0 <= _descriptor) && (! _sawEnd))"); //####
+        size_t  leftOver{StaticCast(size_t, egptr() - gptr())};
+
+        // Keep the unused input at the start of the buffer, growing the buffer if it is all unused.
+        if (0 < leftOver)
+        {
+            ODL_LOG("(0 < leftOver)"); //####
+            memmove(_buffer.data(), gptr(), leftOver);
+        }
+        if ((leftOver + kMappedInputBlockSize) > _buffer.size())
+        {
+            ODL_LOG("((leftOver + kMappedInputBlockSize) > _buffer.size())"); //####
+            _buffer.resize(leftOver + kMappedInputBlockSize);
+        }
+        for ( ; ; )
+        {
+#if MAC_OR_LINUX_OR_BSD_
+            auto    numRead{read(_descriptor, _buffer.data() + leftOver, _buffer.size() - leftOver)};
+#else // not MAC_OR_LINUX_OR_BSD_
+            auto    numRead{_read(_descriptor, _buffer.data() + leftOver, StaticCast(unsigned int, _buffer.size() - leftOver))};
+#endif // not MAC_OR_LINUX_OR_BSD_
+
+            if (0 < numRead)
+            {
+                ODL_LOG("(0 < numRead)"); //####
+                leftOver += numRead;
+                result = true;
+                break;
+
+            }
+            if ((0 > numRead) && (EINTR == errno))
+            {
+                ODL_LOG("((0 > numRead) && (EINTR == errno))"); //####
+            }
+            else
+            {
+                ODL_LOG("! ((0 > numRead) && (EINTR == errno))"); //####
+                _sawEnd = true;
+                break;
+
+            }
+        }
+        setg(_buffer.data(), _buffer.data(), _buffer.data() + leftOver);
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // nImO::MappedInput::fillBuffer
+
+bool
+nImO::MappedInput::getLine
+    (CPtr(char) &   lineStart,
+     size_t &       lineLength)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2(&lineStart, &lineLength); //####
+    bool    result{false};
+
+    // Lines are found in place, so that they are not copied.
+    for (size_t scanned = 0; ; )
+    {
+        Ptr(char)   start{gptr()};
+        size_t      available{StaticCast(size_t, egptr() - start)};
+        Ptr(char)   endOfLine{nullptr};
+
+        if (scanned < available)
+        {
+            ODL_LOG("(scanned < available)"); //####
+            endOfLine = StaticCast(Ptr(char), memchr(start + scanned, kEndOfLine, available - scanned));
+        }
+
+        if (nullptr == endOfLine)
+        {
+            ODL_LOG("(nullptr == endOfLine)"); //####
+            if (! fillBuffer())
+            {
+                ODL_LOG("(! fillBuffer())"); //####
+                if (0 < available)
+                {
+                    ODL_LOG("(0 < available)"); //####
+                    // The last line of the input does not have an end-of-line; note that the unused
+                    // input might have been moved by the attempt to read more.
+                    lineStart = gptr();
+                    lineLength = available;
+                    setg(eback(), egptr(), egptr());
+                    result = true;
+                }
+                break;
+
+            }
+            scanned = available;
+        }
+        else
+        {
+            ODL_LOG("! (nullptr == endOfLine)"); //####
+            lineStart = start;
+            lineLength = StaticCast(size_t, endOfLine - start);
+            setg(eback(), endOfLine + 1, egptr());
+            result = true;
+            break;
+
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // nImO::MappedInput::getLine
+
+void
+nImO::MappedInput::mapInput
+    (void)
+{
+    ODL_OBJENTER(); //####
+#if MAC_OR_LINUX_OR_BSD_
+    struct stat fileInfo;
+
+    if ((0 <= _descriptor) && (0 == fstat(_descriptor, &fileInfo)) && S_ISREG(fileInfo.st_mode) &&
+        (0 < fileInfo.st_size))
+    {
+        ODL_LOG("((0 <= _descriptor) && (0 == fstat(_descriptor, &fileInfo)) && " //####
+                "S_ISREG(fileInfo.st_mode) && (0 < fileInfo.st_size))"); //####
+        // Start from the current position, so that a descriptor that has been partly read is handled correctly.
+        auto    offset{lseek(_descriptor, 0, SEEK_CUR)};
+
+        if ((0 <= offset) && (offset < fileInfo.st_size))
+        {
+            ODL_LOG("((0 <= offset) && (offset < fileInfo.st_size))"); //####
+            auto    mapped{mmap(nullptr, StaticCast(size_t, fileInfo.st_size), PROT_READ, MAP_PRIVATE, _descriptor, 0)};
+
+            if (MAP_FAILED != mapped)
+            {
+                ODL_LOG("(MAP_FAILED != mapped)"); //####
+                _mappedBase = StaticCast(Ptr(char), mapped);
+                _mappedLength = StaticCast(size_t, fileInfo.st_size);
+                madvise(mapped, _mappedLength, MADV_SEQUENTIAL);
+                setg(_mappedBase, _mappedBase + offset, _mappedBase + _mappedLength);
+                if (_ownsDescriptor)
+                {
+                    ODL_LOG("(_ownsDescriptor)"); //####
+                    close(_descriptor);
+                }
+                _descriptor = -1;
+            }
+        }
+    }
+#endif // MAC_OR_LINUX_OR_BSD_
+    ODL_OBJEXIT(); //####
+} // nImO::MappedInput::mapInput
+
+nImO::MappedInput::int_type
+nImO::MappedInput::underflow
+    (void)
+{
+    ODL_OBJENTER(); //####
+    int_type    result{traits_type::eof()};
+
+    if ((gptr() < egptr()) || fillBuffer())
+    {
+        ODL_LOG("((gptr() < egptr()) || fillBuffer())"); //####
+        result = traits_type::to_int_type(*gptr());
+    }
+    ODL_OBJEXIT_I(result); //####
+    return result;
+} // nImO::MappedInput::underflow
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
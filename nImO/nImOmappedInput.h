@@ -0,0 +1,228 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/nImOmappedInput.h
+//
+//  Project:    nImO
+//
+//  Contains:   The class declaration for memory-mapped input.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+#if (! defined(nImOmappedInput_H_))
+# define nImOmappedInput_H_ /* Header guard */
+
+# include <nImOcommon.h>
+
+# include <streambuf>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for memory-mapped input. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace nImO
+{
+    /*! @brief A class to read text from a file or a file descriptor without copying it a line at a time.
+
+     If the input is a regular file, it is memory-mapped and lines are returned as pointers into the
+     mapped region. Otherwise, as is the case for pipes and terminals, the input is read in large
+     blocks and lines are returned as pointers into the block buffer. The object is also a stream
+     buffer, so that it can be given to readers that work with streams. */
+    class MappedInput final : public std::streambuf
+    {
+
+        public :
+            // Public type definitions.
+
+        protected :
+            // Protected type definitions.
+
+        private :
+            // Private type definitions.
+
+            /*! @brief The class that this class is derived from. */
+            using inherited = std::streambuf;
+
+        public :
+            // Public methods.
+
+            /*! @brief The constructor.
+             @param[in] filePath The path to the file to be read. */
+            explicit MappedInput
+                (const std::string &    filePath);
+
+            /*! @brief The constructor.
+             Note that the file descriptor is not closed when the object is destroyed.
+             @param[in] inDescriptor The file descriptor to be read. */
+            explicit MappedInput
+                (const int  inDescriptor);
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            MappedInput
+                (const MappedInput &    other) = delete;
+
+            /*! @brief The move constructor.
+             @param[in] other The object to be moved. */
+            MappedInput
+                (MappedInput && other)
+                noexcept = delete;
+
+            /*! @brief The destructor. */
+            ~MappedInput
+                (void)
+                override;
+
+            /*! @brief Return the next line of input.
+             The line remains valid until the next call; the end-of-line character is not included.
+             @param[out] lineStart The first character of the line.
+             @param[out] lineLength The number of characters in the line.
+             @return @c true if a line was returned and @c false if there is no more input. */
+            bool
+            getLine
+                (CPtr(char) &   lineStart,
+                 size_t &       lineLength);
+
+            /*! @brief Return the input that has not yet been used, if the input is memory-mapped.
+             @param[out] length The number of characters of unused input.
+             @return The first character of the unused input or @c nullptr if the input is not
+             memory-mapped. */
+            inline CPtr(char)
+            getMappedText
+                (size_t &   length)
+            {
+                CPtr(char)  result{nullptr};
+
+                length = 0;
+                if (nullptr != _mappedBase)
+                {
+                    result = gptr();
+                    length = StaticCast(size_t, egptr() - gptr());
+                }
+                return result;
+            }
+
+            /*! @brief Return @c true if the input is memory-mapped.
+             @return @c true if the input is memory-mapped. */
+            inline bool
+            isMapped
+                (void)
+                const
+            {
+                return (nullptr != _mappedBase);
+            }
+
+            /*! @brief Return @c true if the input can be read.
+             @return @c true if the input can be read. */
+            inline bool
+            isOpen
+                (void)
+                const
+            {
+                return ((nullptr != _mappedBase) || (0 <= _descriptor));
+            }
+
+            /*! @brief The copy assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            MappedInput &
+            operator=
+                (const MappedInput &    other) = delete;
+
+            /*! @brief The move assignment operator.
+             @param[in] other The object to be moved.
+             @return The updated object. */
+            MappedInput &
+            operator=
+                (MappedInput && other)
+                noexcept = delete;
+
+        protected :
+            // Protected methods.
+
+            /*! @brief Make more input available to the stream buffer.
+             @return The next character or @c EOF if there is no more input. */
+            int_type
+            underflow
+                (void)
+                override;
+
+        private :
+            // Private methods.
+
+            /*! @brief Read more input into the block buffer, keeping the input that has not been used.
+             @return @c true if more input was read. */
+            bool
+            fillBuffer
+                (void);
+
+            /*! @brief Map the input if it is a regular file. */
+            void
+            mapInput
+                (void);
+
+        public :
+            // Public fields.
+
+        protected :
+            // Protected fields.
+
+        private :
+            // Private fields.
+
+            /*! @brief The block buffer, used if the input cannot be mapped. */
+            std::vector<char>   _buffer{};
+
+            /*! @brief The file descriptor being read, or @c -1 if the input is mapped or could not be opened. */
+            int _descriptor{-1};
+
+            /*! @brief The start of the mapped input or @c nullptr if the input is not mapped. */
+            Ptr(char)   _mappedBase{nullptr};
+
+            /*! @brief The number of bytes of mapped input. */
+            size_t  _mappedLength{0};
+
+            /*! @brief @c true if the file descriptor is to be closed by this object. */
+            bool    _ownsDescriptor{false};
+
+            /*! @brief @c true if there is no more input to be read from the file descriptor. */
+            bool    _sawEnd{false};
+
+    }; // MappedInput
+
+} // nImO
+
+#endif // not defined(nImOmappedInput_H_)
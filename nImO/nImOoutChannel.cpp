@@ -38,24 +38,20 @@
 
 #include <nImOoutChannel.h>
 
+#include <Containers/nImOdeltaCoder.h>
 #include <Containers/nImOmap.h>
 #include <Containers/nImOmessage.h>
+#include <Containers/nImOschemaCodec.h>
 #include <Contexts/nImOinputOutputContext.h>
+#include <nImOcompression.h>
+#include <nImOdatagramFragments.h>
 #include <nImOmainSupport.h>
 #include <nImOMIMESupport.h>
+#include <nImOsharedMemoryRing.h>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
-#if defined(__APPLE__)
-# pragma clang diagnostic push
-# pragma clang diagnostic ignored "-Wdeprecated-declarations"
-#endif // defined(__APPLE__)
-#include <boost/algorithm/string/join.hpp>
-#if defined(__APPLE__)
-# pragma clang diagnostic pop
-#endif // defined(__APPLE__)
-
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -116,6 +112,154 @@ nImO::OutChannel::~OutChannel
 # pragma mark Actions and Accessors
 #endif // defined(__APPLE__)
 
+void
+nImO::OutChannel::receiveLocalStreamKeyframeRequests
+    (void)
+{
+    ODL_OBJENTER(); //####
+#if MAC_OR_LINUX_OR_BSD_
+    if (gKeepRunning && _deltaCoder)
+    {
+        // A request is always the same length, so it is read as a whole.
+        boost::asio::async_read(*_localStreamSocket, boost::asio::buffer(_requestData.data(), kDeltaKeyframeRequest.length()),
+                                [this]
+                                (const BSErr &      ec,
+                                 const std::size_t  length)
+                                {
+                                    if (ec)
+                                    {
+                                        if ((BAErr::operation_aborted == ec) || (BAErr::eof == ec))
+                                        {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                            _context.report("async_read() operation cancelled."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                            ODL_LOG("((BAErr::operation_aborted == ec) || (BAErr::eof == ec))"); //####
+                                        }
+                                        else
+                                        {
+                                            auto    errMessage{"async_read() failed -> "s + ec.message() + "."s};
+
+                                            _context.report(errMessage);
+                                        }
+                                    }
+                                    else
+                                    {
+                                        std::string request{_requestData.data(), length};
+
+                                        if (kDeltaKeyframeRequest == request)
+                                        {
+                                            auto    coder{_deltaCoder};
+
+                                            if (coder)
+                                            {
+                                                coder->requestKeyframe();
+                                            }
+                                        }
+                                        receiveLocalStreamKeyframeRequests();
+                                    }
+                                });
+    }
+#endif // MAC_OR_LINUX_OR_BSD_
+    ODL_OBJEXIT(); //####
+} // nImO::OutChannel::receiveLocalStreamKeyframeRequests
+
+void
+nImO::OutChannel::receiveTcpKeyframeRequests
+    (void)
+{
+    ODL_OBJENTER(); //####
+    if (gKeepRunning && _deltaCoder)
+    {
+        // A request is always the same length, so it is read as a whole.
+        boost::asio::async_read(*_tcpSocket, boost::asio::buffer(_requestData.data(), kDeltaKeyframeRequest.length()),
+                                [this]
+                                (const BSErr &      ec,
+                                 const std::size_t  length)
+                                {
+                                    if (ec)
+                                    {
+                                        if ((BAErr::operation_aborted == ec) || (BAErr::eof == ec))
+                                        {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                            _context.report("async_read() operation cancelled."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                            ODL_LOG("((BAErr::operation_aborted == ec) || (BAErr::eof == ec))"); //####
+                                        }
+                                        else
+                                        {
+                                            auto    errMessage{"async_read() failed -> "s + ec.message() + "."s};
+
+                                            _context.report(errMessage);
+                                        }
+                                    }
+                                    else
+                                    {
+                                        std::string request{_requestData.data(), length};
+
+                                        if (kDeltaKeyframeRequest == request)
+                                        {
+                                            auto    coder{_deltaCoder};
+
+                                            if (coder)
+                                            {
+                                                coder->requestKeyframe();
+                                            }
+                                        }
+                                        receiveTcpKeyframeRequests();
+                                    }
+                                });
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::OutChannel::receiveTcpKeyframeRequests
+
+void
+nImO::OutChannel::receiveUdpKeyframeRequests
+    (void)
+{
+    ODL_OBJENTER(); //####
+    if (gKeepRunning && _deltaCoder)
+    {
+        _udpSocket->async_receive_from(boost::asio::buffer(_requestData), _udpRequestEndpoint,
+                                       [this]
+                                       (const BSErr         ec,
+                                        const std::size_t   length)
+                                       {
+                                           if (ec)
+                                           {
+                                               if (BAErr::operation_aborted == ec)
+                                               {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                                   _context.report("async_receive_from() operation cancelled."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                                   ODL_LOG("(BAErr::operation_aborted == ec)"); //####
+                                               }
+                                               else
+                                               {
+                                                   auto    errMessage{"async_receive_from() failed -> "s + ec.message() + "."s};
+
+                                                   _context.report(errMessage);
+                                               }
+                                           }
+                                           else
+                                           {
+                                               std::string  request{_requestData.data(), length};
+
+                                               if ((_udpSendpoint == _udpRequestEndpoint) && (kDeltaKeyframeRequest == request))
+                                               {
+                                                   auto    coder{_deltaCoder};
+
+                                                   if (coder)
+                                                   {
+                                                       coder->requestKeyframe();
+                                                   }
+                                               }
+                                               receiveUdpKeyframeRequests();
+                                           }
+                                       });
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::OutChannel::receiveUdpKeyframeRequests
+
 bool
 nImO::OutChannel::send
     (SpValue    valueToSend)
@@ -133,57 +277,334 @@ nImO::OutChannel::send
         }
         else
         {
-            Message messageToSend;
+            // The receiver adds Map keys to its dictionary in the order that the Messages arrive.
+            std::lock_guard<std::mutex> guard{_sendLock};
+            Message                     messageToSend;
 
+            if (_tcpConnected || _localStreamConnected)
+            {
+                messageToSend.setKeyDictionary(_keyDictionary);
+            }
+            messageToSend.setSinglePrecision(_singlePrecision);
             messageToSend.open(true);
-            messageToSend.setValue(valueToSend);
+            if (_deltaCoder)
+            {
+                messageToSend.setValue(_deltaCoder->encodeValue(valueToSend, _singlePrecision));
+            }
+            else
+            {
+                messageToSend.setValue(valueToSend);
+            }
             messageToSend.close();
-            if (0 < messageToSend.getLength())
+            okSoFar = sendMessage(messageToSend);
+        }
+    }
+    else
+    {
+        ODL_LOG("! (valueToSend)"); //####
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::OutChannel::send
+
+bool
+nImO::OutChannel::sendEncoded
+    (MessageWriter  writer,
+     CPtr(void)     data)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(data); //####
+    bool    okSoFar{false};
+
+    if ((nullptr != writer) && (nullptr != data))
+    {
+        if (TransportType::kUnknown == _connection._transport)
+        {
+            okSoFar = true; // if the channel hasn't been configured, just throw the message away but it's not an error.
+            ODL_B1(okSoFar); //####
+        }
+        else
+        {
+            if (_deltaCoder)
+            {
+                ODL_LOG("(_deltaCoder)"); //####
+                Message scratch;
+
+                // Deltas are taken between Values, so the encoded Message is sent as a Value.
+                scratch.open(true);
+                writer(scratch, data);
+                scratch.close();
+                okSoFar = send(scratch.getValue(true));
+            }
+            else
             {
-                auto    asString{messageToSend.getString()};
+                ODL_LOG("! (_deltaCoder)"); //####
+                // The receiver adds Map keys to its dictionary in the order that the Messages arrive.
+                std::lock_guard<std::mutex> guard{_sendLock};
+                Message                     messageToSend;
 
-                if (asString.empty())
+                if (_tcpConnected || _localStreamConnected)
                 {
-                    ODL_LOG("(asString.empty())"); //####
+                    messageToSend.setKeyDictionary(_keyDictionary);
+                }
+                messageToSend.setSinglePrecision(_singlePrecision);
+                messageToSend.open(true);
+                writer(messageToSend, data);
+                messageToSend.close();
+                okSoFar = sendMessage(messageToSend);
+            }
+        }
+    }
+    else
+    {
+        ODL_LOG("! ((nullptr != writer) && (nullptr != data))"); //####
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::OutChannel::sendEncoded
+
+bool
+nImO::OutChannel::sendFields
+    (CPtr(double)   values)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(values); //####
+    bool    okSoFar{false};
+    auto    codec{_schemaCodec};
+
+    if (codec && (nullptr != values))
+    {
+        if (TransportType::kUnknown == _connection._transport)
+        {
+            okSoFar = true; // if the channel hasn't been configured, just throw the message away but it's not an error.
+            ODL_B1(okSoFar); //####
+        }
+        else
+        {
+            if (_keyDictionary || _deltaCoder)
+            {
+                ODL_LOG("(_keyDictionary || _deltaCoder)"); //####
+                Message scratch;
+
+                // The receiver expects Map key references or delta-encoded Values, so the fields are sent as a Value.
+                scratch.open(true);
+                codec->encode(scratch, values);
+                scratch.close();
+                okSoFar = send(scratch.getValue(true));
+            }
+            else
+            {
+                ODL_LOG("! (_keyDictionary || _deltaCoder)"); //####
+                std::lock_guard<std::mutex> guard{_sendLock};
+                Message                     messageToSend;
+
+                messageToSend.open(true);
+                codec->encode(messageToSend, values);
+                messageToSend.close();
+                okSoFar = sendMessage(messageToSend);
+            }
+        }
+    }
+    else
+    {
+        ODL_LOG("! (codec && (nullptr != values))"); //####
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::OutChannel::sendFields
+
+bool
+nImO::OutChannel::sendMessage
+    (Message &  messageToSend)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(&messageToSend); //####
+    bool    okSoFar{false};
+
+    if (0 < messageToSend.getLength())
+    {
+        size_t  bodyStart{_binaryFraming ? FrameHeaderLength(_frameChecksums) : 0};
+        auto    outBytes{GetTransmissionBuffer(bodyStart + messageToSend.getLength())};
+
+        // The Message bytes are copied once, after room for a frame header, so that they can be framed where they are.
+        outBytes->resize(bodyStart);
+        messageToSend.copyBytesTo(*outBytes);
+        if (_deltaCoder)
+        {
+            _deltaCoder->recordSentMessage(messageToSend);
+        }
+
+        CPtr(uint8_t)   body{ReinterpretCast(CPtr(uint8_t), outBytes->data()) + bodyStart};
+        size_t          bodyLength{outBytes->length() - bodyStart};
+
+        if (0 == bodyLength)
+        {
+            ODL_LOG("(0 == bodyLength)"); //####
+        }
+        else
+        {
+            if (TransportType::kSharedMemory == _connection._transport)
+            {
+                // The ring delimits the Messages and the bytes are never damaged or shrunk in it, so they are copied as they are.
+                if (_sharedMemoryConnected)
+                {
+                    if (kFrameMaximumLength < bodyLength)
+                    {
+                        ODL_LOG("(kFrameMaximumLength < bodyLength)"); //####
+                        _context.report("Message is too large for the shared memory ring."s);
+                    }
+                    else
+                    {
+                        okSoFar = _sharedMemoryRing->writeMessage(body, bodyLength);
+                        if (okSoFar)
+                        {
+                            _statistics.update(bodyLength);
+                        }
+                        else
+                        {
+                            _context.report("shared memory receiver has gone away."s);
+                        }
+                    }
                 }
                 else
                 {
-                    StdStringVector outVec;
+                    okSoFar = true;
+                }
+                ODL_B1(okSoFar); //####
+            }
+            else
+            {
+                SpStdString outString;
+                size_t      overhead;
+                bool        compressed{false};
 
-                    EncodeBytesAsMIME(outVec, asString);
-                    auto    outString{PackageMessage(outVec)};
+                // Large Messages are compressed before framing, but only if that makes them smaller.
+                if (_compressMessages && (_compressionThreshold <= bodyLength) && CompressMessageBytes(body, bodyLength, _compressedBytes))
+                {
+                    compressed = true;
+                }
+                if (_binaryFraming)
+                {
+                    if (compressed)
+                    {
+                        outString = PackageMessageAsFrame(_compressedBytes, _frameChecksums);
+                    }
+                    else
+                    {
+                        if (FillInFrameHeader(*outBytes, _frameChecksums))
+                        {
+                            outString = outBytes;
+                        }
+                    }
+                    overhead = bodyStart;
+                }
+                else
+                {
+                    if (compressed)
+                    {
+                        outString = PackageMessage(_compressedBytes);
+                    }
+                    else
+                    {
+                        outString = PackageMessage(body, bodyLength);
+                    }
+                    overhead = kMessageSentinel.length() + 1;
+                }
 
+                if (nullptr == outString)
+                {
+                    ODL_LOG("(nullptr == outString)"); //####
+                    _context.report("Message is too large to be sent as a binary frame."s);
+                }
+                else
+                {
                     // send the encoded message to the receiver
                     if (TransportType::kUDP == _connection._transport)
                     {
-                        _udpSocket->async_send_to(boost::asio::buffer(*outString), _udpSendpoint,
-                                                  [this, outString]
-                                                  (const BSErr          ec,
-                                                   const std::size_t    length)
-                                                  {
-                                                    if (ec)
-                                                    {
-                                                        if (BAErr::operation_aborted == ec)
+                        if (kUdpDatagramMaximumLength >= outString->length())
+                        {
+                            _udpSocket->async_send_to(boost::asio::buffer(*outString), _udpSendpoint,
+                                                      [this, outString, overhead]
+                                                      (const BSErr          ec,
+                                                       const std::size_t    length)
+                                                      {
+                                                        if (ec)
                                                         {
+                                                            if (BAErr::operation_aborted == ec)
+                                                            {
 #if defined(nImO_ChattyTcpUdpLogging)
-                                                            _context.report("async_send_to() operation cancelled."s);
+                                                                _context.report("async_send_to() operation cancelled."s);
 #endif /* defined(nImO_ChattyTcpUdpLogging) */
-                                                            ODL_LOG("(BAErr::operation_aborted == ec)"); //####
+                                                                ODL_LOG("(BAErr::operation_aborted == ec)"); //####
+                                                            }
+                                                            else
+                                                            {
+                                                                auto    errMessage{"async_send_to() failed -> "s + ec.message() + "."s};
+
+                                                                _context.report(errMessage);
+                                                            }
                                                         }
                                                         else
                                                         {
-                                                            auto    errMessage{"async_send_to() failed -> "s + ec.message() + "."s};
-
-                                                            _context.report(errMessage);
+                                                            _statistics.update(length - overhead);
                                                         }
-                                                    }
-                                                    else
-                                                    {
-                                                        _statistics.update(length - (kMessageSentinel.length() + 1));
-                                                    }
-                                                  });
-                        okSoFar = true;
-                        ODL_B1(okSoFar); //####
+                                                      });
+                            okSoFar = true;
+                            ODL_B1(okSoFar); //####
+                        }
+                        else
+                        {
+                            // The datagram is too large for the receive buffer, so it is sent as fragments that the receiver puts back together.
+                            if (SplitDatagram(*outString, ++_udpDatagramId, _udpFragments))
+                            {
+                                size_t  messageLength{outString->length() - overhead};
+
+                                for (size_t ii = 0, lastIndex = _udpFragments.size() - 1; ii <= lastIndex; ++ii)
+                                {
+                                    auto    fragment{_udpFragments[ii]};
+                                    bool    isLast{ii == lastIndex};
+
+                                    _udpSocket->async_send_to(boost::asio::buffer(*fragment), _udpSendpoint,
+                                                              [this, fragment, isLast, messageLength]
+                                                              (const BSErr          ec,
+                                                               const std::size_t    length)
+                                                              {
+                                                                NIMO_UNUSED_VAR_(length);
+                                                                if (ec)
+                                                                {
+                                                                    if (BAErr::operation_aborted == ec)
+                                                                    {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                                                        _context.report("async_send_to() operation cancelled."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                                                        ODL_LOG("(BAErr::operation_aborted == ec)"); //####
+                                                                    }
+                                                                    else
+                                                                    {
+                                                                        auto    errMessage{"async_send_to() failed -> "s + ec.message() + "."s};
+
+                                                                        _context.report(errMessage);
+                                                                    }
+                                                                }
+                                                                else
+                                                                {
+                                                                    if (isLast)
+                                                                    {
+                                                                        _statistics.update(messageLength);
+                                                                    }
+                                                                }
+                                                              });
+                                }
+                                _udpFragments.clear();
+                                okSoFar = true;
+                                ODL_B1(okSoFar); //####
+                            }
+                            else
+                            {
+                                ODL_LOG("! (SplitDatagram(*outString, ++_udpDatagramId, _udpFragments))"); //####
+                                _context.report("Message is too large to be sent via UDP."s);
+                            }
+                        }
                     }
                     else
                     {
@@ -192,7 +613,7 @@ nImO::OutChannel::send
                             if (_tcpConnected)
                             {
                                 boost::asio::async_write(*_tcpSocket, boost::asio::buffer(*outString),
-                                                         [this, outString]
+                                                         [this, outString, overhead]
                                                          (const BSErr &        ec,
                                                           const std::size_t    bytes_transferred)
                                                          {
@@ -214,44 +635,145 @@ nImO::OutChannel::send
                                                             }
                                                             else
                                                             {
-                                                                _statistics.update(bytes_transferred - (kMessageSentinel.length() + 1));
+                                                                _statistics.update(bytes_transferred - overhead);
                                                             }
                                                          });
                             }
                             okSoFar = true;
                             ODL_B1(okSoFar); //####
                         }
+#if MAC_OR_LINUX_OR_BSD_
+                        else
+                        {
+                            if (TransportType::kLocalStream == _connection._transport)
+                            {
+                                if (_localStreamConnected)
+                                {
+                                    boost::asio::async_write(*_localStreamSocket, boost::asio::buffer(*outString),
+                                                             [this, outString, overhead]
+                                                             (const BSErr &        ec,
+                                                              const std::size_t    bytes_transferred)
+                                                             {
+                                                                if (ec)
+                                                                {
+                                                                    if (BAErr::operation_aborted == ec)
+                                                                    {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                                                        _context.report("async_write() operation cancelled."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                                                        ODL_LOG("(BAErr::operation_aborted == ec)"); //####
+                                                                    }
+                                                                    else
+                                                                    {
+                                                                        auto    errMessage{"async_write() failed -> "s + ec.message() + "."s};
+
+                                                                        _context.report(errMessage);
+                                                                    }
+                                                                }
+                                                                else
+                                                                {
+                                                                    _statistics.update(bytes_transferred - overhead);
+                                                                }
+                                                             });
+                                }
+                                okSoFar = true;
+                                ODL_B1(okSoFar); //####
+                            }
+                            else
+                            {
+                                if (TransportType::kLocalDatagram == _connection._transport)
+                                {
+                                    if (kLocalDatagramMaximumLength < outString->length())
+                                    {
+                                        ODL_LOG("(kLocalDatagramMaximumLength < outString->length())"); //####
+                                        _context.report("Message is too large for a local datagram."s);
+                                    }
+                                    else
+                                    {
+                                        _localDatagramSocket->async_send_to(boost::asio::buffer(*outString), _localDatagramSendpoint,
+                                                                            [this, outString, overhead]
+                                                                            (const BSErr          ec,
+                                                                             const std::size_t    length)
+                                                                            {
+                                                                                if (ec)
+                                                                                {
+                                                                                    if (BAErr::operation_aborted == ec)
+                                                                                    {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                                                                        _context.report("async_send_to() operation cancelled."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                                                                        ODL_LOG("(BAErr::operation_aborted == ec)"); //####
+                                                                                    }
+                                                                                    else
+                                                                                    {
+                                                                                        auto    errMessage{"async_send_to() failed -> "s + ec.message() + "."s};
+
+                                                                                        _context.report(errMessage);
+                                                                                    }
+                                                                                }
+                                                                                else
+                                                                                {
+                                                                                    _statistics.update(length - overhead);
+                                                                                }
+                                                                            });
+                                        okSoFar = true;
+                                        ODL_B1(okSoFar); //####
+                                    }
+                                }
+                            }
+                        }
+#endif // MAC_OR_LINUX_OR_BSD_
                     }
                 }
             }
-            else
-            {
-                ODL_LOG("! (0 < messageToSend.getLength())"); //####
-            }
         }
     }
     else
     {
-        ODL_LOG("! (valueToSend)"); //####
+        ODL_LOG("! (0 < messageToSend.getLength())"); //####
     }
     ODL_OBJEXIT_B(okSoFar); //####
     return okSoFar;
-} // nImO::OutChannel::send
+} // nImO::OutChannel::sendMessage
 
 bool
 nImO::OutChannel::setUp
     (const IPv4Address      receiveAddress,
      const IPv4Port         receivePort,
-     const TransportType    mode)
+     const TransportType    mode,
+     const bool             useKeyDictionary,
+     const bool             receiverAcceptsDeltas,
+     const bool             receiverAcceptsFrames,
+     const bool             receiverAcceptsCompression,
+     const std::string &    localEndpointName)
 {
     ODL_OBJENTER(); //####
     ODL_X1(receiveAddress); //####
     ODL_I2(receivePort, StaticCast(int, mode)); //####
+    ODL_B4(useKeyDictionary, receiverAcceptsDeltas, receiverAcceptsFrames, receiverAcceptsCompression); //####
+    ODL_S1s(localEndpointName); //####
     bool                okSoFar{false};
     BAIP::address_v4    outAddress{0};
     BAIP::address_v4    destAddress{receiveAddress};
 
     _connection._transport = mode;
+    setUpKeyDictionary(useKeyDictionary);
+    // Messages encoded by a schema codec are sent whole, as their fields are already at fixed offsets.
+    if (receiverAcceptsDeltas && (0 < _keyframeInterval) && (nullptr == _schemaCodec))
+    {
+        ODL_LOG("(receiverAcceptsDeltas && (0 < _keyframeInterval) && (nullptr == _schemaCodec))"); //####
+        _deltaCoder = std::make_shared<DeltaCoder>(_keyframeInterval);
+    }
+    else
+    {
+        ODL_LOG("! (receiverAcceptsDeltas && (0 < _keyframeInterval) && (nullptr == _schemaCodec))"); //####
+        _deltaCoder.reset();
+    }
+    // Receivers that can not handle binary frames are sent MIME; local connections always use binary frames.
+    _binaryFraming = (receiverAcceptsFrames || (TransportType::kLocalStream == mode) || (TransportType::kLocalDatagram == mode));
+    // Receivers that can not expand compressed Messages are sent them uncompressed.
+    _compressMessages = (receiverAcceptsCompression && (0 < _compressionThreshold));
+    ODL_B2(_binaryFraming, _compressMessages); //####
     _destinationAddress = receiveAddress;
     _destinationPort = receivePort;
     // Set up network activity.
@@ -288,6 +810,51 @@ nImO::OutChannel::setUp
             okSoFar = true;
             ODL_B1(okSoFar); //####
         }
+        else
+        {
+            if (TransportType::kSharedMemory == _connection._transport)
+            {
+                _sharedMemoryRing = std::make_shared<SharedMemoryRing>(localEndpointName, false);
+                _connection._address = ntohl(ContextWithMDNS::gServiceAddressIpv4.sin_addr.s_addr);
+                _connection._port = 0;
+                okSoFar = _sharedMemoryRing->isOpen();
+                ODL_B1(okSoFar); //####
+            }
+#if MAC_OR_LINUX_OR_BSD_
+            else
+            {
+                if (TransportType::kLocalStream == _connection._transport)
+                {
+                    _localStreamSocket = std::make_shared<BLStream::socket>(*_context.getService());
+#if defined(nImO_ChattyTcpUdpLogging)
+                    _context.report("destination path = "s + localEndpointName + "."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                    _localStreamSendpoint = BLStream::endpoint{localEndpointName};
+                    _connection._address = ntohl(ContextWithMDNS::gServiceAddressIpv4.sin_addr.s_addr);
+                    _connection._port = 0;
+                    okSoFar = (! localEndpointName.empty());
+                    ODL_B1(okSoFar); //####
+                }
+                else
+                {
+                    if (TransportType::kLocalDatagram == _connection._transport)
+                    {
+                        _localDatagramSocket = std::make_shared<BLDgram::socket>(*_context.getService());
+                        _localDatagramSocket->open();
+                        _localDatagramSocket->set_option(boost::asio::socket_base::send_buffer_size(kLocalDatagramMaximumLength));
+#if defined(nImO_ChattyTcpUdpLogging)
+                        _context.report("destination path = "s + localEndpointName + "."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                        _localDatagramSendpoint = BLDgram::endpoint{localEndpointName};
+                        _connection._address = ntohl(ContextWithMDNS::gServiceAddressIpv4.sin_addr.s_addr);
+                        _connection._port = 0;
+                        okSoFar = (! localEndpointName.empty());
+                        ODL_B1(okSoFar); //####
+                    }
+                }
+            }
+#endif // MAC_OR_LINUX_OR_BSD_
+        }
     }
     ODL_OBJEXIT_B(okSoFar); //####
     return okSoFar;
@@ -300,11 +867,17 @@ nImO::OutChannel::start
     ODL_OBJENTER(); //####
     bool    okSoFar{false};
 
+    if (_deltaCoder)
+    {
+        _deltaCoder->reset();
+    }
     // Start network activity.
     if (TransportType::kUDP == _connection._transport)
     {
         _udpConnected = true;
         ODL_B1(_udpConnected); //####
+        // The receiver asks for a keyframe when it sees that a Message was lost.
+        receiveUdpKeyframeRequests();
         okSoFar = true;
         ODL_B1(okSoFar); //####
     }
@@ -312,6 +885,7 @@ nImO::OutChannel::start
     {
         if (TransportType::kTCP == _connection._transport)
         {
+            resetKeyDictionary();
             _tcpSocket->async_connect(_tcpSendpoint,
                                       [this]
                                       (const BSErr  ec)
@@ -338,6 +912,8 @@ nImO::OutChannel::start
                                             _connection._port = _tcpSocket->local_endpoint().port();
                                             _tcpConnected = true;
                                             ODL_B1(_tcpConnected); //####
+                                            // The receiver asks for a keyframe when a Message could not be used.
+                                            receiveTcpKeyframeRequests();
                                         }
                                       });
             for ( ; gKeepRunning && (! _tcpConnected); )
@@ -347,6 +923,70 @@ nImO::OutChannel::start
             okSoFar = true;
             ODL_B1(okSoFar); //####
         }
+        else
+        {
+            if (TransportType::kSharedMemory == _connection._transport)
+            {
+                // The ring was attached to when the channel was set up, so there is nothing to wait for.
+                _sharedMemoryConnected = true;
+                ODL_B1(_sharedMemoryConnected); //####
+                okSoFar = true;
+                ODL_B1(okSoFar); //####
+            }
+#if MAC_OR_LINUX_OR_BSD_
+            else
+            {
+                if (TransportType::kLocalStream == _connection._transport)
+                {
+                    resetKeyDictionary();
+                    _localStreamSocket->async_connect(_localStreamSendpoint,
+                                                      [this]
+                                                      (const BSErr  ec)
+                                                      {
+                                                        if (ec)
+                                                        {
+                                                            if (BAErr::operation_aborted == ec)
+                                                            {
+#if defined(nImO_ChattyTcpUdpLogging)
+                                                                _context.report("async_connect() operation cancelled."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+                                                                ODL_LOG("(BAErr::operation_aborted == ec)"); //####
+                                                            }
+                                                            else
+                                                            {
+                                                                auto    errMessage{"async_connect() failed -> "s + ec.message() + "."s};
+
+                                                                _context.report(errMessage);
+                                                            }
+                                                        }
+                                                        else
+                                                        {
+                                                            _localStreamConnected = true;
+                                                            ODL_B1(_localStreamConnected); //####
+                                                            // The receiver asks for a keyframe when a Message could not be used.
+                                                            receiveLocalStreamKeyframeRequests();
+                                                        }
+                                                      });
+                    for ( ; gKeepRunning && (! _localStreamConnected); )
+                    {
+                        boost::this_thread::yield();
+                    }
+                    okSoFar = true;
+                    ODL_B1(okSoFar); //####
+                }
+                else
+                {
+                    if (TransportType::kLocalDatagram == _connection._transport)
+                    {
+                        _localDatagramConnected = true;
+                        ODL_B1(_localDatagramConnected); //####
+                        okSoFar = true;
+                        ODL_B1(okSoFar); //####
+                    }
+                }
+            }
+#endif // MAC_OR_LINUX_OR_BSD_
+        }
     }
     ODL_OBJEXIT_B(okSoFar); //####
     return okSoFar;
@@ -382,10 +1022,48 @@ nImO::OutChannel::stop
         }
         else
         {
+            if (TransportType::kSharedMemory == _connection._transport)
+            {
+                _sharedMemoryConnected = false;
+                ODL_B1(_sharedMemoryConnected); //####
+                _sharedMemoryRing->close();
+                _sharedMemoryRing.reset();
+            }
+#if MAC_OR_LINUX_OR_BSD_
+            else
+            {
+                if (TransportType::kLocalStream == _connection._transport)
+                {
+                    if (_localStreamSocket->is_open())
+                    {
+                        _localStreamSocket->cancel();
+                    }
+                    _localStreamConnected = false;
+                    ODL_B1(_localStreamConnected); //####
+                }
+                else
+                {
+                    if (TransportType::kLocalDatagram == _connection._transport)
+                    {
+                        if (_localDatagramSocket->is_open())
+                        {
+                            _localDatagramSocket->cancel();
+                        }
+                        _localDatagramConnected = false;
+                        ODL_B1(_localDatagramConnected); //####
+                    }
+                }
+            }
+#endif // MAC_OR_LINUX_OR_BSD_
             okSoFar = true;
             ODL_B1(okSoFar); //####
         }
     }
+    resetKeyDictionary();
+    if (_deltaCoder)
+    {
+        _deltaCoder->reset();
+    }
     _connection._transport = TransportType::kUnknown;
     ODL_OBJEXIT_B(okSoFar); //####
     return okSoFar;
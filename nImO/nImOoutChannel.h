@@ -41,6 +41,8 @@
 
 # include <nImObaseChannel.h>
 
+# include <Containers/nImOstructBinding.h>
+
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
 #  pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -61,6 +63,13 @@ namespace nImO
         public :
             // Public type definitions.
 
+            /*! @brief The function pointer for filling a Message with exactly one encoded value.
+             @param[in,out] outMessage The open Message to be filled.
+             @param[in] data The value to be encoded. */
+            using MessageWriter = void (*)
+                (Message &  outMessage,
+                 CPtr(void) data);
+
         protected :
             // Protected type definitions.
 
@@ -109,16 +118,108 @@ namespace nImO
             send
                 (SpValue    valueToSend);
 
+            /*! @brief Send a value that is encoded directly into the Message, without building any Values.
+             @tparam Type_ The type of the value, which is usually a bound struct.
+             @param[in] valueToSend The value to be sent.
+             @return @c true if the message was successfully sent. */
+            template
+                <typename   Type_>
+            inline bool
+            sendBoundValue
+                (const Type_ &  valueToSend)
+            {
+                return sendEncoded([] (Message &  outMessage, CPtr(void) data)
+                                   {
+                                       EncodeBoundValue(outMessage, *StaticCast(CPtr(Type_), data));
+                                   }, &valueToSend);
+            }
+
+            /*! @brief Send a message that is encoded directly into the Message for the connection.
+             The Message uses the dictionary for Map keys and the floating-point precision of the connection, so the
+             writer must encode Map keys as String::writeKeyToMessage() does. If the connection uses delta encoding,
+             the Message is read back and sent as a Value.
+             @param[in] writer The function that fills the Message.
+             @param[in] data The value to be encoded by the writer.
+             @return @c true if the message was successfully sent. */
+            bool
+            sendEncoded
+                (MessageWriter  writer,
+                 CPtr(void)     data);
+
+            /*! @brief Send a message with the fields of the schema codec for the data type of the connection.
+             The Message is encoded directly from the fields, unless the connection uses a dictionary for Map
+             keys or delta encoding, in which case the fields are sent as a Value.
+             @param[in] values The fields to be sent; there must be as many as the codec has fields.
+             @return @c true if the message was successfully sent and @c false if it was not sent or if there is
+             no codec for the data type of the connection. */
+            bool
+            sendFields
+                (CPtr(double)   values);
+
+            /*! @brief Set the size of the smallest Message that is compressed.
+             Compression is only used if the receiver accepts it and is set up when the channel is
+             set up, so this must be called before then; the 'compress' argument of nImOconnect sets it that way.
+             @param[in] compressionThreshold The number of bytes in the smallest Message that is compressed, or zero to
+             not use compression. */
+            inline void
+            setCompressionThreshold
+                (const size_t   compressionThreshold)
+            {
+                _compressionThreshold = compressionThreshold;
+            }
+
+            /*! @brief Set how often a complete Value is sent when delta encoding is used.
+             Delta encoding is only used if the receiver accepts it and is set up when the channel is
+             set up, so this must be called before then.
+             @param[in] keyframeInterval The number of Values sent for each complete Value, or zero to
+             not use delta encoding. */
+            inline void
+            setDeltaEncoding
+                (const size_t   keyframeInterval)
+            {
+                _keyframeInterval = keyframeInterval;
+            }
+
+            /*! @brief Set whether a checksum is attached to each Message sent in a binary frame.
+             The checksum is not used when Messages are sent as MIME, which has its own checksum.
+             @param[in] frameChecksums @c true if a checksum is to be attached to each binary frame. */
+            inline void
+            setFrameChecksums
+                (const bool frameChecksums)
+            {
+                _frameChecksums = frameChecksums;
+            }
+
+            /*! @brief Set whether floating-point values are sent as single-precision values.
+             @param[in] singlePrecision @c true if floating-point values are to be sent as single-precision values. */
+            inline void
+            setSinglePrecision
+                (const bool singlePrecision)
+            {
+                _singlePrecision = singlePrecision;
+            }
+
             /*! @brief Configure the netowkr port for the channel.
              @param[in] receiveAddress The address of the receiver.
              @param[in] receivePort The port of the receiver.
              @param[in] mode The transport mode to use.
+             @param[in] useKeyDictionary @c true if the receiver has agreed to use a dictionary for Map keys.
+             @param[in] receiverAcceptsDeltas @c true if the receiver can reconstruct delta-encoded Values.
+             @param[in] receiverAcceptsFrames @c true if the receiver can handle Messages in binary frames.
+             @param[in] receiverAcceptsCompression @c true if the receiver can expand compressed Messages.
+             @param[in] localEndpointName The name of the receiver's shared memory segment or the path of its local
+             socket, if the mode is a local one.
              @return @c true if the network information for the channel was set up. */
             bool
             setUp
                 (const IPv4Address      receiveAddress,
                  const IPv4Port         receivePort,
-                 const TransportType    mode);
+                 const TransportType    mode,
+                 const bool             useKeyDictionary = false,
+                 const bool             receiverAcceptsDeltas = false,
+                 const bool             receiverAcceptsFrames = false,
+                 const bool             receiverAcceptsCompression = false,
+                 const std::string &    localEndpointName = ""s);
 
             /*! @brief Start the channel.
              @return @c true if the channel was successfully started. */
@@ -139,6 +240,30 @@ namespace nImO
         private :
             // Private methods.
 
+            /*! @brief Receive requests for keyframes via the local stream socket. */
+            void
+            receiveLocalStreamKeyframeRequests
+                (void);
+
+            /*! @brief Receive requests for keyframes via the TCP socket. */
+            void
+            receiveTcpKeyframeRequests
+                (void);
+
+            /*! @brief Receive requests for keyframes via the UDP socket. */
+            void
+            receiveUdpKeyframeRequests
+                (void);
+
+            /*! @brief Send the bytes of a Message to the receiver.
+             The lock for sending must be held by the caller, so that Messages are sent in the order that they
+             were encoded.
+             @param[in] messageToSend The closed Message to be sent.
+             @return @c true if the Message was successfully sent. */
+            bool
+            sendMessage
+                (Message &  messageToSend);
+
         public :
             // Public fields.
 
@@ -160,6 +285,47 @@ namespace nImO
             /*! @brief The target endpoint for UDP. */
             BUDP::endpoint  _udpSendpoint{};
 
+# if MAC_OR_LINUX_OR_BSD_
+            /*! @brief The target endpoint for local streams. */
+            BLStream::endpoint  _localStreamSendpoint{};
+
+            /*! @brief The target endpoint for local datagrams. */
+            BLDgram::endpoint   _localDatagramSendpoint{};
+# endif // MAC_OR_LINUX_OR_BSD_
+
+            /*! @brief The source of the last request received via UDP. */
+            BUDP::endpoint  _udpRequestEndpoint{};
+
+            /*! @brief A buffer for requests received from the receiver. */
+            std::array<char, 64>    _requestData{};
+
+            /*! @brief The identifier of the last UDP datagram that was sent as fragments. */
+            uint32_t    _udpDatagramId{0};
+
+            /*! @brief The fragments of the last UDP datagram that was too large to be sent as it is. */
+            std::vector<SpStdString>    _udpFragments{};
+
+            /*! @brief Used to keep Messages in the same order for encoding and for sending. */
+            std::mutex  _sendLock{};
+
+            /*! @brief The number of Values sent for each complete Value when delta encoding is used. */
+            size_t  _keyframeInterval{0};
+
+            /*! @brief The number of bytes in the smallest Message that is compressed, or zero if Messages are not compressed. */
+            size_t  _compressionThreshold{0};
+
+            /*! @brief A buffer for compressed Messages, kept between Messages to avoid reallocation. */
+            std::string _compressedBytes{};
+
+            /*! @brief @c true if Messages at least as large as the compression threshold are compressed. */
+            bool    _compressMessages{false};
+
+            /*! @brief @c true if a checksum is attached to each binary frame. */
+            bool    _frameChecksums{false};
+
+            /*! @brief @c true if floating-point values are sent as single-precision values. */
+            bool    _singlePrecision{false};
+
     }; // OutChannel
 
 } // nImO
@@ -38,7 +38,11 @@
 
 #include <nImOreceiveQueue.h>
 
+#include <BasicTypes/nImOvalue.h>
+#include <Containers/nImOdeltaCoder.h>
 #include <Containers/nImOmessage.h>
+#include <Containers/nImOschemaCodec.h>
+#include <nImOcompression.h>
 #include <nImOmainSupport.h>
 #include <nImOMIMESupport.h>
 
@@ -84,37 +88,165 @@
 # pragma mark Actions and Accessors
 #endif // defined(__APPLE__)
 
-void
-nImO::ReceiveQueue::addRawBytesAsMessage
-    (const int              tag,
-     const IPv4Address      senderAddress,
-     const IPv4Port         senderPort,
-     const std::string &    receivedAsString)
+bool
+nImO::ReceiveQueue::addBytesAsMessage
+    (const int          tag,
+     const IPv4Address  senderAddress,
+     const IPv4Port     senderPort,
+     CPtr(uint8_t)      data,
+     const size_t       numBytes,
+     SpKeyDictionary    keyDictionary,
+     SpDeltaCoder       deltaCoder,
+     SpSchemaCodec      schemaCodec,
+     const bool         deliverMessage)
 {
     ODL_OBJENTER(); //####
+    ODL_P1(data); //####
+    ODL_I1(numBytes); //####
+    bool    okSoFar{true};
+
     if (! _stop)
     {
-        ByteVector  inBytes;
+        auto        newMessage{std::make_shared<Message>()};
+        ByteVector  expandedBytes{};
 
-        // We need to convert the raw data to a string!
-        if (DecodeMIMEToBytes(receivedAsString, inBytes))
+        newMessage->setKeyDictionary(keyDictionary);
+        newMessage->open(false);
+        // A compressed Message is recognized by its first byte, which can not start an uncompressed Message.
+        if (IsCompressedMessage(data, numBytes))
         {
-            auto    newMessage{std::make_shared<Message>()};
+            if (ExpandMessageBytes(data, numBytes, expandedBytes))
+            {
+                newMessage->appendBytes(expandedBytes.data(), expandedBytes.size());
+            }
+            else
+            {
+                ODL_LOG("! (ExpandMessageBytes(data, numBytes, expandedBytes))"); //####
+                okSoFar = false;
+                ODL_B1(okSoFar); //####
+            }
+        }
+        else
+        {
+            newMessage->appendBytes(data, numBytes);
+        }
+        SpReceivedData  newData;
 
-            newMessage->open(false);
-            newMessage->appendBytes(inBytes.data(), inBytes.size());
-            auto newData{std::make_shared<ReceivedData>(tag, newMessage->getValue(), senderAddress, senderPort)};
+        if (okSoFar && deliverMessage && (nullptr == keyDictionary) && (nullptr == deltaCoder))
+        {
+            ODL_LOG("(okSoFar && deliverMessage && (nullptr == keyDictionary) && (nullptr == deltaCoder))"); //####
+            // Nothing in the Message depends on earlier Messages, so it is delivered without being read.
+            newData = std::make_shared<ReceivedData>(tag, newMessage, senderAddress, senderPort);
+        }
+        // A Message with the shape of the schema is decoded in place; delta-encoded Values and Map key references can't match it.
+        if (okSoFar && (! deliverMessage) && schemaCodec && (nullptr == keyDictionary) && (nullptr == deltaCoder))
+        {
+            DoubleVector    fields(schemaCodec->getFieldCount());
+
+            if (schemaCodec->decode(*newMessage, fields.data()))
+            {
+                ODL_LOG("(schemaCodec->decode(*newMessage, fields.data()))"); //####
+                newData = std::make_shared<ReceivedData>(tag, std::move(fields), senderAddress, senderPort);
+            }
+        }
+        if (nullptr == newData)
+        {
+            auto    newValue{newMessage->getValue()};
+            bool    keepValue{true};
 
+            if ((nullptr == newValue) || newValue->asFlaw())
+            {
+                ODL_LOG("((nullptr == newValue) || newValue->asFlaw())"); //####
+                okSoFar = false;
+                ODL_B1(okSoFar); //####
+            }
+            if (deltaCoder && okSoFar)
+            {
+                ODL_LOG("(deltaCoder && okSoFar)"); //####
+                // Values that can't be reconstructed are dropped until the next keyframe.
+                newValue = deltaCoder->decodeValue(newValue);
+                keepValue = (nullptr != newValue);
+            }
+            if (keepValue)
+            {
+                if (deliverMessage && okSoFar)
+                {
+                    ODL_LOG("(deliverMessage && okSoFar)"); //####
+                    if (deltaCoder)
+                    {
+                        ODL_LOG("(deltaCoder)"); //####
+                        auto    rebuiltMessage{std::make_shared<Message>()};
+
+                        // The Message only held the changes to an earlier Value, so the reconstructed Value is delivered.
+                        rebuiltMessage->open(true);
+                        rebuiltMessage->setValue(newValue);
+                        rebuiltMessage->close();
+                        newData = std::make_shared<ReceivedData>(tag, rebuiltMessage, senderAddress, senderPort);
+                    }
+                    else
+                    {
+                        ODL_LOG("! (deltaCoder)"); //####
+                        // The Map keys that the Message defines have been recorded, so its key references can be resolved.
+                        newData = std::make_shared<ReceivedData>(tag, newMessage, senderAddress, senderPort);
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (deliverMessage && okSoFar)"); //####
+                    newData = std::make_shared<ReceivedData>(tag, newValue, senderAddress, senderPort);
+                }
+            }
+        }
+        newMessage->close();
+        if (newData)
+        {
             {
                 std::lock_guard<std::mutex>  lock{_receivedLock};
 
                 _receivedData.push_back(newData);
             }
-            newMessage->close();
             _receivedCondition.notify_one();
         }
     }
-    ODL_OBJEXIT(); //####
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::ReceiveQueue::addBytesAsMessage
+
+bool
+nImO::ReceiveQueue::addRawBytesAsMessage
+    (const int          tag,
+     const IPv4Address  senderAddress,
+     const IPv4Port     senderPort,
+     CPtr(char)         receivedChars,
+     const size_t       numChars,
+     SpKeyDictionary    keyDictionary,
+     SpDeltaCoder       deltaCoder,
+     SpSchemaCodec      schemaCodec,
+     const bool         deliverMessage)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(receivedChars); //####
+    ODL_I1(numChars); //####
+    bool    okSoFar{true};
+
+    if (! _stop)
+    {
+        std::lock_guard<std::mutex> lock{_decodeLock};
+
+        if (DecodeMIMEToBytes(receivedChars, numChars, _decodedBytes))
+        {
+            okSoFar = addBytesAsMessage(tag, senderAddress, senderPort, _decodedBytes.data(), _decodedBytes.size(), keyDictionary,
+                                        deltaCoder, schemaCodec, deliverMessage);
+        }
+        else
+        {
+            ODL_LOG("! (DecodeMIMEToBytes(receivedChars, numChars, _decodedBytes))"); //####
+            okSoFar = false;
+            ODL_B1(okSoFar); //####
+        }
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
 } // nImO::ReceiveQueue::addRawBytesAsMessage
 
 nImO::SpReceivedData
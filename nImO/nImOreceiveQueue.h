@@ -78,27 +78,127 @@ namespace nImO
         public :
             // Public methods.
 
+            /*! @brief Convert the bytes of a Message, as received in a binary frame, to a message and add to the queue.
+             A Message that has the shape of the schema for the connection is added as its fields, rather than as a Value,
+             unless Messages are to be delivered as they are. A delivered Message that uses a dictionary for Map keys is
+             still read, so that the keys it defines are recorded, and a delta-encoded Message is delivered as the
+             reconstructed Value.
+             @param[in] tag The input channel index.
+             @param[in] senderAddress The sender's IP address.
+             @param[in] senderPort The sender's port.
+             @param[in] data The bytes of the Message.
+             @param[in] numBytes The number of bytes in the Message.
+             @param[in] keyDictionary The dictionary used for Map keys on the connection, if any.
+             @param[in] deltaCoder The decoder for delta-encoded Values on the connection, if any.
+             @param[in] schemaCodec The codec for the data type of the connection, if any.
+             @param[in] deliverMessage @c true if the Message is to be added as a Message rather than as a Value.
+             @return @c false if the bytes could not be read as a Message, in which case any Map keys that it
+             defined are lost. */
+            bool
+            addBytesAsMessage
+                (const int          tag,
+                 const IPv4Address  senderAddress,
+                 const IPv4Port     senderPort,
+                 CPtr(uint8_t)      data,
+                 const size_t       numBytes,
+                 SpKeyDictionary    keyDictionary = nullptr,
+                 SpDeltaCoder       deltaCoder = nullptr,
+                 SpSchemaCodec      schemaCodec = nullptr,
+                 const bool         deliverMessage = false);
+
+            /*! @brief Convert the bytes of a Message, as received in a binary frame, to a message and add to the queue.
+             @param[in] tag The input channel index.
+             @param[in] data The bytes of the Message.
+             @param[in] numBytes The number of bytes in the Message.
+             @param[in] keyDictionary The dictionary used for Map keys on the connection, if any.
+             @param[in] deltaCoder The decoder for delta-encoded Values on the connection, if any.
+             @param[in] schemaCodec The codec for the data type of the connection, if any.
+             @param[in] deliverMessage @c true if the Message is to be added as a Message rather than as a Value.
+             @return @c false if the bytes could not be read as a Message, in which case any Map keys that it
+             defined are lost. */
+            bool
+            addBytesAsMessage
+                (const int          tag,
+                 CPtr(uint8_t)      data,
+                 const size_t       numBytes,
+                 SpKeyDictionary    keyDictionary = nullptr,
+                 SpDeltaCoder       deltaCoder = nullptr,
+                 SpSchemaCodec      schemaCodec = nullptr,
+                 const bool         deliverMessage = false)
+            {
+                return addBytesAsMessage(tag, 0, 0, data, numBytes, keyDictionary, deltaCoder, schemaCodec, deliverMessage);
+            }
+
             /*! @brief Convert raw bytes to a message and add to the queue.
+             The raw bytes are decoded where they are, so that they can be taken directly from a receive buffer.
              @param[in] tag The input channel index.
              @param[in] senderAddress The sender's IP address.
              @param[in] senderPort The sender's port.
-             @param[in] receivedAsString The raw data as a string. */
-            void
+             @param[in] receivedChars The raw data.
+             @param[in] numChars The number of characters in the raw data.
+             @param[in] keyDictionary The dictionary used for Map keys on the connection, if any.
+             @param[in] deltaCoder The decoder for delta-encoded Values on the connection, if any.
+             @param[in] schemaCodec The codec for the data type of the connection, if any.
+             @param[in] deliverMessage @c true if the Message is to be added as a Message rather than as a Value.
+             @return @c false if the raw bytes could not be read as a Message, in which case any Map keys that
+             it defined are lost. */
+            bool
+            addRawBytesAsMessage
+                (const int          tag,
+                 const IPv4Address  senderAddress,
+                 const IPv4Port     senderPort,
+                 CPtr(char)         receivedChars,
+                 const size_t       numChars,
+                 SpKeyDictionary    keyDictionary = nullptr,
+                 SpDeltaCoder       deltaCoder = nullptr,
+                 SpSchemaCodec      schemaCodec = nullptr,
+                 const bool         deliverMessage = false);
+
+            /*! @brief Convert raw bytes to a message and add to the queue.
+             @param[in] tag The input channel index.
+             @param[in] senderAddress The sender's IP address.
+             @param[in] senderPort The sender's port.
+             @param[in] receivedAsString The raw data as a string.
+             @param[in] keyDictionary The dictionary used for Map keys on the connection, if any.
+             @param[in] deltaCoder The decoder for delta-encoded Values on the connection, if any.
+             @param[in] schemaCodec The codec for the data type of the connection, if any.
+             @param[in] deliverMessage @c true if the Message is to be added as a Message rather than as a Value.
+             @return @c false if the raw bytes could not be read as a Message, in which case any Map keys that
+             it defined are lost. */
+            inline bool
             addRawBytesAsMessage
                 (const int              tag,
                  const IPv4Address      senderAddress,
                  const IPv4Port         senderPort,
-                 const std::string &    receivedAsString);
+                 const std::string &    receivedAsString,
+                 SpKeyDictionary        keyDictionary = nullptr,
+                 SpDeltaCoder           deltaCoder = nullptr,
+                 SpSchemaCodec          schemaCodec = nullptr,
+                 const bool             deliverMessage = false)
+            {
+                return addRawBytesAsMessage(tag, senderAddress, senderPort, receivedAsString.data(), receivedAsString.length(),
+                                            keyDictionary, deltaCoder, schemaCodec, deliverMessage);
+            }
 
             /*! @brief Convert raw bytes to a message and add to the queue.
              @param[in] tag The input channel index.
-             @param[in] receivedAsString The raw data as a string. */
-            void
+             @param[in] receivedAsString The raw data as a string.
+             @param[in] keyDictionary The dictionary used for Map keys on the connection, if any.
+             @param[in] deltaCoder The decoder for delta-encoded Values on the connection, if any.
+             @param[in] schemaCodec The codec for the data type of the connection, if any.
+             @param[in] deliverMessage @c true if the Message is to be added as a Message rather than as a Value.
+             @return @c false if the raw bytes could not be read as a Message, in which case any Map keys that
+             it defined are lost. */
+            bool
             addRawBytesAsMessage
                 (const int              tag,
-                 const std::string &    receivedAsString)
+                 const std::string &    receivedAsString,
+                 SpKeyDictionary        keyDictionary = nullptr,
+                 SpDeltaCoder           deltaCoder = nullptr,
+                 SpSchemaCodec          schemaCodec = nullptr,
+                 const bool             deliverMessage = false)
             {
-                addRawBytesAsMessage(tag, 0, 0, receivedAsString);
+                return addRawBytesAsMessage(tag, 0, 0, receivedAsString, keyDictionary, deltaCoder, schemaCodec, deliverMessage);
             }
 
             /*! @brief Return the next available message in the queue if there is one.
@@ -130,6 +230,12 @@ namespace nImO
             /*! @brief The sequence of received messages. */
             std::deque<nImO::SpReceivedData>    _receivedData{};
 
+            /*! @brief Used to protect the buffer for decoded raw bytes. */
+            std::mutex  _decodeLock{};
+
+            /*! @brief The buffer for decoded raw bytes, kept between messages to avoid reallocation. */
+            ByteVector  _decodedBytes{};
+
             /*! @brief Used to protect the sequence of received messages. */
             std::mutex _receivedLock{};
 
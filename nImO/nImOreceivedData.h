@@ -91,6 +91,34 @@ namespace nImO
             {
             }
 
+            /*! @brief The constructor, for a message that was decoded by a schema codec.
+             @param[in] tag The channel index for the message.
+             @param[in] receivedFields The fields of the message from the sender.
+             @param[in] receivedAddress The send IP address. */
+            inline ReceivedData
+                (const int                  tag,
+                 nImO::DoubleVector &&      receivedFields,
+                 const nImO::IPv4Address    receivedAddress = 0,
+                 const nImO::IPv4Port       receivedPort = 0) :
+                _receivedFields(std::move(receivedFields)), _receivedAddress(receivedAddress), _receivedPort(receivedPort),
+                _tag{tag}
+            {
+            }
+
+            /*! @brief The constructor, for a message that is delivered as a Message rather than as a Value.
+             @param[in] tag The channel index for the message.
+             @param[in] receivedEncoding The Message from the sender.
+             @param[in] receivedAddress The send IP address. */
+            inline ReceivedData
+                (const int                  tag,
+                 nImO::SpMessage            receivedEncoding,
+                 const nImO::IPv4Address    receivedAddress = 0,
+                 const nImO::IPv4Port       receivedPort = 0) :
+                _receivedEncoding(receivedEncoding), _receivedAddress(receivedAddress), _receivedPort(receivedPort),
+                _tag{tag}
+            {
+            }
+
         protected :
             // Protected methods.
 
@@ -100,9 +128,16 @@ namespace nImO
         public :
             // Public fields.
 
-            /*! @brief The message from the sender. */
+            /*! @brief The message from the sender, unless it was decoded by the schema codec for the channel or the
+             channel delivers Messages. */
             nImO::SpValue   _receivedMessage{};
 
+            /*! @brief The fields of the message from the sender, if it was decoded by the schema codec for the channel. */
+            nImO::DoubleVector  _receivedFields{};
+
+            /*! @brief The Message from the sender, if the channel delivers Messages rather than Values. */
+            nImO::SpMessage _receivedEncoding{};
+
             /*! @brief The IP address of the sender. */
             nImO::IPv4Address   _receivedAddress{};
 
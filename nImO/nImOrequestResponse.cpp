@@ -38,6 +38,7 @@
 
 #include <nImOrequestResponse.h>
 
+#include <BasicTypes/nImOlogical.h>
 #include <BasicTypes/nImOstring.h>
 #include <Containers/nImOarray.h>
 #include <Containers/nImOmessage.h>
@@ -49,15 +50,6 @@
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
-#if defined(__APPLE__)
-# pragma clang diagnostic push
-# pragma clang diagnostic ignored "-Wdeprecated-declarations"
-#endif // defined(__APPLE__)
-#include <boost/algorithm/string/join.hpp>
-#if defined(__APPLE__)
-# pragma clang diagnostic pop
-#endif // defined(__APPLE__)
-
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -87,22 +79,28 @@
 
 /*! @brief Extract the response data and pass it on to a request-specific handler.
  @param[in] handler The request-specific handler, @c nullptr if not needed.
- @param[in] incoming The response to be processed.
+ @param[in] incoming The response to be processed, which includes the Message separator.
+ @param[in] incomingLength The number of characters in the response.
  @param[in] expectedKey The expected reponse key.
+ @param[out] moreFollows @c true if this is a batch of a streamed response that is followed by another batch.
  @param[out] failureReason A description of the reason for a failure.
  @return @c true if there were no issues with the response. */
 static bool
 handleResponse
     (Ptr(nImO::ResponseHandler) handler,
-     const std::string &        incoming,
+     CPtr(char)                 incoming,
+     const size_t               incomingLength,
      const std::string &        expectedKey,
+     bool &                     moreFollows,
      std::string &              failureReason)
 {
     ODL_ENTER(); //####
-    ODL_P2(handler, &failureReason); //####
-    ODL_S2s(incoming, expectedKey); //####
+    ODL_P4(handler, incoming, &moreFollows, &failureReason); //####
+    ODL_I1(incomingLength); //####
+    ODL_S1s(expectedKey); //####
     bool    wasOK{false};
 
+    moreFollows = false;
     if (nullptr == handler)
     {
         ODL_LOG("(nullptr == handler)"); //####
@@ -110,13 +108,10 @@ handleResponse
     }
     else
     {
-        // We need to strip off the Message separator first.
-        auto                trimmed{nImO::UnpackageMessage(incoming)};
         nImO::ByteVector    rawStuff{};
 
-        ODL_S1s(trimmed); //####
         // Ignore a request that can't be processed...
-        if (nImO::DecodeMIMEToBytes(trimmed, rawStuff))
+        if (nImO::UnpackageMessage(incoming, incomingLength, rawStuff))
         {
             auto    stuff{std::make_unique<nImO::Message>()};
 
@@ -146,9 +141,19 @@ handleResponse
                             if (expectedKey == response->getValue())
                             {
                                 wasOK = handler->doIt(*asArray);
-                                if (! wasOK)
+                                if (wasOK)
                                 {
-                                    ODL_LOG("(! wasOK)"); //####
+                                    if (handler->acceptsStreamedResponse() && (2 < asArray->size()))
+                                    {
+                                        auto    asLogical{(*asArray)[2]->asLogical()};
+
+                                        moreFollows = ((nullptr != asLogical) && asLogical->getValue());
+                                        ODL_B1(moreFollows); //####
+                                    }
+                                }
+                                else
+                                {
+                                    ODL_LOG("! (wasOK)"); //####
                                     failureReason = "Response handler rejected message"s;
                                 }
                             }
@@ -179,7 +184,7 @@ handleResponse
         }
         else
         {
-            ODL_LOG("! (nImO::DecodeMIMEToBytes(trimmed, rawStuff))"); //####
+            ODL_LOG("! (nImO::UnpackageMessage(incoming, incomingLength, rawStuff))"); //####
             failureReason = "Could not decode message"s;
         }
     }
@@ -187,30 +192,35 @@ handleResponse
     return wasOK;
 } // handleResponse
 
+/*! @brief Read a response, or the next batch of a streamed response, and pass it on to the handler.
+ @param[in] context The context in which the request is being made.
+ @param[in] socket The socket that the response is read from.
+ @param[in] rB The buffer holding the received data, which may already contain the next batch.
+ @param[in] handler The request-specific handler, @c nullptr if not needed.
+ @param[in] keepGoing Cleared when the last batch has been processed or there is an error.
+ @param[in] responseKey The expected reponse key.
+ @param[in] status The result of the request. */
 static void
-handleWriteCompletion
-    (nImO::SpContextWithNetworking  context,
-     nImO::SpSocketTCP              socket,
-     Ptr(nImO::ResponseHandler)     handler,
-     nImO::SpBool                   keepGoing,
-     const std::string &            responseKey,
-     nImO::SpSuccessOrFailure       status)
+readResponse
+    (nImO::SpContextWithNetworking              context,
+     nImO::SpSocketTCP                          socket,
+     std::shared_ptr<boost::asio::streambuf>    rB,
+     Ptr(nImO::ResponseHandler)                 handler,
+     nImO::SpBool                               keepGoing,
+     const std::string &                        responseKey,
+     nImO::SpSuccessOrFailure                   status)
 {
     ODL_ENTER(); //####
-    ODL_P4(context.get(), socket.get(), handler, keepGoing.get()); //####
-    ODL_P1(status.get()); //####
+    ODL_P4(context.get(), socket.get(), rB.get(), handler); //####
+    ODL_P2(keepGoing.get(), status.get()); //####
     ODL_S1s(responseKey); //####
-#if defined(nImO_ChattyTcpUdpLogging)
-    context->report("command sent."s);
-#endif /* defined(nImO_ChattyTcpUdpLogging) */
-    auto    rB{std::make_shared<boost::asio::streambuf>()};
-
     boost::asio::async_read_until(*socket, *rB, nImO::MatchMessageSeparator,
-                                [context, rB, handler, keepGoing, &responseKey, status]
+                                [context, socket, rB, handler, keepGoing, &responseKey, status]
                                 (const BSErr &      ec3,
                                  const std::size_t  size)
                                 {
-                                    NIMO_UNUSED_VAR_(size);
+                                    bool    moreFollows{false};
+
                                     if (ec3)
                                     {
                                         if (BAErr::operation_aborted == ec3)
@@ -230,7 +240,8 @@ handleWriteCompletion
                                     }
                                     else
                                     {
-                                        std::string handleThis{buffers_begin(rB->data()), buffers_end(rB->data())};
+                                        // The input sequence of a streambuf is contiguous, so it is decoded where it is.
+                                        auto    handleThis{StaticCast(CPtr(char), rB->data().data())};
 
 #if defined(nImO_ChattyTcpUdpLogging)
                                         context->report("got response."s);
@@ -239,16 +250,45 @@ handleWriteCompletion
                                         {
                                             std::string failureReason{};
 
-                                            if (! handleResponse(handler, handleThis, responseKey, failureReason))
+                                            if (! handleResponse(handler, handleThis, size, responseKey, moreFollows, failureReason))
                                             {
                                                 *status = std::make_pair(false, failureReason);
                                             }
                                         }
+                                        // Anything past the separator belongs to the next batch.
+                                        rB->consume(size);
+                                    }
+                                    if (moreFollows)
+                                    {
+                                        readResponse(context, socket, rB, handler, keepGoing, responseKey, status);
+                                    }
+                                    else
+                                    {
+                                        *keepGoing = false;
+                                        ODL_B1(*keepGoing); //####
                                     }
-                                    *keepGoing = false;
-                                    ODL_B1(*keepGoing); //####
                                 });
     ODL_EXIT(); //####
+} // readResponse
+
+static void
+handleWriteCompletion
+    (nImO::SpContextWithNetworking  context,
+     nImO::SpSocketTCP              socket,
+     Ptr(nImO::ResponseHandler)     handler,
+     nImO::SpBool                   keepGoing,
+     const std::string &            responseKey,
+     nImO::SpSuccessOrFailure       status)
+{
+    ODL_ENTER(); //####
+    ODL_P4(context.get(), socket.get(), handler, keepGoing.get()); //####
+    ODL_P1(status.get()); //####
+    ODL_S1s(responseKey); //####
+#if defined(nImO_ChattyTcpUdpLogging)
+    context->report("command sent."s);
+#endif /* defined(nImO_ChattyTcpUdpLogging) */
+    readResponse(context, socket, std::make_shared<boost::asio::streambuf>(), handler, keepGoing, responseKey, status);
+    ODL_EXIT(); //####
 } // handleWriteCompletion
 
 static void
@@ -339,6 +379,11 @@ nImO::SendRequestWithArgumentsAndNonEmptyResponse
     {
         requestArray->addEntries(*arguments);
     }
+    if ((nullptr != handler) && handler->acceptsStreamedResponse())
+    {
+        // Older responders ignore the extra argument and send the whole response at once.
+        requestArray->addValue(std::make_shared<Logical>(true));
+    }
     requestToSend.setValue(requestArray);
     requestToSend.close();
     if (0 < requestToSend.getLength())
@@ -352,11 +397,8 @@ nImO::SendRequestWithArgumentsAndNonEmptyResponse
         }
         else
         {
-            StdStringVector outVec{};
-            auto            keepGoing{std::make_shared<bool>(true)};
-
-            EncodeBytesAsMIME(outVec, asString);
-            auto    outString{nImO::PackageMessage(outVec)};
+            auto    keepGoing{std::make_shared<bool>(true)};
+            auto    outString{nImO::PackageMessage(asString)};
 
             ODL_S1(outString->c_str()); //####
             // Make a connection to the service whose address is in the connection argument.
@@ -148,6 +148,7 @@ nImO::ProcessServiceOptions
         kOptionEXPANDED,
         kOptionHELP,
         kOptionINTYPE,
+        kOptionJSON,
         kOptionLOG,
         kOptionNODE,
         kOptionOUTTYPE,
@@ -183,6 +184,9 @@ nImO::ProcessServiceOptions
     auto                inTypeHelpString2{"  "s + MakeOption("i"s, "intype"s) + " <type> \tSpecify the data type for input channels"s};
     Option_::Descriptor inTypeDescriptor2{StaticCast(unsigned int, OptionIndex::kOptionINTYPE), 0, "i", "intype", Option_::Arg::Required,
                                             inTypeHelpString2.c_str()};
+    auto                jsonHelpString{"  "s + MakeOption("j"s, "json"s) + " \tRead or write Values as JSON"s};
+    Option_::Descriptor jsonDescriptor{StaticCast(unsigned int, OptionIndex::kOptionJSON), 0, "j", "json", Option_::Arg::None,
+                                        jsonHelpString.c_str()};
     auto                logHelpString{"  "s + MakeOption("l"s, "log"s) + " \tLog the application"s};
     Option_::Descriptor logDescriptor{StaticCast(unsigned int, OptionIndex::kOptionLOG), 0, "l", "log", Option_::Arg::None,
                                         logHelpString.c_str()};
@@ -270,6 +274,10 @@ nImO::ProcessServiceOptions
     {
         ++descriptorCount;
     }
+    if (0 == (skipOptions & kSkipFlavoursOption))
+    {
+        ++descriptorCount;
+    }
     if (0 == (skipOptions & kSkipLoggingOption))
     {
         ++descriptorCount;
@@ -331,6 +339,10 @@ nImO::ProcessServiceOptions
             memcpy(usageWalker++, &inTypeDescriptor1, sizeof(inTypeDescriptor1));
         }
     }
+    if (0 == (skipOptions & kSkipFlavoursOption))
+    {
+        memcpy(usageWalker++, &jsonDescriptor, sizeof(jsonDescriptor));
+    }
     if (0 == (skipOptions & kSkipLoggingOption))
     {
         memcpy(usageWalker++, &logDescriptor, sizeof(logDescriptor));
@@ -397,6 +409,10 @@ nImO::ProcessServiceOptions
                             {
                                 optionValues._expanded = true;
                             }
+                            if ((0 == (skipOptions & kSkipFlavoursOption)) && (nullptr != options[StaticCast(size_t, OptionIndex::kOptionJSON)]))
+                            {
+                                optionValues._flavour = OutputFlavour::kFlavourJSON;
+                            }
                             if ((0 == (skipOptions & kSkipLoggingOption)) && (nullptr != options[StaticCast(size_t, OptionIndex::kOptionLOG)]))
                             {
                                 optionValues._logging = true;
@@ -510,6 +526,10 @@ nImO::ProcessServiceOptions
                         {
                             std::cout << "i";
                         }
+                        if (0 == (skipOptions & kSkipFlavoursOption))
+                        {
+                            std::cout << "j";
+                        }
                         if (0 == (skipOptions & kSkipLoggingOption))
                         {
                             std::cout << "l";
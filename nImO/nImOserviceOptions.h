@@ -96,6 +96,7 @@ namespace nImO
      The option '-e' / '--expanded' increases the amount of detail presented.
      The option '-h' / '--help' displays the list of optional parameters and arguments and returns @c false.
      The option '-i' / '--intype' specifies the data type for input channels.
+     The option '-j' / '--json' specifies that Values are read or written as JSON.
      The option '-l' / '--log' specifies that the executable is to be logged.
      The option '-o / '--outtype' specifies the data type for input channels.
      The option '-t' / '--tag' specifies the tag modifier, which is applied to the name of the service.
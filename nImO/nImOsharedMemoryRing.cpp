@@ -0,0 +1,559 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/nImOsharedMemoryRing.cpp
+//
+//  Project:    nImO
+//
+//  Contains:   The class definition for a ring buffer in shared memory.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+
+#include <nImOsharedMemoryRing.h>
+
+#include <cstring>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if MAC_OR_LINUX_OR_BSD_
+# include <fcntl.h>
+# include <signal.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#else // not MAC_OR_LINUX_OR_BSD_
+# include <process.h>
+#endif // not MAC_OR_LINUX_OR_BSD_
+#if LINUX_
+# include <linux/futex.h>
+# include <sys/syscall.h>
+#else // not LINUX_
+# include <boost/thread.hpp>
+#endif // not LINUX_
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a ring buffer in shared memory. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace nImO;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The shared control block at the start of a ring segment.
+ Each position is the number of bytes that have passed that point, so the ring is empty when the positions
+ are equal and full when they differ by the capacity. The fields that each side changes are kept in
+ separate cache lines. */
+struct RingControl
+{
+    /*! @brief Identifies the segment as holding a ring. */
+    uint32_t    _magic;
+
+    /*! @brief The process that created the ring, which is the reader. */
+    int32_t _readerProcess;
+
+    /*! @brief The number of bytes that the ring can hold. */
+    uint64_t    _capacity;
+
+    /*! @brief Non-zero once either side has closed the ring. */
+    std::atomic<uint32_t>   _closed;
+
+    /*! @brief The number of bytes that have been written. */
+    alignas(64) std::atomic<uint64_t>   _written;
+
+    /*! @brief Changed by the writer to wake the reader. */
+    std::atomic<uint32_t>   _writeSignal;
+
+    /*! @brief Non-zero while the reader is waiting for bytes to be written. */
+    std::atomic<uint32_t>   _readerWaiting;
+
+    /*! @brief The number of bytes that have been read. */
+    alignas(64) std::atomic<uint64_t>   _read;
+
+    /*! @brief Changed by the reader to wake the writer. */
+    std::atomic<uint32_t>   _readSignal;
+
+    /*! @brief Non-zero while the writer is waiting for space. */
+    std::atomic<uint32_t>   _writerWaiting;
+
+}; // RingControl
+
+/*! @brief The value in the first field of a ring segment. */
+constexpr uint32_t  kRingMagic{0x6E496D4F};
+
+#if (! LINUX_)
+/*! @brief The interval, in microseconds, between checks of a signal when futexes are not available. */
+constexpr long  kRingPollInterval{50};
+#endif // not LINUX_
+
+/*! @brief Used to make segment names unique within a process. */
+static std::atomic<uint32_t>    lRingNameCounter{0};
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if MAC_OR_LINUX_OR_BSD_
+/*! @brief Return @c true if the process that reads from a ring still exists.
+ @param[in] control The control block of the ring.
+ @return @c true if the process that reads from the ring still exists. */
+static bool
+isReaderAlive
+    (Ptr(RingControl)   control)
+{
+    ODL_ENTER(); //####
+    ODL_P1(control); //####
+    bool    result{(0 == kill(StaticCast(pid_t, control->_readerProcess), 0)) || (EPERM == errno)};
+
+    ODL_EXIT_B(result); //####
+    return result;
+} // isReaderAlive
+#endif // MAC_OR_LINUX_OR_BSD_
+
+/*! @brief Wait for a signal to change from the value that was seen, but for no longer than the wait interval.
+ @param[in] signal The signal to wait on.
+ @param[in] seen The value of the signal before the condition being waited for was checked. */
+static void
+waitForSignal
+    (std::atomic<uint32_t> &    signal,
+     const uint32_t             seen)
+{
+    ODL_ENTER(); //####
+    ODL_P1(&signal); //####
+    ODL_I1(seen); //####
+#if LINUX_
+    struct timespec timeout{0, kSharedMemoryWaitInterval * 1000};
+
+    syscall(SYS_futex, ReinterpretCast(Ptr(uint32_t), &signal), FUTEX_WAIT, seen, &timeout, nullptr, 0);
+#else // not LINUX_
+    for (long waited = 0; (seen == signal.load()) && (waited < kSharedMemoryWaitInterval); waited += kRingPollInterval)
+    {
+        boost::this_thread::sleep_for(boost::chrono::microseconds(kRingPollInterval));
+    }
+#endif // not LINUX_
+    ODL_EXIT(); //####
+} // waitForSignal
+
+/*! @brief Wake the other side of a ring if it is waiting.
+ The caller has already published the change that the other side is waiting for.
+ @param[in] signal The signal that the other side waits on.
+ @param[in] waiting Non-zero if the other side is waiting.
+ @param[in] always @c true if the signal is to be changed even if the other side is not waiting. */
+static void
+wakeWaiter
+    (std::atomic<uint32_t> &    signal,
+     std::atomic<uint32_t> &    waiting,
+     const bool                 always = false)
+{
+    ODL_ENTER(); //####
+    ODL_P2(&signal, &waiting); //####
+    ODL_B1(always); //####
+    if (always || (0 != waiting.load()))
+    {
+        signal.fetch_add(1);
+#if LINUX_
+        syscall(SYS_futex, ReinterpretCast(Ptr(uint32_t), &signal), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+#endif // LINUX_
+    }
+    ODL_EXIT(); //####
+} // wakeWaiter
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+nImO::SharedMemoryRing::SharedMemoryRing
+    (const std::string &    name,
+     const bool             create) :
+        _isCreator{create}, _name{name}
+{
+    ODL_ENTER(); //####
+    ODL_S1s(name); //####
+    ODL_B1(create); //####
+#if MAC_OR_LINUX_OR_BSD_
+    int descriptor;
+
+    if (create)
+    {
+        descriptor = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    }
+    else
+    {
+        descriptor = shm_open(name.c_str(), O_RDWR, 0);
+    }
+    if (0 <= descriptor)
+    {
+        size_t      segmentLength{sizeof(RingControl) + kSharedMemoryRingCapacity};
+        struct stat segmentInfo;
+        bool        sizeOK;
+
+        if (create)
+        {
+            sizeOK = (0 == ftruncate(descriptor, StaticCast(off_t, segmentLength)));
+        }
+        else
+        {
+            // The capacity is set by the reader, so the whole segment is mapped and then checked.
+            sizeOK = ((0 == fstat(descriptor, &segmentInfo)) && (sizeof(RingControl) < StaticCast(size_t, segmentInfo.st_size)));
+            segmentLength = StaticCast(size_t, segmentInfo.st_size);
+        }
+        if (sizeOK)
+        {
+            auto    mapped{mmap(nullptr, segmentLength, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0)};
+
+            if (MAP_FAILED == mapped)
+            {
+                ODL_LOG("(MAP_FAILED == mapped)"); //####
+            }
+            else
+            {
+                Ptr(RingControl)    control;
+
+                if (create)
+                {
+                    control = new (mapped) RingControl{};
+                    control->_magic = kRingMagic;
+                    control->_readerProcess = StaticCast(int32_t, getpid());
+                    control->_capacity = kSharedMemoryRingCapacity;
+                }
+                else
+                {
+                    control = StaticCast(Ptr(RingControl), mapped);
+                }
+                _capacity = StaticCast(size_t, control->_capacity);
+                if ((kRingMagic == control->_magic) && (0 < _capacity) && (0 == (_capacity & (_capacity - 1))) &&
+                    ((sizeof(RingControl) + _capacity) <= segmentLength))
+                {
+                    _control = control;
+                    _data = StaticCast(Ptr(uint8_t), mapped) + sizeof(RingControl);
+                    _mappedLength = segmentLength;
+                    if (create)
+                    {
+                        _position = control->_read.load();
+                    }
+                    else
+                    {
+                        _position = control->_written.load();
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! ((kRingMagic == control->_magic) && (0 < _capacity) && (0 == (_capacity & (_capacity - 1))) && " //####
+                            "((sizeof(RingControl) + _capacity) <= segmentLength))"); //####
+                    munmap(mapped, segmentLength);
+                    _capacity = 0;
+                }
+            }
+        }
+        ::close(descriptor);
+        // Once the writer has the segment mapped, the name is no longer needed.
+        if ((! create) || (nullptr == _control))
+        {
+            shm_unlink(name.c_str());
+        }
+    }
+#endif // MAC_OR_LINUX_OR_BSD_
+    ODL_EXIT_P(this); //####
+} // nImO::SharedMemoryRing::SharedMemoryRing
+
+nImO::SharedMemoryRing::~SharedMemoryRing
+    (void)
+{
+    ODL_OBJENTER(); //####
+    close();
+#if MAC_OR_LINUX_OR_BSD_
+    if (nullptr != _control)
+    {
+        ODL_LOG("(nullptr != _control)"); //####
+        munmap(_control, _mappedLength);
+        if (_isCreator)
+        {
+            // The writer may never have attached to the segment.
+            shm_unlink(_name.c_str());
+        }
+    }
+#endif // MAC_OR_LINUX_OR_BSD_
+    ODL_OBJEXIT(); //####
+} // nImO::SharedMemoryRing::~SharedMemoryRing
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+nImO::SharedMemoryRing::close
+    (void)
+{
+    ODL_OBJENTER(); //####
+    if (nullptr != _control)
+    {
+        auto    control{StaticCast(Ptr(RingControl), _control)};
+
+        control->_closed.store(1);
+        wakeWaiter(control->_writeSignal, control->_readerWaiting, true);
+        wakeWaiter(control->_readSignal, control->_writerWaiting, true);
+    }
+    ODL_OBJEXIT(); //####
+} // nImO::SharedMemoryRing::close
+
+std::string
+nImO::SharedMemoryRing::MakeName
+    (void)
+{
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_OR_BSD_
+    auto    processId{getpid()};
+#else // not MAC_OR_LINUX_OR_BSD_
+    auto    processId{_getpid()};
+#endif // not MAC_OR_LINUX_OR_BSD_
+    // Some systems limit segment names to 31 characters, which this fits within.
+    std::string result{"/nImO_"s + std::to_string(processId) + "_"s + std::to_string(++lRingNameCounter)};
+
+    ODL_EXIT_s(result); //####
+    return result;
+} // nImO::SharedMemoryRing::MakeName
+
+bool
+nImO::SharedMemoryRing::readBytes
+    (Ptr(uint8_t)   outBytes,
+     const size_t   numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(outBytes); //####
+    ODL_I1(numBytes); //####
+    auto    control{StaticCast(Ptr(RingControl), _control)};
+    bool    okSoFar{true};
+    size_t  mask{_capacity - 1};
+
+    for (size_t done = 0; okSoFar && (done < numBytes); )
+    {
+        auto    available{StaticCast(size_t, control->_written.load(std::memory_order_acquire) - _position)};
+
+        if (0 < available)
+        {
+            size_t  chunk{std::min(available, numBytes - done)};
+            size_t  offset{StaticCast(size_t, _position & mask)};
+            size_t  firstPart{std::min(chunk, _capacity - offset)};
+
+            memcpy(outBytes + done, _data + offset, firstPart);
+            if (firstPart < chunk)
+            {
+                memcpy(outBytes + done + firstPart, _data, chunk - firstPart);
+            }
+            _position += chunk;
+            done += chunk;
+            // The space is given back as soon as it has been copied, so that a large Message keeps moving.
+            control->_read.store(_position);
+            wakeWaiter(control->_readSignal, control->_writerWaiting);
+        }
+        else
+        {
+            if (0 == control->_closed.load())
+            {
+                auto    seen{control->_writeSignal.load()};
+
+                control->_readerWaiting.store(1);
+                if ((_position == control->_written.load()) && (0 == control->_closed.load()))
+                {
+                    waitForSignal(control->_writeSignal, seen);
+                }
+                control->_readerWaiting.store(0);
+            }
+            else
+            {
+                ODL_LOG("! (0 == control->_closed.load())"); //####
+                okSoFar = false;
+            }
+        }
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::SharedMemoryRing::readBytes
+
+bool
+nImO::SharedMemoryRing::readMessage
+    (ByteVector &   outBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(&outBytes); //####
+    bool    okSoFar{nullptr != _control};
+
+    if (okSoFar)
+    {
+        uint32_t    length;
+
+        okSoFar = readBytes(ReinterpretCast(Ptr(uint8_t), &length), sizeof(length));
+        if (okSoFar)
+        {
+            // The writer never sends a longer Message, so the rest of the ring can not be trusted.
+            if (kFrameMaximumLength >= length)
+            {
+                outBytes.resize(length);
+                okSoFar = readBytes(outBytes.data(), length);
+            }
+            else
+            {
+                ODL_LOG("! (kFrameMaximumLength >= length)"); //####
+                close();
+                okSoFar = false;
+            }
+        }
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::SharedMemoryRing::readMessage
+
+bool
+nImO::SharedMemoryRing::writeBytes
+    (CPtr(uint8_t)  inBytes,
+     const size_t   numBytes,
+     const bool     lastPart)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(inBytes); //####
+    ODL_I1(numBytes); //####
+    ODL_B1(lastPart); //####
+    auto    control{StaticCast(Ptr(RingControl), _control)};
+    bool    okSoFar{true};
+    size_t  mask{_capacity - 1};
+
+    for (size_t done = 0; okSoFar && (done < numBytes); )
+    {
+        auto    readPosition{control->_read.load(std::memory_order_acquire)};
+        auto    space{_capacity - StaticCast(size_t, _position - readPosition)};
+
+        if (0 < space)
+        {
+            size_t  chunk{std::min(space, numBytes - done)};
+            size_t  offset{StaticCast(size_t, _position & mask)};
+            size_t  firstPart{std::min(chunk, _capacity - offset)};
+
+            memcpy(_data + offset, inBytes + done, firstPart);
+            if (firstPart < chunk)
+            {
+                memcpy(_data, inBytes + done + firstPart, chunk - firstPart);
+            }
+            _position += chunk;
+            done += chunk;
+        }
+        else
+        {
+            // The reader is given what is in the ring before waiting for it to make space.
+            control->_written.store(_position);
+            wakeWaiter(control->_writeSignal, control->_readerWaiting);
+            if (0 == control->_closed.load())
+            {
+                auto    seen{control->_readSignal.load()};
+
+                control->_writerWaiting.store(1);
+                if ((readPosition == control->_read.load()) && (0 == control->_closed.load()))
+                {
+                    waitForSignal(control->_readSignal, seen);
+                }
+                control->_writerWaiting.store(0);
+#if MAC_OR_LINUX_OR_BSD_
+                // If the reader has gone away without closing the ring, nothing will ever make space.
+                if (readPosition == control->_read.load())
+                {
+                    okSoFar = isReaderAlive(control);
+                    ODL_B1(okSoFar); //####
+                }
+#endif // MAC_OR_LINUX_OR_BSD_
+            }
+            else
+            {
+                ODL_LOG("! (0 == control->_closed.load())"); //####
+                okSoFar = false;
+            }
+        }
+    }
+    if (okSoFar && lastPart)
+    {
+        control->_written.store(_position);
+        wakeWaiter(control->_writeSignal, control->_readerWaiting);
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::SharedMemoryRing::writeBytes
+
+bool
+nImO::SharedMemoryRing::writeMessage
+    (CPtr(uint8_t)  inBytes,
+     const size_t   numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1(inBytes); //####
+    ODL_I1(numBytes); //####
+    bool    okSoFar{(nullptr != _control) && (kFrameMaximumLength >= numBytes)};
+
+    if (okSoFar)
+    {
+        auto    control{StaticCast(Ptr(RingControl), _control)};
+
+        // Once the reader has closed the ring, Messages are discarded.
+        if (0 == control->_closed.load())
+        {
+            auto    length{StaticCast(uint32_t, numBytes)};
+
+            okSoFar = (writeBytes(ReinterpretCast(CPtr(uint8_t), &length), sizeof(length), false) && writeBytes(inBytes, numBytes, true));
+        }
+        else
+        {
+            ODL_LOG("! (0 == control->_closed.load())"); //####
+            okSoFar = false;
+        }
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // nImO::SharedMemoryRing::writeMessage
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,226 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       nImO/nImOsharedMemoryRing.h
+//
+//  Project:    nImO
+//
+//  Contains:   The class declaration for a ring buffer in shared memory.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+#if (! defined(nImOsharedMemoryRing_H_))
+# define nImOsharedMemoryRing_H_ /* Header guard */
+
+# include <nImOcommon.h>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a ring buffer in shared memory. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace nImO
+{
+    /*! @brief A class to pass Messages between two processes on the same machine through shared memory.
+
+     The ring has exactly one writer and one reader. Each Message is written as a four-byte length
+     followed by its bytes; a Message that is larger than the ring is passed through it in pieces. The
+     length is limited to kFrameMaximumLength, as for binary frames, and the reader treats a larger length
+     as damage and closes the ring, rather than trusting it. The read and write positions are only ever advanced
+     by their owners, so no locks are needed, and a side only sleeps when the ring is empty or full. The
+     reader creates the segment and the writer attaches to it by name. */
+    class SharedMemoryRing final
+    {
+
+        public :
+            // Public type definitions.
+
+        protected :
+            // Protected type definitions.
+
+        private :
+            // Private type definitions.
+
+        public :
+            // Public methods.
+
+            /*! @brief The constructor.
+             @param[in] name The name of the shared memory segment.
+             @param[in] create @c true if the segment is to be created, which is done by the reader, and
+             @c false if an existing segment is to be attached to, which is done by the writer. */
+            SharedMemoryRing
+                (const std::string &    name,
+                 const bool             create);
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            SharedMemoryRing
+                (const SharedMemoryRing &   other) = delete;
+
+            /*! @brief The move constructor.
+             @param[in] other The object to be moved. */
+            SharedMemoryRing
+                (SharedMemoryRing &&    other)
+                noexcept = delete;
+
+            /*! @brief The destructor. */
+            ~SharedMemoryRing
+                (void);
+
+            /*! @brief Mark the ring as closed and wake the other side, so that neither side waits for the other. */
+            void
+            close
+                (void);
+
+            /*! @brief Return the name of the shared memory segment.
+             @return The name of the shared memory segment. */
+            inline const std::string &
+            getName
+                (void)
+                const
+            {
+                return _name;
+            }
+
+            /*! @brief Return @c true if the ring can be used.
+             @return @c true if the ring can be used. */
+            inline bool
+            isOpen
+                (void)
+                const
+            {
+                return (nullptr != _control);
+            }
+
+            /*! @brief Return a name for a new shared memory segment that is unique on this machine.
+             @return A name for a new shared memory segment. */
+            static std::string
+            MakeName
+                (void);
+
+            /*! @brief The copy assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            SharedMemoryRing &
+            operator=
+                (const SharedMemoryRing &   other) = delete;
+
+            /*! @brief The move assignment operator.
+             @param[in] other The object to be moved.
+             @return The updated object. */
+            SharedMemoryRing &
+            operator=
+                (SharedMemoryRing &&    other)
+                noexcept = delete;
+
+            /*! @brief Wait for the next Message and return its bytes.
+             If the length of the Message is larger than kFrameMaximumLength, the ring is closed.
+             @param[out] outBytes The bytes of the Message.
+             @return @c true if a Message was read and @c false if the ring was closed or the length was invalid. */
+            bool
+            readMessage
+                (ByteVector &   outBytes);
+
+            /*! @brief Write a Message, waiting for space if the ring is full.
+             @param[in] inBytes The bytes of the Message.
+             @param[in] numBytes The number of bytes in the Message.
+             @return @c true if the Message was written and @c false if it is larger than kFrameMaximumLength, the ring
+             was closed or the reader has gone away. */
+            bool
+            writeMessage
+                (CPtr(uint8_t)  inBytes,
+                 const size_t   numBytes);
+
+        protected :
+            // Protected methods.
+
+        private :
+            // Private methods.
+
+            /*! @brief Copy bytes out of the ring, waiting for them to be written if necessary.
+             @param[out] outBytes Where to put the bytes.
+             @param[in] numBytes The number of bytes to copy.
+             @return @c true if the bytes were copied and @c false if the ring was closed. */
+            bool
+            readBytes
+                (Ptr(uint8_t)   outBytes,
+                 const size_t   numBytes);
+
+            /*! @brief Copy bytes into the ring, waiting for space if necessary.
+             The bytes are made visible to the reader when the ring is full and when @c lastPart is @c true.
+             @param[in] inBytes The bytes to be copied.
+             @param[in] numBytes The number of bytes to copy.
+             @param[in] lastPart @c true if these are the last bytes of a Message.
+             @return @c true if the bytes were copied and @c false if the ring was closed or the reader has gone away. */
+            bool
+            writeBytes
+                (CPtr(uint8_t)  inBytes,
+                 const size_t   numBytes,
+                 const bool     lastPart);
+
+        public :
+            // Public fields.
+
+        protected :
+            // Protected fields.
+
+        private :
+            // Private fields.
+
+            /*! @brief The number of bytes that the ring can hold; always a power of two. */
+            size_t  _capacity{0};
+
+            /*! @brief The shared control block, or @c nullptr if the ring could not be set up. */
+            Ptr(void)   _control{nullptr};
+
+            /*! @brief The data area of the ring. */
+            Ptr(uint8_t)    _data{nullptr};
+
+            /*! @brief @c true if this object created the segment. */
+            bool    _isCreator{false};
+
+            /*! @brief The number of bytes in the mapped segment. */
+            size_t  _mappedLength{0};
+
+            /*! @brief The name of the shared memory segment. */
+            std::string _name{};
+
+            /*! @brief The position that the owner of this side has reached, which can be ahead of the shared position. */
+            uint64_t    _position{0};
+
+    }; // SharedMemoryRing
+
+} // nImO
+
+#endif // not defined(nImOsharedMemoryRing_H_)